@@ -50,6 +50,7 @@
 #include "G4SmartVoxelStat.hh"
 
 class G4VPhysicalVolume;
+class G4LogicalVolume;
 
 class G4GeometryManager
 {
@@ -96,6 +97,10 @@ class G4GeometryManager
     void BuildOptimisations(G4bool allOpt, G4VPhysicalVolume* vol);
     void DeleteOptimisations();
     void DeleteOptimisations(G4VPhysicalVolume* vol);
+    void BuildSafetyGrid(G4LogicalVolume* volume, G4bool verbose = false);
+    void DeleteSafetyGrid(G4LogicalVolume* volume);
+    void BuildSolidEnvelope(G4LogicalVolume* volume);
+    void DeleteSolidEnvelope(G4LogicalVolume* volume);
     static void ReportVoxelStats( std::vector<G4SmartVoxelStat>& stats,
                                   G4double totalCpuTime );
     static G4ThreadLocal G4GeometryManager* fgInstance;
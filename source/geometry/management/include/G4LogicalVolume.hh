@@ -71,6 +71,10 @@
 //    - Pointer (possibly 0) to user Step limit object for this node.
 //    G4SmartVoxelHeader* fVoxel
 //    - Pointer (possibly 0) to optimisation info objects.
+//    G4SafetyGrid* fSafetyGrid
+//    - Pointer (possibly 0) to the grid of safety lower bounds.
+//    G4SolidEnvelope* fSolidEnvelope
+//    - Pointer (possibly 0) to the envelope of the solid, for fast geometry.
 //    G4bool fOptimise
 //    - Flag to identify if optimisation should be applied or not.
 //    G4bool fRootRegion
@@ -122,6 +126,8 @@ class G4VSensitiveDetector;
 class G4VSolid;
 class G4UserLimits;
 class G4SmartVoxelHeader;
+class G4SafetyGrid;
+class G4SolidEnvelope;
 class G4VisAttributes;
 class G4FastSimulationManager;
 class G4MaterialCutsCouple;
@@ -218,6 +224,8 @@ class G4LogicalVolume
       // and no bounds checking is performed.
     void AddDaughter(G4VPhysicalVolume* p);
       // Adds the volume p as a daughter of the current logical volume.
+    inline void ReserveDaughters(size_t n);
+      // Reserves space for n daughters, before placing many volumes.
     inline G4bool IsDaughter(const G4VPhysicalVolume* p) const;
       // Returns true if the volume p is a daughter of the current
       // logical volume.
@@ -291,6 +299,15 @@ class G4LogicalVolume
     inline G4SmartVoxelHeader* GetVoxelHeader() const;
     inline void SetVoxelHeader(G4SmartVoxelHeader *pVoxel);
       // Gets and sets current VoxelHeader.
+
+    inline G4SafetyGrid* GetSafetyGrid() const;
+    inline void SetSafetyGrid(G4SafetyGrid *pGrid);
+      // Gets and sets the grid of safety lower bounds (can be nullptr).
+
+    inline const G4SolidEnvelope* GetSolidEnvelope() const;
+    inline void SetSolidEnvelope(G4SolidEnvelope* pEnvelope);
+      // Gets and sets the envelope of the solid used by the navigation
+      // in fast geometry regions (can be nullptr).
     
     inline G4double GetSmartless() const;
     inline void SetSmartless(G4double s);
@@ -404,6 +421,10 @@ class G4LogicalVolume
       // Pointer (possibly nullptr) to user Step limit object for this node.
     G4SmartVoxelHeader* fVoxel = nullptr;
       // Pointer (possibly nullptr) to optimisation info objects.
+    G4SafetyGrid* fSafetyGrid = nullptr;
+      // Pointer (possibly nullptr) to the grid of safety lower bounds.
+    G4SolidEnvelope* fSolidEnvelope = nullptr;
+      // Pointer (possibly nullptr) to the envelope of the solid.
     G4double fSmartless = 2.0;
       // Quality for optimisation, average number of voxels to be spent
       // per content.
@@ -37,8 +37,11 @@
 // All logical volumes should be registered with G4LogicalVolumeStore,
 // and removed on their destruction.
 // The underlying container initially has a capacity of 100.
-// A map indexed by volume names is also recorded for fast search;
-// pointers to volumes with same name are stored in buckets.
+// A hash map indexed by volume names is also recorded for fast search;
+// pointers to volumes with same name are stored in buckets. The map is
+// updated incrementally: volumes registered in bulk, between calls to
+// BeginBulkRegistration() and EndBulkRegistration(), are only appended
+// to the collection and are added to the map at the next search.
 //
 // If much additional functionality is added, should consider containment
 // instead of inheritance for std::vector<T>.
@@ -49,7 +52,7 @@
 #define G4LOGICALVOLUMESTORE_HH 1
 
 #include <vector>
-#include <map>
+#include <unordered_map>
 
 #include "G4LogicalVolume.hh"
 #include "G4VStoreNotifier.hh"
@@ -68,6 +71,14 @@ class G4LogicalVolumeStore : public std::vector<G4LogicalVolume*>
       // Assign a notifier for allocation/deallocation of the logical volumes.
     static void Clean();
       // Delete all volumes from the store.
+    static void BeginBulkRegistration(std::size_t nvolumes = 0);
+      // Start a bulk registration, reserving space for the given number of
+      // additional volumes. Until the matching EndBulkRegistration(),
+      // volumes are appended to the collection without notification and
+      // without update of the internal map. Calls can be nested.
+    static void EndBulkRegistration();
+      // End a bulk registration; at the outermost level, the internal map
+      // is brought up to date.
 
     G4LogicalVolume* GetVolume(const G4String& name, G4bool verbose=true,
                                G4bool reverseSearch=false) const;
@@ -75,11 +86,12 @@ class G4LogicalVolumeStore : public std::vector<G4LogicalVolume*>
       // that name. Uses the internal map for fast search and warns if
       // a volume in the collection is not unique or not found.
 
-    inline G4bool IsMapValid() const  { return mvalid; }
+    inline G4bool IsMapValid() const
+      { return mvalid && (nmapped == size()); }
     inline void SetMapValid(G4bool val)  { mvalid = val; }
       // Accessor to assess validity of the internal map.
-    inline const std::map<G4String,
-            std::vector<G4LogicalVolume*> >& GetMap() const { return bmap; }
+    inline const std::unordered_map<G4String, std::vector<G4LogicalVolume*>,
+            std::hash<std::string> >& GetMap() const { return bmap; }
       // Return the internal map.
     void UpdateMap();
       // Bring contents of internal map up to date and resets validity flag.
@@ -101,8 +113,11 @@ class G4LogicalVolumeStore : public std::vector<G4LogicalVolume*>
     static G4ThreadLocal G4VStoreNotifier* fgNotifier;
     static G4ThreadLocal G4bool locked;
 
-    std::map<G4String, std::vector<G4LogicalVolume*> > bmap;
-    G4bool mvalid = false;  // Flag to indicate if map is up to date or not
+    std::unordered_map<G4String, std::vector<G4LogicalVolume*>,
+                       std::hash<std::string> > bmap;
+    G4bool mvalid = true;   // Flag to indicate if map is up to date or not
+    std::size_t nmapped = 0;  // Number of volumes already in the map
+    G4int nbulk = 0;  // Nesting level of bulk registrations
 };
 
 #endif
@@ -36,8 +36,11 @@
 //
 // All volumes should be registered with G4PhysicalVolumeStore, and removed on
 // their destruction. The underlying container initially has a capacity of 100.
-// A map indexed by volume names is also recorded for fast search;
-// pointers to volumes with same name are stored in buckets.
+// A hash map indexed by volume names is also recorded for fast search;
+// pointers to volumes with same name are stored in buckets. The map is
+// updated incrementally: volumes registered in bulk, between calls to
+// BeginBulkRegistration() and EndBulkRegistration(), are only appended
+// to the collection and are added to the map at the next search.
 //
 // If much additional functionality is added, should consider containment
 // instead of inheritance for std::vector<T>.
@@ -48,7 +51,7 @@
 #define G4PHYSICALVOLUMESTORE_HH 1
 
 #include <vector>
-#include <map>
+#include <unordered_map>
 
 #include "G4VPhysicalVolume.hh"
 #include "G4VStoreNotifier.hh"
@@ -68,6 +71,14 @@ class G4PhysicalVolumeStore : public std::vector<G4VPhysicalVolume*>
     static void Clean();
       // Delete all physical volumes from the store. Mother logical volumes
       // are automatically notified and have their daughters de-registered.
+    static void BeginBulkRegistration(std::size_t nvolumes = 0);
+      // Start a bulk registration, reserving space for the given number of
+      // additional volumes. Until the matching EndBulkRegistration(),
+      // volumes are appended to the collection without notification and
+      // without update of the internal map. Calls can be nested.
+    static void EndBulkRegistration();
+      // End a bulk registration; at the outermost level, the internal map
+      // is brought up to date.
 
     G4VPhysicalVolume* GetVolume(const G4String& name,
                                  G4bool verbose = true,
@@ -76,11 +87,12 @@ class G4PhysicalVolumeStore : public std::vector<G4VPhysicalVolume*>
       // that name. Uses the internal map for fast search and warns if
       // a volume in the collection is not unique or not found.
 
-    inline G4bool IsMapValid() const  { return mvalid; }
+    inline G4bool IsMapValid() const
+      { return mvalid && (nmapped == size()); }
     inline void SetMapValid(G4bool val)  { mvalid = val; }
       // Accessor to assess validity of the internal map.
-    inline const std::map<G4String,
-            std::vector<G4VPhysicalVolume*> >& GetMap() const { return bmap; }
+    inline const std::unordered_map<G4String, std::vector<G4VPhysicalVolume*>,
+            std::hash<std::string> >& GetMap() const { return bmap; }
       // Return the internal map.
     void UpdateMap();
       // Bring contents of internal map up to date and resets validity flag.
@@ -102,8 +114,11 @@ class G4PhysicalVolumeStore : public std::vector<G4VPhysicalVolume*>
     static G4ThreadLocal G4VStoreNotifier* fgNotifier;
     static G4ThreadLocal G4bool locked;
 
-    std::map<G4String, std::vector<G4VPhysicalVolume*> > bmap;
-    G4bool mvalid = false;  // Flag to indicate if map is up to date or not
+    std::unordered_map<G4String, std::vector<G4VPhysicalVolume*>,
+                       std::hash<std::string> > bmap;
+    G4bool mvalid = true;   // Flag to indicate if map is up to date or not
+    std::size_t nmapped = 0;  // Number of volumes already in the map
+    G4int nbulk = 0;  // Nesting level of bulk registrations
 };
 
 #endif
@@ -214,6 +214,23 @@ class G4Region
     G4UserSteppingAction* GetRegionalSteppingAction() const;
       // Set/Get method of the regional user stepping action
 
+    inline void SetSafetyGridCells(G4int ncells);
+    inline G4int GetSafetyGridCells() const;
+      // Set/Get the maximum number of cells of the grid of safety lower
+      // bounds built, when closing the geometry, for each logical volume
+      // of the region holding placed daughters, unless the volume itself
+      // is placed by a parameterised or replicated volume. Zero (default)
+      // disables grids.
+
+    inline void SetFastGeometryDistance(G4double dist);
+    inline G4double GetFastGeometryDistance() const;
+      // Set/Get the refinement distance of the fast geometry mode: when
+      // closing the geometry, an envelope is built for the solid of each
+      // logical volume of the region; the navigation takes the safety
+      // from the envelope beyond this distance, and intersects the solid
+      // only when the track enters its envelope within the step.
+      // Zero (default) disables the fast geometry mode for the region.
+
   public:
 
     G4Region(__void__&);
@@ -268,6 +285,9 @@ class G4Region
     G4bool fInMassGeometry = false;
     G4bool fInParallelGeometry = false;
 
+    G4int fSafetyGridCells = 0;
+    G4double fFastGeometryDistance = 0.;
+
     G4int instanceID;
       // This field is used as instance ID.
     G4GEOM_DLL static G4RegionManager subInstanceManager;
@@ -0,0 +1,93 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4SafetyGrid
+//
+// Class description:
+//
+// Regular grid of lower bounds of the isotropic safety, spanning the
+// extent of a logical volume with daughters. Each cell holds a value
+// guaranteed not to exceed the safety of any point inside the cell,
+// computed at the cell centre from the mother DistanceToOut(p) and the
+// daughters DistanceToIn(p), reduced by the half-diagonal of the cell.
+// Grids are built when closing the geometry, for the logical volumes
+// of the regions requesting them (see G4Region::SetSafetyGridCells()),
+// and let the navigator answer a safety request without computation
+// when the bound covers the maximum length of interest.
+//
+// Member data:
+//
+// G4ThreeVector fMin, fMax
+//   - Extent of the grid, in the frame of the logical volume
+// G4int fNx, fNy, fNz
+//   - Number of cells along each axis
+// G4double fInvWidthX, fInvWidthY, fInvWidthZ
+//   - Inverse of the cell widths
+// std::vector<G4double> fSafety
+//   - Lower bound of the safety in each cell, x index running fastest
+
+// 19.10.2026 - First implementation
+// --------------------------------------------------------------------
+#ifndef G4SAFETYGRID_HH
+#define G4SAFETYGRID_HH 1
+
+#include <vector>
+
+#include "G4Types.hh"
+#include "G4ThreeVector.hh"
+
+class G4LogicalVolume;
+
+class G4SafetyGrid
+{
+  public:  // with description
+
+    G4SafetyGrid(G4LogicalVolume* pVolume, G4int maxCells);
+      // Build the grid for the logical volume, with at most
+      // the given number of cells
+    ~G4SafetyGrid() = default;
+
+    inline G4double GetSafety(const G4ThreeVector& localPoint) const;
+      // Return the lower bound of the safety at the point, given in
+      // the frame of the logical volume; zero outside of the grid
+
+    inline G4int GetNumberOfCells() const;
+    inline std::size_t GetMemoryUse() const;
+    G4double GetFilledFraction() const;
+      // Number of cells, memory used and fraction of non-zero cells
+
+  private:
+
+    G4ThreeVector fMin, fMax;
+    G4int fNx = 1, fNy = 1, fNz = 1;
+    G4double fInvWidthX = 0., fInvWidthY = 0., fInvWidthZ = 0.;
+    std::vector<G4double> fSafety;
+};
+
+#include "G4SafetyGrid.icc"
+
+#endif
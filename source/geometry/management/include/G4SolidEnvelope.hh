@@ -0,0 +1,107 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4SolidEnvelope
+//
+// Class description:
+//
+// Cheap conservative envelope of a solid, used by the navigation in the
+// regions flagged for fast geometry (see G4Region::SetFastGeometryDistance()).
+// The envelope is the intersection of the bounding box of the solid and of
+// its bounding box in a frame rotated by 45 degrees around the Z axis,
+// both computed through the solid's BoundingLimits() and CalculateExtent()
+// (G4BoundingEnvelope for most CSG and specific solids). For round solids,
+// such as polycones, polyhedra, tori or twisted tubes, the envelope is an
+// octagonal prism around the solid.
+// The distance to the envelope is a lower bound of the distance to the
+// solid: the isotropic safety is taken from the envelope far from the
+// solid, and the solid is asked only within the refinement distance;
+// tracks missing the envelope, or entering it beyond the current step,
+// are not intersected with the solid.
+//
+// Member data:
+//
+// G4ThreeVector fMin, fMax
+//   - Bounding box of the solid, enlarged by the tolerance
+// G4double fRotMin[2], fRotMax[2]
+//   - Extent along X and Y in the frame rotated by 45 degrees
+// G4bool fRotated
+//   - True if the rotated extent is available
+// G4double fRefineDistance
+//   - Distance from the envelope below which the solid is asked
+
+// 19.10.2026 - First implementation
+// --------------------------------------------------------------------
+#ifndef G4SOLIDENVELOPE_HH
+#define G4SOLIDENVELOPE_HH 1
+
+#include "G4Types.hh"
+#include "G4ThreeVector.hh"
+#include "G4VSolid.hh"
+
+class G4SolidEnvelope
+{
+  public:  // with description
+
+    G4SolidEnvelope(const G4VSolid* pSolid, G4double refineDistance);
+      // Build the envelope of the solid
+    ~G4SolidEnvelope() = default;
+
+    inline G4double DistanceToIn(const G4VSolid* pSolid,
+                                 const G4ThreeVector& p) const;
+      // Return the isotropic safety of the point from the solid: the
+      // distance to the envelope, if larger than the refinement distance,
+      // otherwise the solid's DistanceToIn(p)
+
+    inline G4double DistanceToIn(const G4VSolid* pSolid,
+                                 const G4ThreeVector& p,
+                                 const G4ThreeVector& v,
+                                 G4double pStep) const;
+      // Return the solid's DistanceToIn(p,v), or kInfinity if the track
+      // does not enter the envelope within the given step
+
+    G4double Distance(const G4ThreeVector& p) const;
+      // Return the distance from the point to the envelope, zero inside
+
+    G4double DistanceAlong(const G4ThreeVector& p,
+                           const G4ThreeVector& v) const;
+      // Return the distance along the direction to the envelope, zero
+      // inside, kInfinity if the track misses it
+
+    inline G4double GetRefineDistance() const;
+
+  private:
+
+    G4ThreeVector fMin, fMax;
+    G4double fRotMin[2] = { 0., 0. }, fRotMax[2] = { 0., 0. };
+    G4bool fRotated = false;
+    G4double fRefineDistance = 0.;
+};
+
+#include "G4SolidEnvelope.icc"
+
+#endif
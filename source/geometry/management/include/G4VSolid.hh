@@ -159,6 +159,21 @@ class G4VSolid
       // Calculate the distance to the nearest surface of a shape from an
       // inside point. The distance can be an underestimate.
 
+    virtual void InsideBatch(G4int n, const G4ThreeVector* p,
+                             EInside* inside) const;
+    virtual void DistanceToInBatch(G4int n, const G4ThreeVector* p,
+                                   const G4ThreeVector* v,
+                                   G4double* dist) const;
+    virtual void SafetyToInBatch(G4int n, const G4ThreeVector* p,
+                                 G4double* safety) const;
+    virtual void SafetyToOutBatch(G4int n, const G4ThreeVector* p,
+                                  G4double* safety) const;
+      // Multi-point versions of Inside(p), DistanceToIn(p,v), DistanceToIn(p)
+      // and DistanceToOut(p), filling the n results for the n points (and
+      // directions) given. Meant for clients testing many points against
+      // the same solid. The default implementations loop over the scalar
+      // methods; solids may provide specialised loops.
+
 
     virtual void ComputeDimensions(G4VPVParameterisation* p,
 	                           const G4int n,
@@ -222,6 +237,12 @@ class G4VSolid
       // If the solid is a "G4DisplacedSolid", return a self pointer
       // else return 0.
 
+    virtual void BuildOptimisation(G4bool verbose = false);
+    virtual void DeleteOptimisation();
+      // Build/delete optional navigation acceleration data for solids
+      // composed of other solids. Invoked by G4GeometryManager when the
+      // geometry is closed/opened. The default implementation does nothing.
+
   public:  // without description
 
     G4VSolid(__void__&);
@@ -34,6 +34,8 @@ geant4_add_module(G4geometrymng
     G4Region.hh
     G4Region.icc
     G4RegionStore.hh
+    G4SafetyGrid.hh
+    G4SafetyGrid.icc
     G4ScaleTransform.hh
     G4ScaleTransform.icc
     G4SmartVoxelHeader.hh
@@ -43,6 +45,8 @@ geant4_add_module(G4geometrymng
     G4SmartVoxelProxy.hh
     G4SmartVoxelProxy.icc
     G4SmartVoxelStat.hh
+    G4SolidEnvelope.hh
+    G4SolidEnvelope.icc
     G4SolidStore.hh
     G4TouchableHandle.hh
     G4UAdapter.hh
@@ -83,10 +87,12 @@ geant4_add_module(G4geometrymng
     G4ReflectedSolid.cc
     G4Region.cc
     G4RegionStore.cc
+    G4SafetyGrid.cc
     G4SmartVoxelHeader.cc
     G4SmartVoxelNode.cc
     G4SmartVoxelProxy.cc
     G4SmartVoxelStat.cc
+    G4SolidEnvelope.cc
     G4SolidStore.cc
     G4VCurvedTrajectoryFilter.cc
     G4VNestedParameterisation.cc
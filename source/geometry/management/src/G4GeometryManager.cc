@@ -44,8 +44,12 @@
 // Needed for building optimisations
 //
 #include "G4LogicalVolumeStore.hh"
+#include "G4PhysicalVolumeStore.hh"
 #include "G4VPhysicalVolume.hh"
 #include "G4SmartVoxelHeader.hh"
+#include "G4SafetyGrid.hh"
+#include "G4SolidEnvelope.hh"
+#include "G4Region.hh"
 #include "voxeldefs.hh"
 
 // Needed for setting the extent for tolerance value
@@ -180,7 +184,8 @@ void G4GeometryManager::BuildOptimisations(G4bool allOpts, G4bool verbose)
             && (volume->GetNoDaughters()>=kMinVoxelVolumesLevel1&&allOpts) )
           || ( (volume->GetNoDaughters()==1)
             && (volume->GetDaughter(0)->IsReplicated()==true)
-            && (volume->GetDaughter(0)->GetRegularStructureId()!=1) ) ) 
+            && (volume->GetDaughter(0)->GetRegularStructureId()!=1)
+            && (volume->GetDaughter(0)->GetRegularStructureId()!=2) ) ) 
      {
 #ifdef G4GEOMETRY_VOXELDEBUG
        G4cout << "**** G4GeometryManager::BuildOptimisations" << G4endl
@@ -218,6 +223,19 @@ void G4GeometryManager::BuildOptimisations(G4bool allOpts, G4bool verbose)
               << G4endl;
 #endif
      }
+
+     // Grids of safety lower bounds, for the regions requesting them
+     //
+     if (allOpts)  { BuildSafetyGrid(volume, verbose); }
+
+     // Envelopes of solids, for the fast geometry regions
+     //
+     BuildSolidEnvelope(volume);
+
+     // Solids composed of other solids may build their own
+     // acceleration structures for navigation
+     //
+     volume->GetSolid()->BuildOptimisation(verbose);
   }
   if (verbose)
   {
@@ -248,7 +266,8 @@ void G4GeometryManager::BuildOptimisations(G4bool allOpts,
    if (    ( (tVolume->IsToOptimise())
           && (tVolume->GetNoDaughters()>=kMinVoxelVolumesLevel1&&allOpts) )
         || ( (tVolume->GetNoDaughters()==1)
-          && (tVolume->GetDaughter(0)->IsReplicated()==true) ) ) 
+          && (tVolume->GetDaughter(0)->IsReplicated()==true)
+          && (tVolume->GetDaughter(0)->GetRegularStructureId()!=2) ) ) 
    {
      head = new G4SmartVoxelHeader(tVolume);
      if (head != nullptr)
@@ -274,6 +293,15 @@ void G4GeometryManager::BuildOptimisations(G4bool allOpts,
             << G4endl;
 #endif
    }
+   if (allOpts)  { BuildSafetyGrid(tVolume); }
+   BuildSolidEnvelope(tVolume);
+   tVolume->GetSolid()->BuildOptimisation(false);
+   for (size_t i=0; i<tVolume->GetNoDaughters(); ++i)
+   {
+     G4LogicalVolume* dVolume = tVolume->GetDaughter(i)->GetLogicalVolume();
+     BuildSolidEnvelope(dVolume);
+     dVolume->GetSolid()->BuildOptimisation(false);
+   }
 
    // Scan recursively the associated logical volume tree
    //
@@ -298,6 +326,9 @@ void G4GeometryManager::DeleteOptimisations()
     tVolume=(*Store)[n];
     delete tVolume->GetVoxelHeader();
     tVolume->SetVoxelHeader(nullptr);
+    DeleteSafetyGrid(tVolume);
+    DeleteSolidEnvelope(tVolume);
+    tVolume->GetSolid()->DeleteOptimisation();
   }
 }
 
@@ -317,6 +348,15 @@ void G4GeometryManager::DeleteOptimisations(G4VPhysicalVolume* pVolume)
   if (tVolume == nullptr) { return DeleteOptimisations(); }
   delete tVolume->GetVoxelHeader();
   tVolume->SetVoxelHeader(nullptr);
+  DeleteSafetyGrid(tVolume);
+  DeleteSolidEnvelope(tVolume);
+  tVolume->GetSolid()->DeleteOptimisation();
+  for (size_t i=0; i<tVolume->GetNoDaughters(); ++i)
+  {
+    G4LogicalVolume* dVolume = tVolume->GetDaughter(i)->GetLogicalVolume();
+    DeleteSolidEnvelope(dVolume);
+    dVolume->GetSolid()->DeleteOptimisation();
+  }
 
   // Scan recursively the associated logical volume tree
   //
@@ -327,6 +367,84 @@ void G4GeometryManager::DeleteOptimisations(G4VPhysicalVolume* pVolume)
   }
 }
 
+// ***************************************************************************
+// Builds the grid of safety lower bounds for a logical volume, if its
+// region requests it and the volume holds at least two placed daughters.
+// The cells hold the mother DistanceToOut() at the dimensions of closing
+// time, so no grid is built for volumes placed by a parameterised or
+// replicated volume, whose solid may change.
+// ***************************************************************************
+//
+void G4GeometryManager::BuildSafetyGrid(G4LogicalVolume* volume,
+                                        G4bool verbose)
+{
+  DeleteSafetyGrid(volume);
+
+  G4Region* region = volume->GetRegion();
+  if ((region == nullptr) || (region->GetSafetyGridCells() <= 0))  { return; }
+  if (volume->GetNoDaughters() < kMinVoxelVolumesLevel1)  { return; }
+  for (size_t i=0; i<volume->GetNoDaughters(); ++i)
+  {
+    if (volume->GetDaughter(i)->IsReplicated())  { return; }
+  }
+  for (auto pVolume : *G4PhysicalVolumeStore::GetInstance())
+  {
+    if (pVolume->IsReplicated() && (pVolume->GetLogicalVolume() == volume))
+    {
+      return;
+    }
+  }
+
+  G4SafetyGrid* grid = new G4SafetyGrid(volume, region->GetSafetyGridCells());
+  volume->SetSafetyGrid(grid);
+  if (verbose)
+  {
+    G4cout << "     Safety grid for volume " << volume->GetName()
+           << ": " << grid->GetNumberOfCells() << " cells, "
+           << grid->GetMemoryUse()/1024 << " kB, "
+           << std::setprecision(3) << 100.*grid->GetFilledFraction()
+           << " % non-zero" << G4endl;
+  }
+}
+
+// ***************************************************************************
+// Removes the grid of safety lower bounds of a logical volume.
+// ***************************************************************************
+//
+void G4GeometryManager::DeleteSafetyGrid(G4LogicalVolume* volume)
+{
+  delete volume->GetSafetyGrid();
+  volume->SetSafetyGrid(nullptr);
+}
+
+// ***************************************************************************
+// Builds the envelope of the solid of a logical volume, if its region
+// is in fast geometry mode.
+// ***************************************************************************
+//
+void G4GeometryManager::BuildSolidEnvelope(G4LogicalVolume* volume)
+{
+  DeleteSolidEnvelope(volume);
+
+  G4Region* region = volume->GetRegion();
+  if ((region == nullptr) || (region->GetFastGeometryDistance() <= 0.))
+  {
+    return;
+  }
+  volume->SetSolidEnvelope(new G4SolidEnvelope(volume->GetSolid(),
+                                      region->GetFastGeometryDistance()));
+}
+
+// ***************************************************************************
+// Removes the envelope of the solid of a logical volume.
+// ***************************************************************************
+//
+void G4GeometryManager::DeleteSolidEnvelope(G4LogicalVolume* volume)
+{
+  delete volume->GetSolidEnvelope();
+  volume->SetSolidEnvelope(nullptr);
+}
+
 // ***************************************************************************
 // Sets the maximum extent of the world volume. The operation is allowed only
 // if NO solids have been created already.
@@ -91,7 +91,7 @@ G4LogicalVolume::G4LogicalVolume( G4VSolid* pSolid,
 
   SetSolid(pSolid);
   SetMaterial(pMaterial);
-  SetName(name);
+  fName = name;  // Not yet in the store, no need to invalidate its map
   SetSensitiveDetector(pSDetector);
   SetUserLimits(pULimits);    
 
@@ -111,7 +111,7 @@ void G4LogicalVolumeStore::Clean()
     { G4cout << i-1 << " volumes deleted !" << G4endl; }
 #endif
 
-  store->bmap.clear(); store->mvalid = false;
+  store->bmap.clear(); store->mvalid = true; store->nmapped = 0;
   locked = false;
   store->clear();
 }
@@ -127,15 +127,22 @@ void G4LogicalVolumeStore::SetNotifier(G4VStoreNotifier* pNotifier)
 }
 
 // ***************************************************************************
-// Bring contents of internal map up to date and reset validity flag
+// Bring contents of internal map up to date and reset validity flag.
+// Only the volumes appended since the last update are added, unless
+// the map was invalidated
 // ***************************************************************************
 //
 void G4LogicalVolumeStore::UpdateMap()
 {
   G4AutoLock l(&mapMutex);  // to avoid thread contention at initialisation
-  if (mvalid) return;
-  bmap.clear();
-  for(auto pos=GetInstance()->cbegin(); pos!=GetInstance()->cend(); ++pos)
+  if (IsMapValid()) return;
+  if (!mvalid)
+  {
+    bmap.clear();
+    bmap.reserve(size());
+    nmapped = 0;
+  }
+  for(auto pos=cbegin()+nmapped; pos!=cend(); ++pos)
   {
     const G4String& vol_name = (*pos)->GetName();
     auto it = bmap.find(vol_name);
@@ -149,6 +156,7 @@ void G4LogicalVolumeStore::UpdateMap()
       bmap.insert(std::make_pair(vol_name, vol_vec));
     }
   }
+  nmapped = size();
   mvalid = true;
   l.unlock();
 }
@@ -161,19 +169,46 @@ void G4LogicalVolumeStore::Register(G4LogicalVolume* pVolume)
 {
   G4LogicalVolumeStore* store = GetInstance();
   store->push_back(pVolume);
-  const G4String& vol_name = pVolume->GetName();
-  auto it = store->bmap.find(vol_name);
-  if (it != store->bmap.cend())
+  if (store->nbulk > 0)  { return; }  // Map and notification deferred
+  if (store->mvalid && (store->nmapped+1 == store->size()))
   {
-    it->second.push_back(pVolume);
-  }
-  else
-  {
-    std::vector<G4LogicalVolume*> vol_vec { pVolume };
-    store->bmap.insert(std::make_pair(vol_name, vol_vec));
+    const G4String& vol_name = pVolume->GetName();
+    auto it = store->bmap.find(vol_name);
+    if (it != store->bmap.cend())
+    {
+      it->second.push_back(pVolume);
+    }
+    else
+    {
+      std::vector<G4LogicalVolume*> vol_vec { pVolume };
+      store->bmap.insert(std::make_pair(vol_name, vol_vec));
+    }
+    store->nmapped = store->size();
   }
   if (fgNotifier) { fgNotifier->NotifyRegistration(); }
-  store->mvalid = true;
+}
+
+// ***************************************************************************
+// Start a bulk registration of volumes
+// ***************************************************************************
+//
+void G4LogicalVolumeStore::BeginBulkRegistration(std::size_t nvolumes)
+{
+  G4LogicalVolumeStore* store = GetInstance();
+  store->reserve(store->size()+nvolumes);
+  store->bmap.reserve(store->size()+nvolumes);
+  ++store->nbulk;
+}
+
+// ***************************************************************************
+// End a bulk registration of volumes, updating the map at outermost level
+// ***************************************************************************
+//
+void G4LogicalVolumeStore::EndBulkRegistration()
+{
+  G4LogicalVolumeStore* store = GetInstance();
+  if (store->nbulk > 0)  { --store->nbulk; }
+  if (store->nbulk == 0)  { store->UpdateMap(); }
 }
 
 // ***************************************************************************
@@ -186,14 +221,18 @@ void G4LogicalVolumeStore::DeRegister(G4LogicalVolume* pVolume)
   if (!locked)    // Do not de-register if locked !
   {
     if (fgNotifier != nullptr) { fgNotifier->NotifyDeRegistration(); }
+    G4bool mapped = false;
     for (auto i=store->cbegin(); i!=store->cend(); ++i)
     {
       if (**i==*pVolume)
       {
+        mapped = (std::size_t(i-store->cbegin()) < store->nmapped);
         store->erase(i);
         break;
       }
     }
+    if (!mapped)  { return; }  // Not yet in the map
+    --store->nmapped;
     const G4String& vol_name = pVolume->GetName();
     auto it = store->bmap.find(vol_name);
     if (it != store->bmap.cend())
@@ -226,7 +265,7 @@ G4LogicalVolumeStore::GetVolume(const G4String& name, G4bool verbose,
                                 G4bool reverseSearch) const
 {
   G4LogicalVolumeStore* store = GetInstance();
-  if (!store->mvalid)  { store->UpdateMap(); }
+  if (!store->IsMapValid())  { store->UpdateMap(); }
   auto pos = store->bmap.find(name);
   if(pos != store->bmap.cend())
   {
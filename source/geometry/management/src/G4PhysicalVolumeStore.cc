@@ -112,7 +112,7 @@ void G4PhysicalVolumeStore::Clean()
     { G4cout << i-1 << " volumes deleted !" << G4endl; }
 #endif
 
-  store->bmap.clear(); store->mvalid = false;
+  store->bmap.clear(); store->mvalid = true; store->nmapped = 0;
   locked = false;
   store->clear();
 }
@@ -128,15 +128,22 @@ void G4PhysicalVolumeStore::SetNotifier(G4VStoreNotifier* pNotifier)
 }
 
 // ***************************************************************************
-// Bring contents of internal map up to date and reset validity flag
+// Bring contents of internal map up to date and reset validity flag.
+// Only the volumes appended since the last update are added, unless
+// the map was invalidated
 // ***************************************************************************
 //
 void G4PhysicalVolumeStore::UpdateMap()
 {
   G4AutoLock l(&mapMutex);  // to avoid thread contention at initialisation
-  if (mvalid) return;
-  bmap.clear();
-  for(auto pos=GetInstance()->cbegin(); pos!=GetInstance()->cend(); ++pos)
+  if (IsMapValid()) return;
+  if (!mvalid)
+  {
+    bmap.clear();
+    bmap.reserve(size());
+    nmapped = 0;
+  }
+  for(auto pos=cbegin()+nmapped; pos!=cend(); ++pos)
   {
     const G4String& vol_name = (*pos)->GetName();
     auto it = bmap.find(vol_name);
@@ -150,6 +157,7 @@ void G4PhysicalVolumeStore::UpdateMap()
       bmap.insert(std::make_pair(vol_name, vol_vec));
     }
   }
+  nmapped = size();
   mvalid = true;
   l.unlock();
 }
@@ -162,19 +170,46 @@ void G4PhysicalVolumeStore::Register(G4VPhysicalVolume* pVolume)
 {
   G4PhysicalVolumeStore* store = GetInstance();
   store->push_back(pVolume);
-  const G4String& vol_name = pVolume->GetName();
-  auto it = store->bmap.find(vol_name);
-  if (it != store->bmap.cend())
+  if (store->nbulk > 0)  { return; }  // Map and notification deferred
+  if (store->mvalid && (store->nmapped+1 == store->size()))
   {
-    it->second.push_back(pVolume);
-  }
-  else
-  {
-    std::vector<G4VPhysicalVolume*> vol_vec { pVolume };
-    store->bmap.insert(std::make_pair(vol_name, vol_vec));
+    const G4String& vol_name = pVolume->GetName();
+    auto it = store->bmap.find(vol_name);
+    if (it != store->bmap.cend())
+    {
+      it->second.push_back(pVolume);
+    }
+    else
+    {
+      std::vector<G4VPhysicalVolume*> vol_vec { pVolume };
+      store->bmap.insert(std::make_pair(vol_name, vol_vec));
+    }
+    store->nmapped = store->size();
   }
   if (fgNotifier) { fgNotifier->NotifyRegistration(); }
-  store->mvalid = true;
+}
+
+// ***************************************************************************
+// Start a bulk registration of volumes
+// ***************************************************************************
+//
+void G4PhysicalVolumeStore::BeginBulkRegistration(std::size_t nvolumes)
+{
+  G4PhysicalVolumeStore* store = GetInstance();
+  store->reserve(store->size()+nvolumes);
+  store->bmap.reserve(store->size()+nvolumes);
+  ++store->nbulk;
+}
+
+// ***************************************************************************
+// End a bulk registration of volumes, updating the map at outermost level
+// ***************************************************************************
+//
+void G4PhysicalVolumeStore::EndBulkRegistration()
+{
+  G4PhysicalVolumeStore* store = GetInstance();
+  if (store->nbulk > 0)  { --store->nbulk; }
+  if (store->nbulk == 0)  { store->UpdateMap(); }
 }
 
 // ***************************************************************************
@@ -190,14 +225,18 @@ void G4PhysicalVolumeStore::DeRegister(G4VPhysicalVolume* pVolume)
     if (fgNotifier != nullptr) { fgNotifier->NotifyDeRegistration(); }
     G4LogicalVolume* motherLogical = pVolume->GetMotherLogical();
     if (motherLogical != nullptr) { motherLogical->RemoveDaughter(pVolume); }
+    G4bool mapped = false;
     for (auto i=store->cbegin(); i!=store->cend(); ++i)
     {
       if (**i==*pVolume)
       {
+        mapped = (std::size_t(i-store->cbegin()) < store->nmapped);
         store->erase(i);
         break;
       }
     }
+    if (!mapped)  { return; }  // Not yet in the map
+    --store->nmapped;
     const G4String& vol_name = pVolume->GetName();
     auto it = store->bmap.find(vol_name);
     if (it != store->bmap.cend())
@@ -230,7 +269,7 @@ G4PhysicalVolumeStore::GetVolume(const G4String& name, G4bool verbose,
                                  G4bool reverseSearch) const
 {
   G4PhysicalVolumeStore* store = GetInstance();
-  if (!store->mvalid)  { store->UpdateMap(); }
+  if (!store->IsMapValid())  { store->UpdateMap(); }
   auto pos = store->bmap.find(name);
   if(pos != store->bmap.cend())
   {
@@ -0,0 +1,157 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4SafetyGrid implementation
+//
+// 19.10.2026 - First implementation
+// --------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "G4SafetyGrid.hh"
+#include "G4LogicalVolume.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VSolid.hh"
+#include "G4AffineTransform.hh"
+#include "G4GeometryTolerance.hh"
+
+// ********************************************************************
+// Constructor
+//
+// The number of cells along each axis is proportional to the extent
+// of the volume, for cells as close as possible to cubes
+// ********************************************************************
+//
+G4SafetyGrid::G4SafetyGrid(G4LogicalVolume* pVolume, G4int maxCells)
+{
+  G4VSolid* motherSolid = pVolume->GetSolid();
+  motherSolid->BoundingLimits(fMin, fMax);
+
+  G4ThreeVector extent = fMax - fMin;
+  G4double volume = extent.x()*extent.y()*extent.z();
+  G4int ncells = std::max(maxCells, 1);
+  G4double width = extent.x();
+  if (volume > 0.) { width = std::cbrt(volume/ncells); }
+  if (width <= 0.) { width = 1.; }
+  for (;;)
+  {
+    fNx = std::max(G4int(std::ceil(extent.x()/width)), 1);
+    fNy = std::max(G4int(std::ceil(extent.y()/width)), 1);
+    fNz = std::max(G4int(std::ceil(extent.z()/width)), 1);
+    if (G4double(fNx)*fNy*fNz <= ncells) { break; }
+    width *= 1.05;
+  }
+  G4double wx = extent.x()/fNx, wy = extent.y()/fNy, wz = extent.z()/fNz;
+  fInvWidthX = (wx > 0.) ? 1./wx : 0.;
+  fInvWidthY = (wy > 0.) ? 1./wy : 0.;
+  fInvWidthZ = (wz > 0.) ? 1./wz : 0.;
+  G4double halfDiagonal = 0.5*std::sqrt(wx*wx + wy*wy + wz*wz)
+                        + G4GeometryTolerance::GetInstance()
+                          ->GetSurfaceTolerance();
+
+  // Extent of the daughters in the frame of the mother,
+  // used for skipping daughters farther than the current minimum
+  //
+  std::size_t ndaughters = pVolume->GetNoDaughters();
+  std::vector<G4VSolid*> solids(ndaughters);
+  std::vector<G4AffineTransform> transforms(ndaughters);
+  std::vector<G4ThreeVector> pmin(ndaughters), pmax(ndaughters);
+  for (std::size_t i = 0; i < ndaughters; ++i)
+  {
+    G4VPhysicalVolume* daughter = pVolume->GetDaughter(i);
+    solids[i] = daughter->GetLogicalVolume()->GetSolid();
+    G4AffineTransform tf(daughter->GetRotation(), daughter->GetTranslation());
+    G4ThreeVector bmin, bmax;
+    solids[i]->BoundingLimits(bmin, bmax);
+    G4ThreeVector lo(kInfinity, kInfinity, kInfinity), hi = -lo;
+    for (G4int k = 0; k < 8; ++k)
+    {
+      G4ThreeVector corner((k & 1) ? bmax.x() : bmin.x(),
+                           (k & 2) ? bmax.y() : bmin.y(),
+                           (k & 4) ? bmax.z() : bmin.z());
+      G4ThreeVector p = tf.TransformPoint(corner);
+      lo.set(std::min(lo.x(), p.x()), std::min(lo.y(), p.y()),
+             std::min(lo.z(), p.z()));
+      hi.set(std::max(hi.x(), p.x()), std::max(hi.y(), p.y()),
+             std::max(hi.z(), p.z()));
+    }
+    pmin[i] = lo;
+    pmax[i] = hi;
+    transforms[i] = tf.Inverse();
+  }
+
+  // Lower bound at each cell centre, less the half-diagonal of the cell
+  //
+  fSafety.assign(std::size_t(fNx)*fNy*fNz, 0.);
+  for (G4int iz = 0; iz < fNz; ++iz)
+  {
+    for (G4int iy = 0; iy < fNy; ++iy)
+    {
+      for (G4int ix = 0; ix < fNx; ++ix)
+      {
+        G4ThreeVector centre(fMin.x() + (ix + 0.5)*wx,
+                             fMin.y() + (iy + 0.5)*wy,
+                             fMin.z() + (iz + 0.5)*wz);
+        if (motherSolid->Inside(centre) != kInside) continue;
+
+        G4double safety = motherSolid->DistanceToOut(centre);
+        for (std::size_t i = 0; i < ndaughters && safety > halfDiagonal; ++i)
+        {
+          G4double dx = std::max(pmin[i].x() - centre.x(),
+                                 centre.x() - pmax[i].x());
+          G4double dy = std::max(pmin[i].y() - centre.y(),
+                                 centre.y() - pmax[i].y());
+          G4double dz = std::max(pmin[i].z() - centre.z(),
+                                 centre.z() - pmax[i].z());
+          G4double distSq = 0.;
+          if (dx > 0.) { distSq += dx*dx; }
+          if (dy > 0.) { distSq += dy*dy; }
+          if (dz > 0.) { distSq += dz*dz; }
+          if (distSq >= safety*safety) continue;
+          G4ThreeVector local = transforms[i].TransformPoint(centre);
+          safety = std::min(safety, solids[i]->DistanceToIn(local));
+        }
+        if (safety > halfDiagonal)
+        {
+          fSafety[(iz*fNy + iy)*fNx + ix] = safety - halfDiagonal;
+        }
+      }
+    }
+  }
+}
+
+// ********************************************************************
+// GetFilledFraction
+// ********************************************************************
+//
+G4double G4SafetyGrid::GetFilledFraction() const
+{
+  if (fSafety.empty()) { return 0.; }
+  auto nfilled = std::count_if(fSafety.cbegin(), fSafety.cend(),
+                               [](G4double val) { return val > 0.; });
+  return G4double(nfilled)/G4double(fSafety.size());
+}
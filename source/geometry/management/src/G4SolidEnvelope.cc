@@ -0,0 +1,166 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4SolidEnvelope implementation
+//
+// 19.10.2026 - First implementation
+// --------------------------------------------------------------------
+
+#include "G4SolidEnvelope.hh"
+#include "G4AffineTransform.hh"
+#include "G4VoxelLimits.hh"
+#include "G4GeometryTolerance.hh"
+
+namespace
+{
+  const G4double kCos45 = 0.70710678118654752440;
+
+  // Coordinates along X and Y in the frame rotated by 45 degrees
+  // around the Z axis
+  //
+  inline G4double RotatedX(G4double x, G4double y)
+  {
+    return kCos45*(x + y);
+  }
+  inline G4double RotatedY(G4double x, G4double y)
+  {
+    return kCos45*(y - x);
+  }
+
+  // Updates the parametric interval [tmin,tmax] of the track inside
+  // the slab [lo,hi] along one axis; returns false if it is empty
+  //
+  inline G4bool ClipSlab(G4double p, G4double v, G4double lo, G4double hi,
+                         G4double& tmin, G4double& tmax)
+  {
+    if (v == 0.)
+    {
+      return (p >= lo) && (p <= hi);
+    }
+    G4double invV = 1./v;
+    G4double t1 = (lo - p)*invV;
+    G4double t2 = (hi - p)*invV;
+    if (t1 > t2)  { G4double t = t1; t1 = t2; t2 = t; }
+    if (t1 > tmin)  { tmin = t1; }
+    if (t2 < tmax)  { tmax = t2; }
+    return tmin <= tmax;
+  }
+
+  // Adds the squared distance from the slab [lo,hi] along one axis
+  //
+  inline G4double SlabDistance2(G4double p, G4double lo, G4double hi)
+  {
+    G4double d = 0.;
+    if (p < lo)       { d = lo - p; }
+    else if (p > hi)  { d = p - hi; }
+    return d*d;
+  }
+}
+
+// ********************************************************************
+// Constructor
+//
+// The extent in the rotated frame is obtained from CalculateExtent()
+// with the transformation of the solid into that frame; if it is not
+// available, only the bounding box is used
+// ********************************************************************
+//
+G4SolidEnvelope::G4SolidEnvelope(const G4VSolid* pSolid,
+                                 G4double refineDistance)
+  : fRefineDistance(refineDistance)
+{
+  G4double tol = G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+  G4ThreeVector delta(tol, tol, tol);
+  pSolid->BoundingLimits(fMin, fMax);
+  fMin -= delta;
+  fMax += delta;
+
+  G4RotationMatrix rotation;
+  rotation.rotateZ(45.*CLHEP::deg);
+  G4AffineTransform transform(&rotation, G4ThreeVector());
+  G4VoxelLimits limits;
+  G4double emin = 0., emax = 0.;
+  fRotated = pSolid->CalculateExtent(kXAxis, limits, transform, emin, emax);
+  fRotMin[0] = emin - tol;
+  fRotMax[0] = emax + tol;
+  if (fRotated)
+  {
+    fRotated = pSolid->CalculateExtent(kYAxis, limits, transform, emin, emax);
+    fRotMin[1] = emin - tol;
+    fRotMax[1] = emax + tol;
+  }
+}
+
+// ********************************************************************
+// Distance
+//
+// The distance to the intersection of the two boxes is bounded from
+// below by the largest of the distances to each box
+// ********************************************************************
+//
+G4double G4SolidEnvelope::Distance(const G4ThreeVector& p) const
+{
+  G4double distZ2 = SlabDistance2(p.z(), fMin.z(), fMax.z());
+  G4double dist2 = SlabDistance2(p.x(), fMin.x(), fMax.x())
+                 + SlabDistance2(p.y(), fMin.y(), fMax.y()) + distZ2;
+  if (fRotated)
+  {
+    G4double u = RotatedX(p.x(), p.y());
+    G4double w = RotatedY(p.x(), p.y());
+    G4double distRot2 = SlabDistance2(u, fRotMin[0], fRotMax[0])
+                      + SlabDistance2(w, fRotMin[1], fRotMax[1]) + distZ2;
+    if (distRot2 > dist2)  { dist2 = distRot2; }
+  }
+  return (dist2 > 0.) ? std::sqrt(dist2) : 0.;
+}
+
+// ********************************************************************
+// DistanceAlong
+// ********************************************************************
+//
+G4double G4SolidEnvelope::DistanceAlong(const G4ThreeVector& p,
+                                        const G4ThreeVector& v) const
+{
+  G4double tmin = 0., tmax = kInfinity;
+  if (!ClipSlab(p.x(), v.x(), fMin.x(), fMax.x(), tmin, tmax)
+   || !ClipSlab(p.y(), v.y(), fMin.y(), fMax.y(), tmin, tmax)
+   || !ClipSlab(p.z(), v.z(), fMin.z(), fMax.z(), tmin, tmax))
+  {
+    return kInfinity;
+  }
+  if (fRotated)
+  {
+    if (!ClipSlab(RotatedX(p.x(), p.y()), RotatedX(v.x(), v.y()),
+                  fRotMin[0], fRotMax[0], tmin, tmax)
+     || !ClipSlab(RotatedY(p.x(), p.y()), RotatedY(v.x(), v.y()),
+                  fRotMin[1], fRotMax[1], tmin, tmax))
+    {
+      return kInfinity;
+    }
+  }
+  return tmin;
+}
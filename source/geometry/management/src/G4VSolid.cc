@@ -122,6 +122,36 @@ G4VSolid& G4VSolid::operator = (const G4VSolid& rhs)
 
 
 
+//////////////////////////////////////////////////////////////////////////
+//
+// Multi-point versions of the navigation methods, looping over the
+// scalar methods
+
+void G4VSolid::InsideBatch(G4int n, const G4ThreeVector* p,
+                           EInside* inside) const
+{
+  for (G4int i = 0; i < n; ++i) { inside[i] = Inside(p[i]); }
+}
+
+void G4VSolid::DistanceToInBatch(G4int n, const G4ThreeVector* p,
+                                 const G4ThreeVector* v,
+                                 G4double* dist) const
+{
+  for (G4int i = 0; i < n; ++i) { dist[i] = DistanceToIn(p[i], v[i]); }
+}
+
+void G4VSolid::SafetyToInBatch(G4int n, const G4ThreeVector* p,
+                               G4double* safety) const
+{
+  for (G4int i = 0; i < n; ++i) { safety[i] = DistanceToIn(p[i]); }
+}
+
+void G4VSolid::SafetyToOutBatch(G4int n, const G4ThreeVector* p,
+                                G4double* safety) const
+{
+  for (G4int i = 0; i < n; ++i) { safety[i] = DistanceToOut(p[i]); }
+}
+
 //////////////////////////////////////////////////////////////////////////
 //
 // Set solid name and notify store of the change
@@ -708,3 +738,11 @@ G4Polyhedron* G4VSolid::GetPolyhedron () const
 {
   return nullptr;
 }
+
+void G4VSolid::BuildOptimisation(G4bool)
+{
+}
+
+void G4VSolid::DeleteOptimisation()
+{
+}
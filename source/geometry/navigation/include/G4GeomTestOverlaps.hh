@@ -0,0 +1,174 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// class G4GeomTestOverlaps
+//
+// Class description:
+//
+// Checks for overlaps in the whole volume tree of a world volume,
+// distributing the checks over the tasks of the thread pool when one
+// is available. Each unique logical volume is visited once; points are
+// sampled on the surface of every daughter and tested against the mother
+// and against those sisters only whose bounding box, in the mother frame,
+// intersects the extent of the sampled points. Candidate sisters are
+// found through a bounding volume hierarchy built per mother volume.
+// Results can be written to a report file, one JSON record per line,
+// and completed mother volumes can be recorded to a resume file, such
+// that an interrupted check can be restarted from where it stopped.
+// Each task reseeds the random engine of its thread with seeds drawn
+// from the engine of the calling thread.
+//
+// All geometry data (solids and placements) is gathered in the calling
+// thread before the checks start; the tasks only query the solids.
+// Replicated and parameterised daughters are checked sequentially
+// afterwards, through their own CheckOverlaps() method.
+
+// 19.10.2026 - First implementation
+// --------------------------------------------------------------------
+#ifndef G4GeomTestOverlaps_hh
+#define G4GeomTestOverlaps_hh
+
+#include <fstream>
+#include <set>
+#include <vector>
+
+#include "G4String.hh"
+#include "G4ThreeVector.hh"
+#include "G4AffineTransform.hh"
+#include "G4AutoLock.hh"
+
+class G4VPhysicalVolume;
+class G4LogicalVolume;
+class G4VSolid;
+
+class G4GeomTestOverlaps
+{
+  public:  // with description
+
+    G4GeomTestOverlaps( G4VPhysicalVolume* theWorld,
+                        G4double theTolerance = 0.0,    // mm
+                        G4int numberOfPoints = 10000,
+                        G4bool theVerbosity = true );
+    ~G4GeomTestOverlaps();
+      // Constructor and destructor
+
+    inline G4double GetTolerance() const;
+    inline void SetTolerance(G4double tol);
+      // Get/Set error tolerance (default set to 0*mm)
+    inline G4int GetResolution() const;
+    inline void SetResolution(G4int points);
+      // Get/Set number of points to check (default set to 10000)
+    inline G4bool GetVerbosity() const;
+    inline void SetVerbosity(G4bool verbose);
+      // Get/Set verbosity mode (default set to true)
+    inline G4int GetErrorsThreshold() const;
+    inline void SetErrorsThreshold(G4int max);
+      // Get/Set maximum number of errors to report per volume (default 1)
+    inline const G4String& GetReportFile() const;
+    inline void SetReportFile(const G4String& name);
+      // Get/Set the name of the report file (default none)
+    inline const G4String& GetResumeFile() const;
+    inline void SetResumeFile(const G4String& name);
+      // Get/Set the name of the file recording the completed volumes.
+      // Mother volumes listed there are skipped (default none)
+
+    G4int TestOverlaps();
+      // Run the check on the whole tree; returns the number of overlaps
+
+  private:
+
+    enum EOverlapType { kSampling, kMother, kSister, kEncapsulation,
+                        kRepeated };
+
+    struct Overlap
+    {
+      EOverlapType type;
+      G4int daughter;              // Index of the daughter in its mother
+      G4int other;                 // Index of the sister, -1 if none
+      G4ThreeVector point;         // Point in the mother or sister frame
+      G4double size;               // Maximum overlap (protrusion) size
+      G4int count;                 // Number of points overlapping
+    };
+
+    struct Node
+    {
+      G4ThreeVector pmin, pmax;    // Extent of the node
+      G4int left, right;           // Children, -1 for a leaf
+      G4int first, count;          // Range in the ordered daughters
+    };
+
+    struct Mother
+    {
+      G4LogicalVolume* logical = nullptr;
+      std::size_t storeIndex = 0;             // Index in the volume store
+      G4VSolid* solid = nullptr;
+      std::vector<G4VPhysicalVolume*> physical;
+      std::vector<G4VSolid*> solids;
+      std::vector<G4AffineTransform> transform;
+      std::vector<G4ThreeVector> pmin, pmax;  // Daughters extent in mother
+      std::vector<G4int> order;               // Daughters order in nodes
+      std::vector<Node> nodes;                // Bounding volume hierarchy
+      std::vector<G4int> repeated;            // Replicas/parameterisations
+    };
+
+    void CollectMothers();
+    void BuildIndex(Mother& mother) const;
+    G4int BuildNode(Mother& mother, G4int first, G4int count) const;
+    void FindCandidates(const Mother& mother,
+                        const G4ThreeVector& pmin, const G4ThreeVector& pmax,
+                        std::vector<G4int>& candidates) const;
+      // Gathering of the volumes and bounding volume hierarchy
+
+    void CheckDaughter(const Mother& mother, G4int idaughter,
+                       std::vector<Overlap>& result) const;
+      // Overlaps check of a single daughter, thread-safe
+
+    void ReadResumeFile();
+    void FlushMother(std::size_t imother, std::vector<Overlap>& result);
+    void ReportOverlap(const Mother& mother, const Overlap& overlap) const;
+    void WriteRecord(const Mother& mother, const Overlap& overlap);
+      // Book-keeping and reporting
+
+  private:
+
+    G4VPhysicalVolume* world = nullptr;  // Top of the tree to check
+    G4double tolerance;                  // Error tolerance
+    G4int resolution;                    // Number of points to test
+    G4int maxErr = 1;                    // Maximum number of errors
+    G4bool verbosity;                    // Verbosity for overlaps check
+    G4String reportFile = "";            // Name of the report file
+    G4String resumeFile = "";            // Name of the resume file
+
+    std::vector<Mother> mothers;
+    std::set<G4String> completed;
+    std::ofstream report, resume;
+    G4Mutex fileMutex = G4MUTEX_INITIALIZER;
+};
+
+#include "G4GeomTestOverlaps.icc"
+
+#endif
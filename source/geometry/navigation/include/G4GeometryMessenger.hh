@@ -45,6 +45,7 @@ class G4UIdirectory;
 class G4UIcommand;
 class G4UIcmdWithoutParameter;
 class G4UIcmdWithABool;
+class G4UIcmdWithAString;
 class G4UIcmdWithAnInteger;
 class G4UIcmdWithADoubleAndUnit;
 class G4TransportationManager;
@@ -69,16 +70,23 @@ class G4GeometryMessenger : public G4UImessenger
     void SetVerbosity(G4String newValue);
     void SetCheckMode(G4String newValue);
     void SetPushFlag(G4String newValue);
+    void SetSafetyGrid(G4String newValue);
+    void SetFastGeometry(G4String newValue);
     void RecursiveOverlapTest();
+    void ParallelOverlapTest();
 
     G4UIdirectory             *geodir, *navdir, *testdir;
-    G4UIcmdWithABool          *chkCmd, *pchkCmd, *verCmd;
-    G4UIcmdWithoutParameter   *recCmd, *resCmd;
+    G4UIcommand               *sgrCmd, *fgeCmd;
+    G4UIcmdWithABool          *chkCmd, *pchkCmd, *verCmd, *fusCmd;
+    G4UIcmdWithoutParameter   *recCmd, *resCmd, *prunCmd, *sfsCmd;
+    G4UIcmdWithAString        *repCmd, *rsmCmd;
     G4UIcmdWithADoubleAndUnit *tolCmd;
-    G4UIcmdWithAnInteger      *verbCmd, *rslCmd, *rcsCmd, *rcdCmd, *errCmd;
+    G4UIcmdWithAnInteger      *verbCmd, *rslCmd, *rcsCmd, *rcdCmd, *errCmd,
+                              *sfcCmd;
 
     G4double tol = 0.0;
     G4int recLevel = 0, recDepth = -1;
+    G4String reportFile = "", resumeFile = "";
 
     G4TransportationManager* tmanager;
     G4GeomTestVolume* tvolume = nullptr;
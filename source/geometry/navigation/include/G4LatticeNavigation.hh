@@ -0,0 +1,121 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// class G4LatticeNavigation
+//
+// Class description:
+//
+// Utility for navigation in volumes containing a lattice of identical
+// cells, defined by a G4LatticeParameterisation (regular structure id 2).
+// The cells containing a point are computed from the lattice pitch, and
+// steps are computed visiting only the cells crossed by the direction, in
+// order, until the nearest intersection is found. No voxelisation of the
+// mother volume is used.
+
+// 19.10.2026 - First implementation
+// --------------------------------------------------------------------
+#ifndef G4LATTICENAVIGATION_HH
+#define G4LATTICENAVIGATION_HH
+
+#include "G4Types.hh"
+#include "G4ThreeVector.hh"
+#include "G4NavigationHistory.hh"
+
+class G4VPhysicalVolume;
+class G4VSolid;
+class G4LatticeParameterisation;
+
+class G4LatticeNavigation
+{
+  public:  // with description
+
+    G4LatticeNavigation();
+   ~G4LatticeNavigation();
+
+    G4bool LevelLocate( G4NavigationHistory& history,
+                  const G4VPhysicalVolume* blockedVol,
+                  const G4int blockedNum,
+                  const G4ThreeVector& globalPoint,
+                  const G4ThreeVector* globalDirection,
+                  const G4bool pLocatedOnEdge, 
+                        G4ThreeVector& localPoint );
+      // Search the cells whose extent contains the point (within tolerance)
+      // for one containing it. If found, stack it in the history and return
+      // true, with localPoint set in the frame of the cell.
+
+    G4double ComputeStep( const G4ThreeVector& localPoint,
+                          const G4ThreeVector& localDirection,
+                          const G4double currentProposedStepLength,
+                                G4double& newSafety,
+                                G4NavigationHistory& history,
+                                G4bool& validExitNormal,
+                                G4ThreeVector& exitNormal,
+                                G4bool& exiting,
+                                G4bool& entering,
+                                G4VPhysicalVolume *(*pBlockedPhysical),
+                                G4int& blockedReplicaNo );
+      // Compute the step in the mother of the lattice, visiting the cells
+      // crossed by the direction in order of distance.
+
+    G4double ComputeSafety( const G4ThreeVector& localPoint,
+                            const G4NavigationHistory& history,
+                            const G4double pProposedMaxLength = DBL_MAX );
+      // Compute the isotropic safety from the mother and the cells around
+      // the point; the other cells are bounded by their distance to it.
+
+    void PlaceCell( G4VPhysicalVolume* pPhysical, G4int copyNo ) const;
+      // Set transformation, copy number and material of a lattice cell,
+      // for use by the navigator when entering or re-establishing it.
+
+    inline void SetVerboseLevel( G4int level ) { fVerbose = level; }
+    inline void CheckMode( G4bool mode ) { fCheck = mode; }
+
+  private:
+
+    G4double ComputeCellSafety( const G4ThreeVector& localPoint,
+                                const G4LatticeParameterisation* pParam,
+                                const G4VSolid* pSolid,
+                                      G4double limit ) const;
+      // Lower bound of the distance to the cell solids, if below 'limit'.
+
+    G4double DistanceToBox( const G4ThreeVector& p,
+                            const G4ThreeVector& bmin,
+                            const G4ThreeVector& bmax ) const;
+    G4bool IntersectBox( const G4ThreeVector& p, const G4ThreeVector& v,
+                         const G4ThreeVector& bmin, const G4ThreeVector& bmax,
+                         G4double& tmin, G4double& tmax ) const;
+      // Helpers for (axis aligned) boxes: isotropic distance, and interval
+      // of the ray inside, returning false if the ray misses the box.
+
+  private:
+
+    G4int fVerbose = 0;
+    G4bool fCheck = false;
+    G4double kCarTolerance;
+};
+
+#endif
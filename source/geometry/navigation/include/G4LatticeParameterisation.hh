@@ -0,0 +1,120 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// class G4LatticeParameterisation
+//
+// Class description:
+//
+// Describes a regular three-dimensional lattice of identical cells, each
+// holding a copy of the same logical volume (of any shape) centred in the
+// cell. The pitch along each axis may exceed the extent of the cell solid,
+// leaving gaps between neighbouring cells. Copy numbers are assigned as
+// ix + nx*(iy + ny*iz), and the lattice is centred on a given point of
+// the mother frame. Volumes placed through Place() are flagged as regular
+// structures of type 2, which are handled by G4LatticeNavigation: the cells
+// around a point or along a direction are found arithmetically, without
+// voxelisation of the mother volume.
+//
+// Usage:
+//   auto lattice = new G4LatticeParameterisation(nx, ny, nz, pitch);
+//   lattice->Place("Crystals", crystalLogical, containerLogical);
+// The lattice must be the only daughter of its mother volume.
+
+// 19.10.2026 - First implementation
+// --------------------------------------------------------------------
+#ifndef G4LATTICEPARAMETERISATION_HH
+#define G4LATTICEPARAMETERISATION_HH
+
+#include "G4Types.hh"
+#include "G4ThreeVector.hh"
+#include "G4String.hh"
+#include "G4VPVParameterisation.hh"
+
+class G4VSolid;
+class G4VPhysicalVolume;
+class G4LogicalVolume;
+class G4PVParameterised;
+
+class G4LatticeParameterisation : public G4VPVParameterisation
+{
+  public:  // with description
+
+    G4LatticeParameterisation( G4int nx, G4int ny, G4int nz,
+                         const G4ThreeVector& pitch,
+                         const G4ThreeVector& centre = G4ThreeVector() );
+      // Lattice of nx*ny*nz cells of size 'pitch', centred on 'centre'
+      // in the frame of the mother volume.
+
+   ~G4LatticeParameterisation();
+
+    void ComputeTransformation( const G4int copyNo,
+                                G4VPhysicalVolume* pPhysical ) const;
+      // Place the copy at the centre of its cell, unrotated.
+
+    G4PVParameterised* Place( const G4String& pName,
+                              G4LogicalVolume* pCellLogical,
+                              G4LogicalVolume* pMotherLogical );
+      // Create the parameterised volume of the lattice in the mother
+      // logical volume and flag it for lattice navigation. Checks that
+      // the cell solid fits in a cell and that the mother has no other
+      // daughters.
+
+    inline G4int GetNoCells() const;
+    inline G4int GetNoCells( G4int axis ) const;
+    inline G4double GetPitch( G4int axis ) const;
+    inline G4double GetMinExtent( G4int axis ) const;
+    inline G4double GetMaxExtent( G4int axis ) const;
+    inline const G4ThreeVector& GetCentre() const;
+      // Number of cells, pitch and extent along the axes (0,1,2 for x,y,z).
+
+    inline const G4ThreeVector& GetSolidMin() const;
+    inline const G4ThreeVector& GetSolidMax() const;
+      // Bounding box of the cell solid, relative to the cell centre.
+      // Set by Place(); equal to the cell itself before.
+
+    inline G4int GetCellIndex( G4double coord, G4int axis ) const;
+      // Index of the cell along the axis containing the coordinate;
+      // it may be out of the range [0,n) for points outside the lattice.
+    inline G4int GetCopyNo( G4int ix, G4int iy, G4int iz ) const;
+    inline void GetCellIndices( G4int copyNo,
+                                G4int& ix, G4int& iy, G4int& iz ) const;
+    inline G4double GetCellCentre( G4int index, G4int axis ) const;
+    inline G4ThreeVector GetCellCentre( G4int copyNo ) const;
+
+  private:
+
+    G4int fNoCells[3];
+    G4double fPitch[3];
+    G4double fMin[3];
+      // Lower corner of the lattice in the mother frame
+    G4ThreeVector fCentre;
+    G4ThreeVector fSolidMin, fSolidMax;
+};
+
+#include "G4LatticeParameterisation.icc"
+
+#endif
@@ -141,6 +141,12 @@ class G4MultiNavigator : public G4Navigator
     return fpNavigator[n]; 
   }
 
+  inline void SetFusedStepping( G4bool value ) { fFusedStepping = value; }
+  inline G4bool IsFusedStepping() const { return fFusedStepping; }
+    // If fused, a geometry whose safety sphere covers the step is not
+    // asked to ComputeStep, and the step proposed to later geometries
+    // is reduced to the current minimum step (plus tolerance)
+
  protected:  // with description
 
   void ResetState();
@@ -199,6 +205,8 @@ class G4MultiNavigator : public G4Navigator
      // - corresponding value of safety
 
    G4TransportationManager* pTransportManager; // Cache for frequent use
+
+   G4bool fFusedStepping = false;
 };
 
 #endif
@@ -62,6 +62,7 @@
 #include "G4ParameterisedNavigation.hh"
 #include "G4ReplicaNavigation.hh"
 #include "G4RegularNavigation.hh"
+#include "G4LatticeNavigation.hh"
 #include "G4VExternalNavigation.hh"
 
 #include <iostream>
@@ -531,6 +532,7 @@ private:
   G4ParameterisedNavigation fparamNav;
   G4ReplicaNavigation freplicaNav;
   G4RegularNavigation fregularNav;
+  G4LatticeNavigation flatticeNav;
   G4VExternalNavigation* fpExternalNav = nullptr;
   G4VoxelSafety* fpVoxelSafety;
 
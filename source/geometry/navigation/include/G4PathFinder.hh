@@ -125,6 +125,12 @@ class G4PathFinder
      //   --> last point for which ComputeSafety was called
      //   Returns the point (center) for which this safety is valid
 
+   G4double ObtainEndPointSafety( G4int navId );
+     // Safety for navigator/geometry navId at the endpoint of the last
+     // step. In fused mode the pre-step safety, reduced by the step
+     // length, is returned when still positive; otherwise the safety
+     // is computed at the endpoint for that geometry only
+
    void EnableParallelNavigation( G4bool enableChoice = true ); 
      // Must call it to ensure that PathFinder is prepared,  
      // especially for curved tracks. If true it switches PropagatorInField
@@ -133,6 +139,13 @@ class G4PathFinder
 
    inline G4int  SetVerboseLevel(G4int lev = -1);
 
+   inline void   SetFusedStepping( G4bool value );
+   inline G4bool IsFusedStepping() const;
+     // Fused mode for parallel geometries: in the single pass made for
+     // all navigators, geometries whose safety covers the (running)
+     // minimum step are not asked to ComputeStep, and the step proposed
+     // to the later navigators is shrunk to the current minimum step
+
  public:  // with description
 
    inline G4int GetMaxLoopCount() const;
@@ -271,6 +284,13 @@ class G4PathFinder
 
    G4int fVerboseLevel = 0;  // For debugging purposes
 
+#ifdef G4PATHFINDER_OPTIMISATION
+   G4bool fFusedStepping = true;
+#else
+   G4bool fFusedStepping = false;
+#endif
+     // Use safeties and the running minimum step to skip navigators
+
    G4TransportationManager* fpTransportManager; // Cache for frequent use
    G4PropagatorInField* fpFieldPropagator;
 
@@ -297,6 +317,17 @@ inline G4int G4PathFinder::SetVerboseLevel(G4int newLevel)
   return old;
 }
 
+inline void G4PathFinder::SetFusedStepping( G4bool value )
+{
+  fFusedStepping = value;
+  fpMultiNavigator->SetFusedStepping( value );
+}
+
+inline G4bool G4PathFinder::IsFusedStepping() const
+{
+  return fFusedStepping;
+}
+
 inline G4double G4PathFinder::GetMinimumStep() const
 { 
   return fMinStep; 
@@ -30,7 +30,10 @@
 // Class description:
 //
 // This class is a helper for physics processes which require 
-// knowledge of the safety, and the step size for the 'mass' geometry
+// knowledge of the safety, and the step size for the 'mass' geometry.
+// The last few safety spheres (centre and radius) computed or provided
+// along the current track are kept, such that a safety request within
+// one of them can be answered without calling the navigator.
 
 // First version:  J.Apostolakis,  July 5th, 2006
 // --------------------------------------------------------------------
@@ -86,12 +89,42 @@ class G4SafetyHelper
     inline G4VPhysicalVolume* GetWorldVolume();
     inline void SetCurrentSafety(G4double val, const G4ThreeVector& pos);
 
+    G4double GetCachedSafety( const G4ThreeVector& pGlobalPoint ) const;
+      // Return the largest safety guaranteed at the point by the spheres
+      // in the cache, zero if none contains the point. With parallel
+      // navigation, spheres computed in the mass geometry only are skipped
+
+    void SetSafetyCacheSize(G4int n);
+    inline G4int GetSafetyCacheSize() const;
+      // Set/Get the number of safety spheres kept (default 4). With
+      // zero, only a request at the last safety position is reused
+    void ClearSafetyCache();
+      // Forget the safety spheres, e.g. at the start of a new track
+
+    void PrintStatistics(std::ostream& os) const;
+    inline void ResetStatistics();
+    inline G4long GetNumberOfRequests() const;
+    inline G4long GetNumberOfHits() const;
+      // Number of requests to ComputeSafety() and of those answered
+      // from the cache
+
   public: // without description
 
     void InitialiseHelper();
 
   private:
 
+    struct SafetySphere
+    {
+      G4ThreeVector centre;
+      G4double radius;
+      G4bool massOnly;
+        // Safety of the mass geometry only, not of the parallel worlds
+    };
+
+    void StoreSafety(G4double val, const G4ThreeVector& pos,
+                     G4bool massOnly);
+
     G4PathFinder* fpPathFinder = nullptr;
     G4Navigator* fpMassNavigator = nullptr;
     G4int fMassNavigatorId = -1;
@@ -109,6 +142,14 @@ class G4SafetyHelper
     G4ThreeVector fLastSafetyPosition;
     G4double fLastSafety = 0.0;
 
+    std::vector<SafetySphere> fSafetyCache;
+    std::size_t fCacheSize = 4;
+    std::size_t fCacheNext = 0;
+      // Last safety spheres, in a ring of fixed size
+
+    G4long fNumberOfRequests = 0;
+    G4long fNumberOfHits = 0;
+
     // const G4double fRecomputeFactor = 0.0;
        // parameter for further optimisation: 
        // if ( move < fact*safety )  do fast recomputation of safety
@@ -142,8 +183,33 @@ G4VPhysicalVolume* G4SafetyHelper::GetWorldVolume()
 inline
 void G4SafetyHelper::SetCurrentSafety(G4double val, const G4ThreeVector& pos)
 {
-  fLastSafety = val;
-  fLastSafetyPosition = pos;
+  // Transportation provides the safety of the mass geometry
+  StoreSafety(val, pos, true);
+}
+
+inline
+G4int G4SafetyHelper::GetSafetyCacheSize() const
+{
+  return G4int(fCacheSize);
+}
+
+inline
+void G4SafetyHelper::ResetStatistics()
+{
+  fNumberOfRequests = 0;
+  fNumberOfHits = 0;
+}
+
+inline
+G4long G4SafetyHelper::GetNumberOfRequests() const
+{
+  return fNumberOfRequests;
+}
+
+inline
+G4long G4SafetyHelper::GetNumberOfHits() const
+{
+  return fNumberOfHits;
 }
 
 #endif
@@ -8,9 +8,14 @@ geant4_add_module(G4navigation
     G4BrentLocator.hh
     G4DrawVoxels.hh
     G4ErrorPropagationNavigator.hh
+    G4GeomTestOverlaps.hh
+    G4GeomTestOverlaps.icc
     G4GeomTestVolume.hh
     G4GeometryMessenger.hh
     G4GlobalMagFieldMessenger.hh
+    G4LatticeNavigation.hh
+    G4LatticeParameterisation.hh
+    G4LatticeParameterisation.icc
     G4LocatorChangeRecord.hh
     G4LocatorChangeLogger.hh
     G4MultiLevelLocator.hh
@@ -47,9 +52,12 @@ geant4_add_module(G4navigation
     G4BrentLocator.cc
     G4DrawVoxels.cc
     G4ErrorPropagationNavigator.cc
+    G4GeomTestOverlaps.cc
     G4GeomTestVolume.cc
     G4GeometryMessenger.cc
     G4GlobalMagFieldMessenger.cc
+    G4LatticeNavigation.cc
+    G4LatticeParameterisation.cc
     G4LocatorChangeRecord.cc
     G4LocatorChangeLogger.cc
     G4MultiLevelLocator.cc
@@ -0,0 +1,806 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// class G4GeomTestOverlaps implementation
+//
+// 19.10.2026 - First implementation
+// --------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <queue>
+#include <sstream>
+#include <unordered_map>
+
+#include "G4GeomTestOverlaps.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4LogicalVolume.hh"
+#include "G4LogicalVolumeStore.hh"
+#include "G4VSolid.hh"
+#include "G4GeometryTolerance.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4UnitsTable.hh"
+#include "Randomize.hh"
+
+#include "PTL/TaskGroup.hh"
+
+namespace
+{
+  // Number of daughters checked by a single task
+  //
+  const G4int kDaughtersPerTask = 32;
+
+  // Maximum number of daughters in a leaf of the hierarchy
+  //
+  const G4int kLeafSize = 4;
+
+  const char* TypeName[] = { "sampling", "mother", "sister",
+                             "encapsulation", "repeated" };
+
+  G4String Quoted(const G4String& name)
+  {
+    G4String out = "\"";
+    for (auto c : name)
+    {
+      if (c == '"' || c == '\\') out += '\\';
+      out += c;
+    }
+    return out + "\"";
+  }
+
+  // Logical volume names need not be unique: mothers are identified
+  // in the resume file by their index in the store and their name
+  //
+  G4String ResumeKey(std::size_t storeIndex, const G4String& name)
+  {
+    return std::to_string(storeIndex) + " " + name;
+  }
+}
+
+//
+// Constructor
+//
+G4GeomTestOverlaps::G4GeomTestOverlaps( G4VPhysicalVolume* theWorld,
+                                        G4double theTolerance,
+                                        G4int numberOfPoints,
+                                        G4bool theVerbosity )
+  : world(theWorld), tolerance(theTolerance),
+    resolution(numberOfPoints), verbosity(theVerbosity)
+{
+}
+
+//
+// Destructor
+//
+G4GeomTestOverlaps::~G4GeomTestOverlaps()
+{
+}
+
+//
+// TestOverlaps
+//
+G4int G4GeomTestOverlaps::TestOverlaps()
+{
+  CollectMothers();
+  ReadResumeFile();
+
+  if (!resumeFile.empty())
+  {
+    resume.open(resumeFile, std::ios::out | std::ios::app);
+  }
+  if (!reportFile.empty())
+  {
+    // Records of a previous interrupted check are kept when resuming
+    //
+    std::ios::openmode mode = std::ios::out;
+    mode |= completed.empty() ? std::ios::trunc : std::ios::app;
+    report.open(reportFile, mode);
+  }
+
+  // Split the daughters of each mother in tasks of fixed size;
+  // mothers holding replicated or parameterised volumes and mothers
+  // already completed in a previous check are left out
+  //
+  struct Task { std::size_t imother; G4int first, last; };
+  std::vector<Task> tasks;
+  std::vector<G4int> firstTask(mothers.size()+1, 0);
+  std::vector<G4bool> skipped(mothers.size(), false);
+  for (std::size_t im = 0; im < mothers.size(); ++im)
+  {
+    const Mother& mother = mothers[im];
+    firstTask[im] = G4int(tasks.size());
+    skipped[im] = completed.find(ResumeKey(mother.storeIndex,
+                                           mother.logical->GetName()))
+               != completed.cend();
+    if (skipped[im] || !mother.repeated.empty()) continue;
+    G4int ndaughters = G4int(mother.physical.size());
+    for (G4int first = 0; first < ndaughters; first += kDaughtersPerTask)
+    {
+      tasks.push_back({ im, first,
+                        std::min(first + kDaughtersPerTask, ndaughters) });
+    }
+  }
+  firstTask[mothers.size()] = G4int(tasks.size());
+
+  // Each task seeds the engine of the thread running it with seeds drawn
+  // here, such that the points sampled do not depend on the scheduling
+  // and are not repeated by threads sharing the same default seeds.
+  // The state of the engine of the calling thread, which may also run
+  // tasks, is restored once they are done
+  //
+  std::vector<G4long> taskSeeds(2*tasks.size());
+  for (auto& seed : taskSeeds)
+  {
+    seed = G4long(100000000L*G4UniformRand());
+  }
+  const std::vector<unsigned long> engineState =
+    G4Random::getTheEngine()->put();
+
+  // Each task fills its own list of results; the last task completing
+  // a mother gathers them and writes the mother to the report files
+  //
+  std::vector<std::vector<Overlap>> taskResults(tasks.size());
+  std::vector<std::vector<Overlap>> results(mothers.size());
+  std::vector<std::atomic<G4int>> remaining(mothers.size());
+  for (std::size_t im = 0; im < mothers.size(); ++im)
+  {
+    remaining[im].store(firstTask[im+1] - firstTask[im]);
+  }
+
+  auto run = [&](std::size_t itask)
+  {
+    const Task& task = tasks[itask];
+    const Mother& mother = mothers[task.imother];
+    const G4long seeds[3] = { taskSeeds[2*itask], taskSeeds[2*itask+1], 0 };
+    G4Random::setTheSeeds(seeds);
+    for (G4int i = task.first; i < task.last; ++i)
+    {
+      CheckDaughter(mother, i, taskResults[itask]);
+    }
+    if (remaining[task.imother].fetch_sub(1) == 1)
+    {
+      std::vector<Overlap>& result = results[task.imother];
+      for (G4int k = firstTask[task.imother];
+                 k < firstTask[task.imother+1]; ++k)
+      {
+        result.insert(result.end(),
+                      taskResults[k].cbegin(), taskResults[k].cend());
+      }
+      FlushMother(task.imother, result);
+    }
+  };
+
+  PTL::ThreadPool* pPool = PTL::internal::get_default_threadpool();
+  if (tasks.size() < 2 || pPool == nullptr)
+  {
+    for (std::size_t k = 0; k < tasks.size(); ++k) { run(k); }
+  }
+  else
+  {
+    PTL::TaskGroup<void> taskGroup(pPool);
+    for (std::size_t k = 0; k < tasks.size(); ++k)
+    {
+      taskGroup.exec([&run, k]() { run(k); });
+    }
+    taskGroup.join();
+  }
+  G4Random::getTheEngine()->get(engineState);
+
+  // Replicated and parameterised volumes modify their solid and
+  // placement while being checked, they are treated sequentially
+  //
+  for (std::size_t im = 0; im < mothers.size(); ++im)
+  {
+    const Mother& mother = mothers[im];
+    if (skipped[im] || mother.repeated.empty()) continue;
+    std::vector<Overlap>& result = results[im];
+    G4int ndaughters = G4int(mother.physical.size());
+    for (G4int i = 0; i < ndaughters; ++i)
+    {
+      if (std::find(mother.repeated.cbegin(), mother.repeated.cend(), i)
+          == mother.repeated.cend())
+      {
+        CheckDaughter(mother, i, result);
+      }
+      else if (mother.physical[i]->CheckOverlaps(resolution, tolerance,
+                                                 verbosity, maxErr))
+      {
+        result.push_back({ kRepeated, i, -1, G4ThreeVector(), 0., 0 });
+      }
+    }
+    FlushMother(im, result);
+  }
+
+  // Report in the order of the volume tree
+  //
+  G4int noverlaps = 0, nchecked = 0;
+  for (std::size_t im = 0; im < mothers.size(); ++im)
+  {
+    const Mother& mother = mothers[im];
+    if (skipped[im])
+    {
+      if (verbosity)
+      {
+        G4cout << "Checking overlaps for daughters of volume "
+               << mother.logical->GetName()
+               << " is omitted, already completed" << G4endl;
+      }
+      continue;
+    }
+    ++nchecked;
+    if (verbosity)
+    {
+      G4cout << "Checking overlaps for " << mother.physical.size()
+             << " daughters of volume " << mother.logical->GetName()
+             << " (" << mother.solid->GetEntityType() << ") ... ";
+      if (results[im].empty()) { G4cout << "OK! " << G4endl; }
+      else { G4cout << G4endl; }
+    }
+    for (const auto& overlap : results[im])
+    {
+      if (overlap.type != kRepeated) { ReportOverlap(mother, overlap); }
+      if (overlap.type != kSampling) { ++noverlaps; }
+    }
+  }
+
+  G4cout << "Overlaps check on " << nchecked << " mother volumes ("
+         << tasks.size() << " tasks) found " << noverlaps
+         << " overlaps." << G4endl;
+
+  if (report.is_open()) { report.close(); }
+  if (resume.is_open()) { resume.close(); }
+  mothers.clear();
+  completed.clear();
+
+  return noverlaps;
+}
+
+//
+// CollectMothers
+//
+// Visit the tree once per logical volume and gather the data of the
+// daughters, as seen by the current thread
+//
+void G4GeomTestOverlaps::CollectMothers()
+{
+  mothers.clear();
+  if (world == nullptr) { return; }
+
+  std::unordered_map<const G4LogicalVolume*, std::size_t> storeIndex;
+  G4LogicalVolumeStore* store = G4LogicalVolumeStore::GetInstance();
+  for (std::size_t n = 0; n < store->size(); ++n)
+  {
+    storeIndex[(*store)[n]] = n;
+  }
+
+  std::queue<G4LogicalVolume*> volumes;
+  std::set<G4LogicalVolume*> visited;
+  std::set<G4VSolid*> sampled;
+
+  volumes.push(world->GetLogicalVolume());
+  visited.insert(world->GetLogicalVolume());
+  while (!volumes.empty())
+  {
+    G4LogicalVolume* logical = volumes.front();
+    volumes.pop();
+
+    std::size_t ndaughters = logical->GetNoDaughters();
+    if (ndaughters == 0) continue;
+
+    mothers.emplace_back();
+    Mother& mother = mothers.back();
+    mother.logical = logical;
+    mother.storeIndex = storeIndex[logical];
+    mother.solid = logical->GetSolid();
+    mother.physical.reserve(ndaughters);
+    mother.solids.reserve(ndaughters);
+    mother.transform.reserve(ndaughters);
+
+    for (std::size_t i = 0; i < ndaughters; ++i)
+    {
+      G4VPhysicalVolume* daughter = logical->GetDaughter(i);
+      G4LogicalVolume* daughterLogical = daughter->GetLogicalVolume();
+      G4VSolid* daughterSolid = daughterLogical->GetSolid();
+
+      mother.physical.push_back(daughter);
+      mother.solids.push_back(daughterSolid);
+      mother.transform.push_back(
+        G4AffineTransform(daughter->GetRotation(), daughter->GetTranslation()));
+      if (daughter->IsReplicated())
+      {
+        mother.repeated.push_back(G4int(i));
+      }
+
+      // Sample the solid once here, such that any data cached by
+      // the solid for generating points is filled before the tasks
+      //
+      if (sampled.insert(daughterSolid).second)
+      {
+        daughterSolid->GetPointOnSurface();
+      }
+
+      if (visited.insert(daughterLogical).second)
+      {
+        volumes.push(daughterLogical);
+      }
+    }
+    BuildIndex(mother);
+  }
+}
+
+//
+// BuildIndex
+//
+// Compute the extent of the daughters in the mother frame and build
+// the bounding volume hierarchy on top of them
+//
+void G4GeomTestOverlaps::BuildIndex(Mother& mother) const
+{
+  G4int ndaughters = G4int(mother.physical.size());
+  mother.pmin.resize(ndaughters);
+  mother.pmax.resize(ndaughters);
+  mother.order.resize(ndaughters);
+
+  for (G4int i = 0; i < ndaughters; ++i)
+  {
+    G4ThreeVector pmin_local, pmax_local;
+    mother.solids[i]->BoundingLimits(pmin_local, pmax_local);
+    const G4AffineTransform& Td = mother.transform[i];
+    if (!Td.IsRotated())
+    {
+      G4ThreeVector offset = Td.NetTranslation();
+      mother.pmin[i] = pmin_local + offset;
+      mother.pmax[i] = pmax_local + offset;
+    }
+    else
+    {
+      G4double xmin =  kInfinity, ymin =  kInfinity, zmin =  kInfinity;
+      G4double xmax = -kInfinity, ymax = -kInfinity, zmax = -kInfinity;
+      for (G4int k = 0; k < 8; ++k)
+      {
+        G4ThreeVector corner((k & 1) ? pmax_local.x() : pmin_local.x(),
+                             (k & 2) ? pmax_local.y() : pmin_local.y(),
+                             (k & 4) ? pmax_local.z() : pmin_local.z());
+        G4ThreeVector p = Td.TransformPoint(corner);
+        xmin = std::min(xmin, p.x());
+        ymin = std::min(ymin, p.y());
+        zmin = std::min(zmin, p.z());
+        xmax = std::max(xmax, p.x());
+        ymax = std::max(ymax, p.y());
+        zmax = std::max(zmax, p.z());
+      }
+      mother.pmin[i].set(xmin, ymin, zmin);
+      mother.pmax[i].set(xmax, ymax, zmax);
+    }
+    mother.order[i] = i;
+  }
+
+  mother.nodes.clear();
+  mother.nodes.reserve(2*ndaughters);
+  BuildNode(mother, 0, ndaughters);
+}
+
+//
+// BuildNode
+//
+// Split the range of daughters at the median of their centres along
+// the axis of largest spread
+//
+G4int G4GeomTestOverlaps::BuildNode(Mother& mother,
+                                    G4int first, G4int count) const
+{
+  G4ThreeVector pmin( kInfinity,  kInfinity,  kInfinity);
+  G4ThreeVector pmax(-kInfinity, -kInfinity, -kInfinity);
+  G4ThreeVector cmin( kInfinity,  kInfinity,  kInfinity);
+  G4ThreeVector cmax(-kInfinity, -kInfinity, -kInfinity);
+  for (G4int k = first; k < first + count; ++k)
+  {
+    G4int i = mother.order[k];
+    G4ThreeVector centre = 0.5*(mother.pmin[i] + mother.pmax[i]);
+    for (G4int axis = 0; axis < 3; ++axis)
+    {
+      pmin[axis] = std::min(pmin[axis], mother.pmin[i][axis]);
+      pmax[axis] = std::max(pmax[axis], mother.pmax[i][axis]);
+      cmin[axis] = std::min(cmin[axis], centre[axis]);
+      cmax[axis] = std::max(cmax[axis], centre[axis]);
+    }
+  }
+
+  G4int inode = G4int(mother.nodes.size());
+  mother.nodes.push_back({ pmin, pmax, -1, -1, first, count });
+  if (count <= kLeafSize) { return inode; }
+
+  G4ThreeVector spread = cmax - cmin;
+  G4int axis = 0;
+  if (spread.y() > spread[axis]) { axis = 1; }
+  if (spread.z() > spread[axis]) { axis = 2; }
+
+  G4int half = count/2;
+  auto begin = mother.order.begin() + first;
+  std::nth_element(begin, begin + half, begin + count,
+                   [&mother, axis](G4int a, G4int b)
+                   {
+                     return mother.pmin[a][axis] + mother.pmax[a][axis]
+                          < mother.pmin[b][axis] + mother.pmax[b][axis];
+                   });
+
+  G4int left = BuildNode(mother, first, half);
+  G4int right = BuildNode(mother, first + half, count - half);
+  mother.nodes[inode].left = left;
+  mother.nodes[inode].right = right;
+  return inode;
+}
+
+//
+// FindCandidates
+//
+// Collect, in placement order, the daughters whose extent intersects
+// the given box
+//
+void G4GeomTestOverlaps::FindCandidates(const Mother& mother,
+                                        const G4ThreeVector& pmin,
+                                        const G4ThreeVector& pmax,
+                                        std::vector<G4int>& candidates) const
+{
+  auto intersect = [&pmin, &pmax](const G4ThreeVector& bmin,
+                                   const G4ThreeVector& bmax)
+  {
+    return bmin.x() < pmax.x() && bmax.x() > pmin.x()
+        && bmin.y() < pmax.y() && bmax.y() > pmin.y()
+        && bmin.z() < pmax.z() && bmax.z() > pmin.z();
+  };
+
+  candidates.clear();
+  if (mother.nodes.empty()) { return; }
+
+  std::vector<G4int> stack(1, 0);
+  while (!stack.empty())
+  {
+    const Node& node = mother.nodes[stack.back()];
+    stack.pop_back();
+    if (!intersect(node.pmin, node.pmax)) continue;
+    if (node.left < 0)
+    {
+      for (G4int k = node.first; k < node.first + node.count; ++k)
+      {
+        G4int i = mother.order[k];
+        if (intersect(mother.pmin[i], mother.pmax[i]))
+        {
+          candidates.push_back(i);
+        }
+      }
+    }
+    else
+    {
+      stack.push_back(node.right);
+      stack.push_back(node.left);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+}
+
+//
+// CheckDaughter
+//
+// Same checks as G4PVPlacement::CheckOverlaps(), with sisters selected
+// through the hierarchy; results are returned instead of printed
+//
+void G4GeomTestOverlaps::CheckDaughter(const Mother& mother, G4int idaughter,
+                                       std::vector<Overlap>& result) const
+{
+  if (resolution <= 0) { return; }
+
+  G4VSolid* solid = mother.solids[idaughter];
+  const G4AffineTransform& Tm = mother.transform[idaughter];
+  G4int trials = 0;
+
+  // Check that random points are generated correctly
+  //
+  G4ThreeVector ptmp = solid->GetPointOnSurface();
+  if (solid->Inside(ptmp) != kSurface)
+  {
+    result.push_back({ kSampling, idaughter, -1, ptmp, 0., 1 });
+    return;
+  }
+
+  // Generate random points on the surface of the solid,
+  // transform them into the mother volume coordinate system
+  // and find the bounding box
+  //
+  std::vector<G4ThreeVector> points(resolution);
+  G4double xmin =  kInfinity, ymin =  kInfinity, zmin =  kInfinity;
+  G4double xmax = -kInfinity, ymax = -kInfinity, zmax = -kInfinity;
+  for (G4int i = 0; i < resolution; ++i)
+  {
+    points[i] = Tm.TransformPoint(solid->GetPointOnSurface());
+    xmin = std::min(xmin, points[i].x());
+    ymin = std::min(ymin, points[i].y());
+    zmin = std::min(zmin, points[i].z());
+    xmax = std::max(xmax, points[i].x());
+    ymax = std::max(ymax, points[i].y());
+    zmax = std::max(zmax, points[i].z());
+  }
+
+  // Check overlap with the mother volume
+  //
+  std::vector<EInside> location(resolution);
+  std::vector<G4ThreeVector> selected;
+  std::vector<G4double> distance;
+  selected.reserve(resolution);
+  distance.reserve(resolution);
+
+  G4VSolid* motherSolid = mother.solid;
+  motherSolid->InsideBatch(resolution, points.data(), location.data());
+  for (G4int i = 0; i < resolution; ++i)
+  {
+    if (location[i] == kOutside) selected.push_back(points[i]);
+  }
+  G4int nselected = G4int(selected.size());
+  distance.resize(nselected);
+  motherSolid->SafetyToInBatch(nselected, selected.data(), distance.data());
+
+  Overlap overlap = { kMother, idaughter, -1, G4ThreeVector(), -kInfinity, 0 };
+  for (G4int i = 0; i < nselected; ++i)
+  {
+    G4double distin = distance[i];
+    if (distin < tolerance) continue; // too small overlap
+    ++overlap.count;
+    if (distin <= overlap.size) continue;
+    overlap.size = distin;
+    overlap.point = selected[i];
+  }
+  if (overlap.count > 0)
+  {
+    result.push_back(overlap);
+    if (++trials >= maxErr) { return; }
+  }
+
+  // Check overlaps with the candidate sisters only
+  //
+  std::vector<G4int> candidates;
+  FindCandidates(mother, G4ThreeVector(xmin, ymin, zmin),
+                 G4ThreeVector(xmax, ymax, zmax), candidates);
+
+  for (auto k : candidates)
+  {
+    if (k == idaughter) continue;
+
+    G4VSolid* sisterSolid = mother.solids[k];
+    const G4AffineTransform& Td = mother.transform[k];
+    const G4ThreeVector& pmin = mother.pmin[k];
+    const G4ThreeVector& pmax = mother.pmax[k];
+
+    selected.clear();
+    for (G4int i = 0; i < resolution; ++i)
+    {
+      const G4ThreeVector& p = points[i];
+      if (p.x() <= pmin.x()) continue;
+      if (p.x() >= pmax.x()) continue;
+      if (p.y() <= pmin.y()) continue;
+      if (p.y() >= pmax.y()) continue;
+      if (p.z() <= pmin.z()) continue;
+      if (p.z() >= pmax.z()) continue;
+      selected.push_back(Td.InverseTransformPoint(p));
+    }
+
+    // Find the points inside the sister and their depth
+    //
+    nselected = G4int(selected.size());
+    location.resize(nselected);
+    sisterSolid->InsideBatch(nselected, selected.data(), location.data());
+    G4int ninside = 0;
+    for (G4int i = 0; i < nselected; ++i)
+    {
+      if (location[i] == kInside) selected[ninside++] = selected[i];
+    }
+    distance.resize(ninside);
+    sisterSolid->SafetyToOutBatch(ninside, selected.data(), distance.data());
+
+    overlap = { kSister, idaughter, k, G4ThreeVector(), -kInfinity, 0 };
+    for (G4int i = 0; i < ninside; ++i)
+    {
+      G4double distout = distance[i];
+      if (distout < tolerance) continue; // too small overlap
+      ++overlap.count;
+      if (distout <= overlap.size) continue;
+      overlap.size = distout;
+      overlap.point = selected[i];
+    }
+
+    if (overlap.count > 0)
+    {
+      result.push_back(overlap);
+      if (++trials >= maxErr) { return; }
+    }
+    else if (ninside == 0)
+    {
+      // Verify that the sister is not fully encapsulated,
+      // with a single point generated inside of it
+      //
+      G4ThreeVector pSurface = sisterSolid->GetPointOnSurface();
+      G4ThreeVector normal = sisterSolid->SurfaceNormal(pSurface);
+      G4ThreeVector pInside = pSurface - normal*1.e-4;
+      G4ThreeVector dPoint = (sisterSolid->Inside(pInside) == kInside) ?
+        pInside : pSurface;
+      G4ThreeVector msi = Tm.InverseTransformPoint(Td.TransformPoint(dPoint));
+      if (solid->Inside(msi) == kInside)
+      {
+        result.push_back({ kEncapsulation, idaughter, k, msi, 0., 1 });
+        if (++trials >= maxErr) { return; }
+      }
+    }
+  }
+}
+
+//
+// ReadResumeFile
+//
+// Each line of the file holds the index in the logical volume store
+// and the name of a completed mother volume
+//
+void G4GeomTestOverlaps::ReadResumeFile()
+{
+  completed.clear();
+  if (resumeFile.empty()) { return; }
+
+  std::ifstream in(resumeFile);
+  std::string line;
+  while (std::getline(in, line))
+  {
+    if (!line.empty()) { completed.insert(line); }
+  }
+  if (verbosity && !completed.empty())
+  {
+    G4cout << "Resuming overlaps check, " << completed.size()
+           << " mother volumes already completed." << G4endl;
+  }
+}
+
+//
+// FlushMother
+//
+// Write the results for a mother volume and mark it as completed.
+// Called once per mother, from whichever task completes it
+//
+void G4GeomTestOverlaps::FlushMother(std::size_t imother,
+                                     std::vector<Overlap>& result)
+{
+  const Mother& mother = mothers[imother];
+
+  G4AutoLock lock(&fileMutex);
+  if (report.is_open())
+  {
+    for (const auto& overlap : result) { WriteRecord(mother, overlap); }
+    report << "{\"mother\":" << Quoted(mother.logical->GetName())
+           << ",\"daughters\":" << mother.physical.size()
+           << ",\"overlaps\":" << result.size()
+           << ",\"status\":\"done\"}" << std::endl;
+  }
+  if (resume.is_open())
+  {
+    resume << ResumeKey(mother.storeIndex, mother.logical->GetName())
+           << std::endl;
+  }
+}
+
+//
+// WriteRecord
+//
+// One JSON object per line; lengths are expressed in mm
+//
+void G4GeomTestOverlaps::WriteRecord(const Mother& mother,
+                                     const Overlap& overlap)
+{
+  const G4VPhysicalVolume* daughter = mother.physical[overlap.daughter];
+  report << "{\"mother\":" << Quoted(mother.logical->GetName())
+         << ",\"volume\":" << Quoted(daughter->GetName())
+         << ",\"copy\":" << daughter->GetCopyNo()
+         << ",\"solid\":"
+         << Quoted(mother.solids[overlap.daughter]->GetEntityType())
+         << ",\"type\":\"" << TypeName[overlap.type] << "\"";
+  if (overlap.other >= 0)
+  {
+    const G4VPhysicalVolume* sister = mother.physical[overlap.other];
+    report << ",\"other\":" << Quoted(sister->GetName())
+           << ",\"other_copy\":" << sister->GetCopyNo()
+           << ",\"other_solid\":"
+           << Quoted(mother.solids[overlap.other]->GetEntityType());
+  }
+  if (overlap.type != kRepeated)
+  {
+    report << ",\"point\":[" << overlap.point.x()/mm << ','
+           << overlap.point.y()/mm << ',' << overlap.point.z()/mm << ']'
+           << ",\"size\":" << overlap.size/mm
+           << ",\"count\":" << overlap.count;
+  }
+  report << '}' << std::endl;
+}
+
+//
+// ReportOverlap
+//
+// Issue the same warnings as G4PVPlacement::CheckOverlaps()
+//
+void G4GeomTestOverlaps::ReportOverlap(const Mother& mother,
+                                       const Overlap& overlap) const
+{
+  const G4VPhysicalVolume* daughter = mother.physical[overlap.daughter];
+  const G4VSolid* solid = mother.solids[overlap.daughter];
+  std::ostringstream message;
+
+  switch (overlap.type)
+  {
+    case kSampling:
+      message << "Sample point is not on the surface !" << G4endl
+              << "          The issue is detected for volume "
+              << daughter->GetName() << ':' << daughter->GetCopyNo()
+              << " (" << solid->GetEntityType() << ")" << G4endl
+              << "          generated point " << overlap.point
+              << " is not on the surface";
+      break;
+    case kMother:
+      message << "Overlap with mother volume !" << G4endl
+              << "          Overlap is detected for volume "
+              << daughter->GetName() << ':' << daughter->GetCopyNo()
+              << " (" << solid->GetEntityType() << ")"
+              << " with its mother volume " << mother.logical->GetName()
+              << " (" << mother.solid->GetEntityType() << ")" << G4endl
+              << "          protrusion at mother local point "
+              << overlap.point << " by "
+              << G4BestUnit(overlap.size, "Length")
+              << " (max of " << overlap.count << " cases)";
+      break;
+    case kSister:
+      message << "Overlap with volume already placed !" << G4endl
+              << "          Overlap is detected for volume "
+              << daughter->GetName() << ':' << daughter->GetCopyNo()
+              << " (" << solid->GetEntityType() << ") with "
+              << mother.physical[overlap.other]->GetName() << ':'
+              << mother.physical[overlap.other]->GetCopyNo()
+              << " (" << mother.solids[overlap.other]->GetEntityType()
+              << ")" << G4endl
+              << "          overlap at local point " << overlap.point
+              << " by " << G4BestUnit(overlap.size, "Length")
+              << " (max of " << overlap.count << " cases)";
+      break;
+    case kEncapsulation:
+      message << "Overlap with volume already placed !" << G4endl
+              << "          Overlap is detected for volume "
+              << daughter->GetName() << ':' << daughter->GetCopyNo()
+              << " (" << solid->GetEntityType() << ")" << G4endl
+              << "          apparently fully encapsulating volume "
+              << mother.physical[overlap.other]->GetName() << ':'
+              << mother.physical[overlap.other]->GetCopyNo()
+              << " (" << mother.solids[overlap.other]->GetEntityType()
+              << ")" << " at the same level!";
+      break;
+    case kRepeated:
+      return;
+  }
+  G4Exception("G4GeomTestOverlaps::TestOverlaps()",
+              "GeomVol1002", JustWarning, message);
+}
@@ -31,23 +31,31 @@
 // --------------------------------------------------------------------
 
 #include <iomanip>
+#include <sstream>
 
 #include "G4GeometryMessenger.hh"
 
 #include "G4TransportationManager.hh"
 #include "G4GeometryManager.hh"
+#include "G4RegionStore.hh"
+#include "G4Region.hh"
 #include "G4VPhysicalVolume.hh"
 #include "G4Navigator.hh"
 #include "G4PropagatorInField.hh"
+#include "G4SafetyHelper.hh"
+#include "G4PathFinder.hh"
 
 #include "G4UIdirectory.hh"
 #include "G4UIcommand.hh"
+#include "G4UIparameter.hh"
 #include "G4UIcmdWithoutParameter.hh"
 #include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
 #include "G4UIcmdWithAnInteger.hh"
 #include "G4UIcmdWithADoubleAndUnit.hh"
 
 #include "G4GeomTestVolume.hh"
+#include "G4GeomTestOverlaps.hh"
 
 //
 // Constructor
@@ -107,6 +115,73 @@ G4GeometryMessenger::G4GeometryMessenger(G4TransportationManager* tman)
   pchkCmd->SetDefaultValue(true);
   pchkCmd->AvailableForStates(G4State_Idle);
 
+  sfcCmd = new G4UIcmdWithAnInteger( "/geometry/navigator/safety_cache", this );
+  sfcCmd->SetGuidance( "Set the number of safety spheres kept along a track." );
+  sfcCmd->SetGuidance( "Safety requests from physics processes falling inside" );
+  sfcCmd->SetGuidance( "one of the last spheres computed are answered without" );
+  sfcCmd->SetGuidance( "calling the navigator. With zero, only requests at the" );
+  sfcCmd->SetGuidance( "last safety position are reused. Default is 4." );
+  sfcCmd->SetParameterName("size",true);
+  sfcCmd->SetDefaultValue(4);
+  sfcCmd->SetRange("size >=0");
+  sfcCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  sfsCmd = new G4UIcmdWithoutParameter( "/geometry/navigator/safety_cache_stats", this );
+  sfsCmd->SetGuidance( "Print the number of safety requests and of those" );
+  sfsCmd->SetGuidance( "answered from the safety cache, for this thread." );
+  sfsCmd->AvailableForStates(G4State_Idle);
+
+  fusCmd = new G4UIcmdWithABool( "/geometry/navigator/fused_parallel_worlds", this );
+  fusCmd->SetGuidance( "Set fused stepping of the mass and parallel worlds." );
+  fusCmd->SetGuidance( "In the single pass made by the path-finder for all" );
+  fusCmd->SetGuidance( "worlds, a world whose safety covers the shortest step" );
+  fusCmd->SetGuidance( "found so far is not asked to compute the step, and the" );
+  fusCmd->SetGuidance( "step proposed to the next worlds is reduced to it." );
+  fusCmd->SetGuidance( "Parallel world processes also reuse the pre-step" );
+  fusCmd->SetGuidance( "safety at the end point when still positive." );
+  fusCmd->SetParameterName("fusedFlag",true);
+  fusCmd->SetDefaultValue(true);
+  fusCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  sgrCmd = new G4UIcommand( "/geometry/navigator/safety_grid", this );
+  sgrCmd->SetGuidance( "Set the maximum number of cells of the grids of safety" );
+  sgrCmd->SetGuidance( "lower bounds built for the logical volumes of a region." );
+  sgrCmd->SetGuidance( "A grid is built, when closing the geometry, for each" );
+  sgrCmd->SetGuidance( "volume of the region holding placed daughters, unless" );
+  sgrCmd->SetGuidance( "it is itself placed by a parameterised or replicated" );
+  sgrCmd->SetGuidance( "volume; safety requests bounded by the grid value skip" );
+  sgrCmd->SetGuidance( "the computation." );
+  sgrCmd->SetGuidance( "Zero (default) disables the grids for the region." );
+  sgrCmd->SetGuidance( "NOTE: takes effect the next time the geometry is closed." );
+  auto regionPrm = new G4UIparameter( "region", 's', false );
+  sgrCmd->SetParameter(regionPrm);
+  auto cellsPrm = new G4UIparameter( "cells", 'i', true );
+  cellsPrm->SetDefaultValue(32768);
+  cellsPrm->SetParameterRange("cells >= 0");
+  sgrCmd->SetParameter(cellsPrm);
+  sgrCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  sgrCmd->SetToBeBroadcasted(false);
+
+  fgeCmd = new G4UIcommand( "/geometry/navigator/fast_geometry", this );
+  fgeCmd->SetGuidance( "Set the fast geometry mode for the volumes of a region." );
+  fgeCmd->SetGuidance( "Envelopes of their solids are built when closing the" );
+  fgeCmd->SetGuidance( "geometry; the navigation takes the safety from the" );
+  fgeCmd->SetGuidance( "envelope farther than the given distance, and asks the" );
+  fgeCmd->SetGuidance( "solid for the step only if the track enters its envelope." );
+  fgeCmd->SetGuidance( "Zero (default) disables the fast geometry for the region." );
+  fgeCmd->SetGuidance( "NOTE: takes effect the next time the geometry is closed." );
+  auto fgeRegionPrm = new G4UIparameter( "region", 's', false );
+  fgeCmd->SetParameter(fgeRegionPrm);
+  auto distPrm = new G4UIparameter( "distance", 'd', true );
+  distPrm->SetDefaultValue(1.);
+  distPrm->SetParameterRange("distance >= 0.");
+  fgeCmd->SetParameter(distPrm);
+  auto unitPrm = new G4UIparameter( "unit", 's', true );
+  unitPrm->SetDefaultUnit("mm");
+  fgeCmd->SetParameter(unitPrm);
+  fgeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  fgeCmd->SetToBeBroadcasted(false);
+
   //
   // Geometry verification test commands
   //
@@ -167,6 +242,34 @@ G4GeometryMessenger::G4GeometryMessenger(G4TransportationManager* tman)
   recCmd->SetGuidance( "NOTE: it may take a very long time," );
   recCmd->SetGuidance( "      depending on the geometry complexity !");
   recCmd->AvailableForStates(G4State_Idle);
+
+  repCmd = new G4UIcmdWithAString( "/geometry/test/report_file", this );
+  repCmd->SetGuidance( "Set the file where parallel_run writes its report," );
+  repCmd->SetGuidance( "one JSON record per line for each overlap found and" );
+  repCmd->SetGuidance( "for each mother volume completed." );
+  repCmd->SetGuidance( "By default, or if empty, no report is written." );
+  repCmd->SetParameterName("report_file",true);
+  repCmd->SetDefaultValue("");
+
+  rsmCmd = new G4UIcmdWithAString( "/geometry/test/resume_file", this );
+  rsmCmd->SetGuidance( "Set the file where parallel_run records the mother" );
+  rsmCmd->SetGuidance( "volumes it completed. Volumes already listed in the" );
+  rsmCmd->SetGuidance( "file are skipped, allowing to resume a check which" );
+  rsmCmd->SetGuidance( "was interrupted. The file must be removed to start" );
+  rsmCmd->SetGuidance( "again from scratch. By default, or if empty, no" );
+  rsmCmd->SetGuidance( "resume file is used." );
+  rsmCmd->SetParameterName("resume_file",true);
+  rsmCmd->SetDefaultValue("");
+
+  prunCmd = new G4UIcmdWithoutParameter( "/geometry/test/parallel_run", this );
+  prunCmd->SetGuidance( "Start running the overlap check on the whole tree," );
+  prunCmd->SetGuidance( "once for each logical volume, distributing the" );
+  prunCmd->SetGuidance( "checks over the tasks of the thread pool if any." );
+  prunCmd->SetGuidance( "Sister volumes are tested only if their bounding box" );
+  prunCmd->SetGuidance( "intersects the points generated on the surface." );
+  prunCmd->SetGuidance( "Settings for tolerance, resolution, verbosity and" );
+  prunCmd->SetGuidance( "maximum_errors apply; recursion settings are ignored." );
+  prunCmd->AvailableForStates(G4State_Idle);
 }
 
 //
@@ -175,9 +278,12 @@ G4GeometryMessenger::G4GeometryMessenger(G4TransportationManager* tman)
 G4GeometryMessenger::~G4GeometryMessenger()
 {
   delete verCmd; delete recCmd; delete rslCmd;
+  delete prunCmd; delete repCmd; delete rsmCmd;
   delete resCmd; delete rcsCmd; delete rcdCmd; delete errCmd;
   delete tolCmd;
   delete verbCmd; delete pchkCmd; delete chkCmd;
+  delete sfcCmd; delete sfsCmd; delete sgrCmd; delete fusCmd;
+  delete fgeCmd;
   delete geodir; delete navdir; delete testdir;
   delete tvolume;
 }
@@ -221,6 +327,23 @@ G4GeometryMessenger::SetNewValue( G4UIcommand* command, G4String newValues )
   else if (command == pchkCmd) {
     SetPushFlag( newValues );
   }
+  else if (command == sfcCmd) {
+    tmanager->GetSafetyHelper()
+            ->SetSafetyCacheSize(sfcCmd->GetNewIntValue( newValues ));
+  }
+  else if (command == sfsCmd) {
+    tmanager->GetSafetyHelper()->PrintStatistics(G4cout);
+  }
+  else if (command == sgrCmd) {
+    SetSafetyGrid( newValues );
+  }
+  else if (command == fgeCmd) {
+    SetFastGeometry( newValues );
+  }
+  else if (command == fusCmd) {
+    G4PathFinder::GetInstance()
+      ->SetFusedStepping(fusCmd->GetNewBoolValue( newValues ));
+  }
   else if (command == tolCmd) {
     Init();
     tol = tolCmd->GetNewDoubleValue( newValues )
@@ -251,6 +374,18 @@ G4GeometryMessenger::SetNewValue( G4UIcommand* command, G4String newValues )
     RecursiveOverlapTest();
     G4cout << "Geometry overlaps check completed !" << G4endl;
   }
+  else if (command == repCmd) {
+    reportFile = newValues;
+  }
+  else if (command == rsmCmd) {
+    resumeFile = newValues;
+  }
+  else if (command == prunCmd) {
+    Init();
+    G4cout << "Running parallel geometry overlaps check..." << G4endl;
+    ParallelOverlapTest();
+    G4cout << "Geometry overlaps check completed !" << G4endl;
+  }
 }
 
 //
@@ -324,6 +459,37 @@ G4GeometryMessenger::SetCheckMode(G4String input)
   if (pField != nullptr)  { pField->CheckMode(mode); }
 }
 
+//
+// Set the safety grids size for a region
+//
+void
+G4GeometryMessenger::SetSafetyGrid(G4String input)
+{
+  G4String regionName;
+  G4int ncells = 0;
+  std::istringstream is(input);
+  is >> regionName >> ncells;
+  G4Region* region = G4RegionStore::GetInstance()->GetRegion(regionName);
+  if (region != nullptr)  { region->SetSafetyGridCells(ncells); }
+}
+
+//
+// Set the fast geometry mode for a region
+//
+void
+G4GeometryMessenger::SetFastGeometry(G4String input)
+{
+  G4String regionName, dist = "0", unit = "mm";
+  std::istringstream is(input);
+  is >> regionName >> dist >> unit;
+  G4Region* region = G4RegionStore::GetInstance()->GetRegion(regionName);
+  if (region != nullptr)
+  {
+    region->SetFastGeometryDistance(G4UIcommand::ConvertToDouble(dist)
+                                   *G4UIcommand::ValueOf(unit));
+  }
+}
+
 //
 // Set navigator verbosity for push notifications
 //
@@ -349,3 +515,25 @@ G4GeometryMessenger::RecursiveOverlapTest()
   //
   tvolume->TestRecursiveOverlap( recLevel, recDepth );
 }
+
+//
+// Parallel Overlap Test
+//
+void
+G4GeometryMessenger::ParallelOverlapTest()
+{
+  // Close geometry if necessary
+  //
+  CheckGeometry();
+
+  // Check the whole tree with the current settings
+  //
+  G4VPhysicalVolume* world =
+    tmanager->GetNavigatorForTracking()->GetWorldVolume();
+  G4GeomTestOverlaps test(world, tvolume->GetTolerance(),
+                          tvolume->GetResolution(), tvolume->GetVerbosity());
+  test.SetErrorsThreshold(tvolume->GetErrorsThreshold());
+  test.SetReportFile(reportFile);
+  test.SetResumeFile(resumeFile);
+  test.TestOverlaps();
+}
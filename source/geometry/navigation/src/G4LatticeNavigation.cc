@@ -0,0 +1,509 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// class G4LatticeNavigation implementation
+//
+// --------------------------------------------------------------------
+
+#include "G4LatticeNavigation.hh"
+#include "G4LatticeParameterisation.hh"
+#include "G4AuxiliaryNavServices.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4LogicalVolume.hh"
+#include "G4VSolid.hh"
+#include "G4GeometryTolerance.hh"
+
+// ********************************************************************
+// Constructor
+// ********************************************************************
+//
+G4LatticeNavigation::G4LatticeNavigation()
+{
+  kCarTolerance = G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+}
+
+// ********************************************************************
+// Destructor
+// ********************************************************************
+//
+G4LatticeNavigation::~G4LatticeNavigation()
+{
+}
+
+// ********************************************************************
+// LevelLocate
+// ********************************************************************
+//
+G4bool
+G4LatticeNavigation::LevelLocate( G4NavigationHistory& history,
+                            const G4VPhysicalVolume* blockedVol,
+                            const G4int blockedNum,
+                            const G4ThreeVector& globalPoint,
+                            const G4ThreeVector* globalDirection,
+                            const G4bool pLocatedOnEdge, 
+                                  G4ThreeVector& localPoint )
+{
+  G4LogicalVolume* motherLogical = history.GetTopVolume()->GetLogicalVolume();
+  G4VPhysicalVolume* pPhysical = motherLogical->GetDaughter(0);
+  auto pParam = static_cast<G4LatticeParameterisation*>
+                (pPhysical->GetParameterisation());
+  const G4VSolid* pSolid = pPhysical->GetLogicalVolume()->GetSolid();
+  const G4ThreeVector& solidMin = pParam->GetSolidMin();
+  const G4ThreeVector& solidMax = pParam->GetSolidMax();
+
+  // Range of cells whose extent contains the point, within tolerance
+  //
+  G4int imin[3], imax[3];
+  for (auto i=0; i<3; ++i)
+  {
+    imin[i] = pParam->GetCellIndex(localPoint(i) - kCarTolerance, i);
+    imax[i] = pParam->GetCellIndex(localPoint(i) + kCarTolerance, i);
+    if ( imin[i] < 0 )  { imin[i] = 0; }
+    if ( imax[i] >= pParam->GetNoCells(i) )  { imax[i] = pParam->GetNoCells(i)-1; }
+    if ( imin[i] > imax[i] )  { return false; }  // Outside the lattice
+  }
+
+  for (auto iz=imin[2]; iz<=imax[2]; ++iz)
+  {
+    for (auto iy=imin[1]; iy<=imax[1]; ++iy)
+    {
+      for (auto ix=imin[0]; ix<=imax[0]; ++ix)
+      {
+        G4int copyNo = pParam->GetCopyNo(ix, iy, iz);
+        if ( (copyNo == blockedNum) && (pPhysical == blockedVol) )  { continue; }
+
+        // Skip the cells whose solid extent does not reach the point
+        //
+        G4ThreeVector cellPoint = localPoint
+          - G4ThreeVector(pParam->GetCellCentre(ix, 0),
+                          pParam->GetCellCentre(iy, 1),
+                          pParam->GetCellCentre(iz, 2));
+        if ( DistanceToBox(cellPoint, solidMin, solidMax) > kCarTolerance )
+        {
+          continue;
+        }
+
+        pParam->ComputeTransformation(copyNo, pPhysical);
+        history.NewLevel(pPhysical, kParameterised, copyNo);
+        G4ThreeVector samplePoint =
+          history.GetTopTransform().TransformPoint(globalPoint);
+        if ( !G4AuxiliaryNavServices::CheckPointOnSurface( pSolid, samplePoint,
+              globalDirection, history.GetTopTransform(), pLocatedOnEdge) )
+        {
+          history.BackLevel();
+        }
+        else
+        {
+          // Enter this cell
+          //
+          localPoint = samplePoint;
+          PlaceCell(pPhysical, copyNo);
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+// ********************************************************************
+// ComputeStep
+// ********************************************************************
+//
+G4double
+G4LatticeNavigation::ComputeStep( const G4ThreeVector& localPoint,
+                                  const G4ThreeVector& localDirection,
+                                  const G4double currentProposedStepLength,
+                                        G4double& newSafety,
+                                        G4NavigationHistory& history,
+                                        G4bool& validExitNormal,
+                                        G4ThreeVector& exitNormal,
+                                        G4bool& exiting,
+                                        G4bool& entering,
+                                        G4VPhysicalVolume *(*pBlockedPhysical),
+                                        G4int& blockedReplicaNo )
+{
+  G4VPhysicalVolume* motherPhysical = history.GetTopVolume();
+  G4LogicalVolume* motherLogical = motherPhysical->GetLogicalVolume();
+  G4VSolid* motherSolid = motherLogical->GetSolid();
+  G4VPhysicalVolume* samplePhysical = motherLogical->GetDaughter(0);
+  auto pParam = static_cast<G4LatticeParameterisation*>
+                (samplePhysical->GetParameterisation());
+  const G4VSolid* sampleSolid = samplePhysical->GetLogicalVolume()->GetSolid();
+
+  G4double ourStep = currentProposedStepLength, ourSafety;
+  G4double motherSafety, motherStep = DBL_MAX;
+  G4bool motherValidExitNormal = false;
+  G4ThreeVector motherExitNormal;
+
+  // Compute mother safety
+  //
+  motherSafety = motherSolid->DistanceToOut(localPoint);
+  ourSafety = motherSafety;  // Working isotropic safety
+
+  // Exiting normal optimisation
+  //
+  G4int blockedNo = -1;
+  if ( exiting && (*pBlockedPhysical == samplePhysical) && validExitNormal )
+  {
+    if ( localDirection.dot(exitNormal) >= kMinExitingNormalCosine )
+    {
+      // Block exited cell; must be on boundary => zero safety
+      //
+      blockedNo = blockedReplicaNo;
+      ourSafety = 0;
+    }
+  }
+  exiting = false;
+  entering = false;
+
+  if ( ourSafety > 0 )
+  {
+    ourSafety = ComputeCellSafety(localPoint, pParam, sampleSolid, ourSafety);
+  }
+  if ( currentProposedStepLength < ourSafety )
+  {
+    // Guaranteed physics limited
+    //
+    *pBlockedPhysical = nullptr;
+    newSafety = ourSafety;
+    return kInfinity;
+  }
+
+  // Intersection with the mother solid, bounding the search of the cells
+  //
+  if ( motherSafety <= ourStep )
+  {
+    motherStep = motherSolid->DistanceToOut(localPoint, localDirection, true,
+                                            &motherValidExitNormal,
+                                            &motherExitNormal);
+    if ( (motherStep >= kInfinity) || (motherStep < 0.0) )
+    {
+      // Error - indication of being outside solid !!
+      //
+      exiting = true;
+      validExitNormal = false;
+      *pBlockedPhysical = nullptr;
+      blockedReplicaNo = 0;
+      newSafety = 0.0;
+      return 0.0;
+    }
+  }
+
+  // Visit the cells crossed by the direction, in order of distance,
+  // until the next cell is entered beyond the shortest step found
+  //
+  G4ThreeVector latticeMin(pParam->GetMinExtent(0), pParam->GetMinExtent(1),
+                           pParam->GetMinExtent(2));
+  G4ThreeVector latticeMax(pParam->GetMaxExtent(0), pParam->GetMaxExtent(1),
+                           pParam->GetMaxExtent(2));
+  G4ThreeVector tol(kCarTolerance, kCarTolerance, kCarTolerance);
+  G4double tEnter, tExit;
+  if ( IntersectBox(localPoint, localDirection, latticeMin - tol,
+                    latticeMax + tol, tEnter, tExit)
+    && (tEnter <= ourStep) && (tEnter <= motherStep) )
+  {
+    const G4ThreeVector solidMin = pParam->GetSolidMin() - tol;
+    const G4ThreeVector solidMax = pParam->GetSolidMax() + tol;
+    G4double t = (tEnter > 0.) ? tEnter : G4double(0.);
+    G4int idx[3], idxStep[3];
+    G4double tNext[3], tDelta[3];
+    for (auto i=0; i<3; ++i)
+    {
+      const G4int n = pParam->GetNoCells(i);
+      idx[i] = pParam->GetCellIndex(localPoint(i) + t*localDirection(i), i);
+      if ( idx[i] < 0 )  { idx[i] = 0; }
+      if ( idx[i] >= n )  { idx[i] = n-1; }
+      if ( localDirection(i) > 0. )
+      {
+        idxStep[i] = 1;
+        tNext[i] = (pParam->GetMinExtent(i) + (idx[i]+1)*pParam->GetPitch(i)
+                   - localPoint(i)) / localDirection(i);
+        tDelta[i] = pParam->GetPitch(i) / localDirection(i);
+      }
+      else if ( localDirection(i) < 0. )
+      {
+        idxStep[i] = -1;
+        tNext[i] = (pParam->GetMinExtent(i) + idx[i]*pParam->GetPitch(i)
+                   - localPoint(i)) / localDirection(i);
+        tDelta[i] = -pParam->GetPitch(i) / localDirection(i);
+      }
+      else
+      {
+        idxStep[i] = 0;
+        tNext[i] = kInfinity;
+        tDelta[i] = kInfinity;
+      }
+    }
+
+    for (;;)
+    {
+      G4int copyNo = pParam->GetCopyNo(idx[0], idx[1], idx[2]);
+      if ( copyNo != blockedNo )
+      {
+        const G4ThreeVector samplePoint = localPoint
+          - G4ThreeVector(pParam->GetCellCentre(idx[0], 0),
+                          pParam->GetCellCentre(idx[1], 1),
+                          pParam->GetCellCentre(idx[2], 2));
+        G4double tmin, tmax;
+        if ( IntersectBox(samplePoint, localDirection, solidMin, solidMax,
+                          tmin, tmax) && (tmin <= ourStep) )
+        {
+          const G4double sampleStep =
+            sampleSolid->DistanceToIn(samplePoint, localDirection);
+          if ( sampleStep <= ourStep )
+          {
+            ourStep = sampleStep;
+            entering = true;
+            *pBlockedPhysical = samplePhysical;
+            blockedReplicaNo = copyNo;
+          }
+        }
+      }
+
+      // Move to the next cell along the direction
+      //
+      G4int axis = (tNext[0] < tNext[1]) ? 0 : 1;
+      if ( tNext[2] < tNext[axis] )  { axis = 2; }
+      t = tNext[axis];
+      if ( (t - kCarTolerance > ourStep) || (t - kCarTolerance > motherStep) )
+      {
+        break;
+      }
+      idx[axis] += idxStep[axis];
+      if ( (idx[axis] < 0) || (idx[axis] >= pParam->GetNoCells(axis)) )
+      {
+        break;
+      }
+      tNext[axis] += tDelta[axis];
+    }
+  }
+
+  // Consider intersection with mother solid
+  //
+  if ( motherSafety <= ourStep )
+  {
+    if ( motherStep <= ourStep )
+    {
+      ourStep = motherStep;
+      exiting = true;
+      entering = false;
+      validExitNormal = motherValidExitNormal;
+      exitNormal = motherExitNormal;
+
+      if ( motherValidExitNormal )
+      {
+        const G4RotationMatrix* rot = motherPhysical->GetRotation();
+        if ( rot != nullptr )
+        {
+          exitNormal *= rot->inverse();
+        }
+      }
+    }
+    else
+    {
+      validExitNormal = false;
+    }
+  }
+  newSafety = ourSafety;
+  return ourStep;
+}
+
+// ********************************************************************
+// ComputeSafety
+// ********************************************************************
+//
+G4double
+G4LatticeNavigation::ComputeSafety( const G4ThreeVector& localPoint,
+                                    const G4NavigationHistory& history,
+                                    const G4double )
+{
+  G4LogicalVolume* motherLogical = history.GetTopVolume()->GetLogicalVolume();
+  G4VPhysicalVolume* samplePhysical = motherLogical->GetDaughter(0);
+  auto pParam = static_cast<G4LatticeParameterisation*>
+                (samplePhysical->GetParameterisation());
+
+  // Compute mother safety, then the cells one
+  //
+  G4double ourSafety = motherLogical->GetSolid()->DistanceToOut(localPoint);
+  if ( ourSafety > 0 )
+  {
+    ourSafety = ComputeCellSafety(localPoint, pParam,
+                  samplePhysical->GetLogicalVolume()->GetSolid(), ourSafety);
+  }
+  return ourSafety;
+}
+
+// ********************************************************************
+// PlaceCell
+// ********************************************************************
+//
+void G4LatticeNavigation::PlaceCell( G4VPhysicalVolume* pPhysical,
+                                     G4int copyNo ) const
+{
+  G4VPVParameterisation* pParam = pPhysical->GetParameterisation();
+  pParam->ComputeTransformation(copyNo, pPhysical);
+  pPhysical->SetCopyNo(copyNo);
+  pPhysical->GetLogicalVolume()
+           ->UpdateMaterial(pParam->ComputeMaterial(copyNo, pPhysical));
+}
+
+// ********************************************************************
+// ComputeCellSafety
+// ********************************************************************
+//
+G4double G4LatticeNavigation::
+ComputeCellSafety( const G4ThreeVector& localPoint,
+                   const G4LatticeParameterisation* pParam,
+                   const G4VSolid* pSolid,
+                         G4double limit ) const
+{
+  const G4ThreeVector& solidMin = pParam->GetSolidMin();
+  const G4ThreeVector& solidMax = pParam->GetSolidMax();
+  G4double safety = limit;
+
+  // All the cell solids lie within the extent of the lattice
+  // reduced by the gaps at its border
+  //
+  G4ThreeVector regionMin, regionMax;
+  for (auto i=0; i<3; ++i)
+  {
+    regionMin[i] = pParam->GetCellCentre(0, i) + solidMin(i);
+    regionMax[i] = pParam->GetCellCentre(pParam->GetNoCells(i)-1, i)
+                 + solidMax(i);
+  }
+  if ( DistanceToBox(localPoint, regionMin, regionMax) >= safety )
+  {
+    return safety;
+  }
+
+  // Cells nearest to the point and their neighbours
+  //
+  G4int ilo[3], ihi[3];
+  for (auto i=0; i<3; ++i)
+  {
+    const G4int n = pParam->GetNoCells(i);
+    G4int ic = pParam->GetCellIndex(localPoint(i), i);
+    if ( ic < 0 )  { ic = 0; }
+    if ( ic >= n )  { ic = n-1; }
+    ilo[i] = (ic > 0) ? ic-1 : 0;
+    ihi[i] = (ic < n-1) ? ic+1 : n-1;
+  }
+  for (auto iz=ilo[2]; iz<=ihi[2]; ++iz)
+  {
+    for (auto iy=ilo[1]; iy<=ihi[1]; ++iy)
+    {
+      for (auto ix=ilo[0]; ix<=ihi[0]; ++ix)
+      {
+        const G4ThreeVector samplePoint = localPoint
+          - G4ThreeVector(pParam->GetCellCentre(ix, 0),
+                          pParam->GetCellCentre(iy, 1),
+                          pParam->GetCellCentre(iz, 2));
+        if ( DistanceToBox(samplePoint, solidMin, solidMax) < safety )
+        {
+          const G4double sampleSafety = pSolid->DistanceToIn(samplePoint);
+          if ( sampleSafety < safety )  { safety = sampleSafety; }
+        }
+      }
+    }
+  }
+
+  // Cells beyond these are farther than the next row along each axis
+  //
+  for (auto i=0; i<3; ++i)
+  {
+    if ( ilo[i] > 0 )
+    {
+      const G4double dist = localPoint(i)
+        - (pParam->GetCellCentre(ilo[i]-1, i) + solidMax(i));
+      if ( dist < safety )  { safety = dist; }
+    }
+    if ( ihi[i] < pParam->GetNoCells(i)-1 )
+    {
+      const G4double dist = pParam->GetCellCentre(ihi[i]+1, i) + solidMin(i)
+                          - localPoint(i);
+      if ( dist < safety )  { safety = dist; }
+    }
+  }
+  return (safety > 0.) ? safety : G4double(0.);
+}
+
+// ********************************************************************
+// DistanceToBox
+// ********************************************************************
+//
+G4double
+G4LatticeNavigation::DistanceToBox( const G4ThreeVector& p,
+                                    const G4ThreeVector& bmin,
+                                    const G4ThreeVector& bmax ) const
+{
+  G4double dist2 = 0.;
+  for (auto i=0; i<3; ++i)
+  {
+    if ( p(i) < bmin(i) )
+    {
+      dist2 += (bmin(i) - p(i))*(bmin(i) - p(i));
+    }
+    else if ( p(i) > bmax(i) )
+    {
+      dist2 += (p(i) - bmax(i))*(p(i) - bmax(i));
+    }
+  }
+  return std::sqrt(dist2);
+}
+
+// ********************************************************************
+// IntersectBox
+// ********************************************************************
+//
+G4bool
+G4LatticeNavigation::IntersectBox( const G4ThreeVector& p,
+                                   const G4ThreeVector& v,
+                                   const G4ThreeVector& bmin,
+                                   const G4ThreeVector& bmax,
+                                         G4double& tmin,
+                                         G4double& tmax ) const
+{
+  tmin = -kInfinity;
+  tmax = kInfinity;
+  for (auto i=0; i<3; ++i)
+  {
+    if ( v(i) != 0. )
+    {
+      G4double t1 = (bmin(i) - p(i)) / v(i);
+      G4double t2 = (bmax(i) - p(i)) / v(i);
+      if ( t1 > t2 )  { std::swap(t1, t2); }
+      if ( t1 > tmin )  { tmin = t1; }
+      if ( t2 < tmax )  { tmax = t2; }
+    }
+    else if ( (p(i) < bmin(i)) || (p(i) > bmax(i)) )
+    {
+      return false;
+    }
+  }
+  return (tmin <= tmax) && (tmax >= 0.);
+}
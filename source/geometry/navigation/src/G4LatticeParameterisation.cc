@@ -0,0 +1,130 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// class G4LatticeParameterisation implementation
+//
+// --------------------------------------------------------------------
+
+#include "G4LatticeParameterisation.hh"
+
+#include "G4VSolid.hh"
+#include "G4LogicalVolume.hh"
+#include "G4PVParameterised.hh"
+#include "G4GeometryTolerance.hh"
+
+// --------------------------------------------------------------------
+G4LatticeParameterisation::
+G4LatticeParameterisation( G4int nx, G4int ny, G4int nz,
+                     const G4ThreeVector& pitch,
+                     const G4ThreeVector& centre )
+  : fCentre(centre)
+{
+  const G4int noCells[3] = { nx, ny, nz };
+  for (auto i=0; i<3; ++i)
+  {
+    if ( (noCells[i] < 1) || (pitch(i) <= 0.) )
+    {
+      std::ostringstream message;
+      message << "Invalid lattice definition !" << G4endl
+              << "        Number of cells: " << nx << " x " << ny
+              << " x " << nz << ", pitch: " << pitch << G4endl
+              << "        Cells must be at least one per axis,"
+              << " with positive pitch.";
+      G4Exception("G4LatticeParameterisation::G4LatticeParameterisation()",
+                  "GeomNav0002", FatalErrorInArgument, message);
+      return;
+    }
+    fNoCells[i] = noCells[i];
+    fPitch[i] = pitch(i);
+    fMin[i] = centre(i) - 0.5*noCells[i]*pitch(i);
+  }
+  fSolidMax = 0.5*pitch;
+  fSolidMin = -fSolidMax;
+}
+
+// --------------------------------------------------------------------
+G4LatticeParameterisation::~G4LatticeParameterisation()
+{
+}
+
+// --------------------------------------------------------------------
+void G4LatticeParameterisation::
+ComputeTransformation( const G4int copyNo, G4VPhysicalVolume* pPhysical ) const
+{
+  pPhysical->SetTranslation( GetCellCentre(copyNo) );
+  pPhysical->SetRotation( nullptr );
+}
+
+// --------------------------------------------------------------------
+G4PVParameterised* G4LatticeParameterisation::
+Place( const G4String& pName, G4LogicalVolume* pCellLogical,
+                              G4LogicalVolume* pMotherLogical )
+{
+  if ( pMotherLogical->GetNoDaughters() != 0 )
+  {
+    std::ostringstream message;
+    message << "Lattice " << pName << " cannot be placed !" << G4endl
+            << "        Mother volume " << pMotherLogical->GetName()
+            << " has already " << pMotherLogical->GetNoDaughters()
+            << " daughter(s): a lattice must be its only daughter.";
+    G4Exception("G4LatticeParameterisation::Place()",
+                "GeomNav0002", FatalErrorInArgument, message);
+    return nullptr;
+  }
+
+  // The solid must fit in its cell, so that the cells crossed by a
+  // direction or containing a point can be found arithmetically
+  //
+  const G4double tol =
+    G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+  G4ThreeVector pMin, pMax;
+  pCellLogical->GetSolid()->BoundingLimits(pMin, pMax);
+  for (auto i=0; i<3; ++i)
+  {
+    if ( (pMin(i) < -0.5*fPitch[i] - tol) || (pMax(i) > 0.5*fPitch[i] + tol) )
+    {
+      std::ostringstream message;
+      message << "Cell solid does not fit in a lattice cell !" << G4endl
+              << "        Solid " << pCellLogical->GetSolid()->GetName()
+              << " extends from " << pMin << " to " << pMax << G4endl
+              << "        while the cell spans half-pitch "
+              << G4ThreeVector(0.5*fPitch[0], 0.5*fPitch[1], 0.5*fPitch[2])
+              << " about its centre.";
+      G4Exception("G4LatticeParameterisation::Place()",
+                  "GeomNav0002", FatalErrorInArgument, message);
+      return nullptr;
+    }
+  }
+  fSolidMin = pMin;
+  fSolidMax = pMax;
+
+  auto pPhysical = new G4PVParameterised(pName, pCellLogical, pMotherLogical,
+                                         kUndefined, GetNoCells(), this);
+  pPhysical->SetRegularStructureId(2);
+
+  return pPhysical;
+}
@@ -108,14 +108,33 @@ G4double G4MultiNavigator::ComputeStep(const G4ThreeVector& pGlobalPoint,
   G4ThreeVector initialPosition = pGlobalPoint;
   G4ThreeVector initialDirection= pDirection;
 
+  // In fused mode the safeties of the last call, shifted to the new
+  // point, are used to skip geometries which cannot limit the step
+  //
+  G4double stepLimit = proposedStepLength;
+  G4double shift = fFusedStepping
+                 ? (initialPosition - fPreStepLocation).mag() : kInfinity;
+
   for( auto num=0; num< fNoActiveNavigators; ++pNavigatorIter,++num )
   {
      safety= kInfinity;
 
-     step= (*pNavigatorIter)->ComputeStep( initialPosition, 
-                                           initialDirection,
-                                           proposedStepLength,
-                                           safety ); 
+     if( fFusedStepping && (stepLimit <= fNewSafety[num] - shift) )
+     {
+       step = kInfinity;   // The step is guaranteed to be taken
+       safety = fNewSafety[num] - shift;
+     }
+     else
+     {
+       step= (*pNavigatorIter)->ComputeStep( initialPosition, 
+                                             initialDirection,
+                                             stepLimit,
+                                             safety ); 
+       if( fFusedStepping && (step + kCarTolerance < stepLimit) )
+       {
+         stepLimit = step + kCarTolerance;
+       }
+     }
      if( safety < minSafety ){ minSafety = safety; } 
      if( step < minStep )    { minStep= step; } 
 
@@ -274,6 +293,7 @@ void G4MultiNavigator::PrepareNavigators()
      fLimitTruth[num] = false;
      fLimitedStep[num] = kDoNot;
      fCurrentStepSize[num] = 0.0; 
+     fNewSafety[num] = -1.0; 
      fLocatedVolume[num] = nullptr; 
   }
   fWasLimitedByGeometry = false; 
@@ -41,6 +41,7 @@
 #include "G4VPhysicalVolume.hh"
 
 #include "G4VoxelSafety.hh"
+#include "G4SafetyGrid.hh"
 
 // Constant determining how precise normals should be (how close to unit
 // vectors). If exceeded, warnings will be issued.
@@ -268,6 +269,13 @@ G4Navigator::LocateGlobalPointAndSetup( const G4ThreeVector& globalPoint,
                                   fBlockedPhysicalVolume, 
                                   &parentTouchable));
               }
+              else if( fBlockedPhysicalVolume->GetRegularStructureId() == 2 )
+              {
+                flatticeNav.PlaceCell(fBlockedPhysicalVolume,
+                                      fBlockedReplicaNo);
+                fHistory.NewLevel(fBlockedPhysicalVolume, kParameterised,
+                                  fBlockedReplicaNo);
+              }
               break;
             case kExternal:
               G4Exception("G4Navigator::LocateGlobalPointAndSetup()",
@@ -496,7 +504,17 @@ G4Navigator::LocateGlobalPointAndSetup( const G4ThreeVector& globalPoint,
                                            localPoint);
         break;
       case kParameterised:
-        if( GetDaughtersRegularStructureId(targetLogical) != 1 )
+        if( GetDaughtersRegularStructureId(targetLogical) == 2 )
+        {
+          noResult = flatticeNav.LevelLocate(fHistory,
+                                             fBlockedPhysicalVolume,
+                                             fBlockedReplicaNo,
+                                             globalPoint,
+                                             pGlobalDirection,
+                                             considerDirection,
+                                             localPoint);
+        }
+        else if( GetDaughtersRegularStructureId(targetLogical) != 1 )
         {
           noResult = fparamNav.LevelLocate(fHistory,
                                            fBlockedPhysicalVolume,
@@ -644,7 +662,8 @@ G4Navigator::LocateGlobalPointWithinVolume(const G4ThreeVector& pGlobalpoint)
          }
          break;
        case kParameterised:
-         if( GetDaughtersRegularStructureId(motherLogical) != 1 )
+         if( (GetDaughtersRegularStructureId(motherLogical) != 1)
+          && (GetDaughtersRegularStructureId(motherLogical) != 2) )
          {
            // Resets state & returns voxel node
            //
@@ -923,7 +942,21 @@ G4double G4Navigator::ComputeStep( const G4ThreeVector& pGlobalpoint,
         }
         break;
       case kParameterised:
-        if( GetDaughtersRegularStructureId(motherLogical) != 1 )
+        if( GetDaughtersRegularStructureId(motherLogical) == 2 )
+        {
+          Step = flatticeNav.ComputeStep(fLastLocatedPointLocal,
+                                         localDirection,
+                                         pCurrentProposedStepLength,
+                                         pNewSafety,
+                                         fHistory,
+                                         fValidExitNormal,
+                                         fExitNormal,
+                                         fExiting,
+                                         fEntering,
+                                         &fBlockedPhysicalVolume,
+                                         fBlockedReplicaNo);
+        }
+        else if( GetDaughtersRegularStructureId(motherLogical) != 1 )
         {
           Step = fparamNav.ComputeStep(fLastLocatedPointLocal,
                                        localDirection,
@@ -1350,6 +1383,11 @@ void G4Navigator::SetupHierarchy()
         G4int replicaNo;
         pParam = current->GetParameterisation();
         replicaNo = fHistory.GetReplicaNo(i);
+        if( current->GetRegularStructureId() == 2 )
+        {
+          flatticeNav.PlaceCell(current, replicaNo);  // Lattice cell
+          break;
+        }
         pSolid = pParam->ComputeSolid(replicaNo, current);
 
         // Set up dimensions & transform in solid/physical volume
@@ -1585,6 +1623,11 @@ G4Navigator::GetMotherToDaughterTransform( G4VPhysicalVolume* pEnteringPhysVol,
         G4LogicalVolume* pLogical = pEnteringPhysVol->GetLogicalVolume();
         pLogical->SetSolid( pSolid );
       }
+      else if( pEnteringPhysVol->GetRegularStructureId() == 2 )
+      {
+        pEnteringPhysVol->GetParameterisation()
+          ->ComputeTransformation(enteringReplicaNo, pEnteringPhysVol);
+      }
       break;
     case kExternal:
       // Expect that nothing is needed to prepare the transformation.
@@ -1880,14 +1923,26 @@ G4double G4Navigator::ComputeSafety( const G4ThreeVector& pGlobalpoint,
     G4VPhysicalVolume* motherPhysical = fHistory.GetTopVolume();
     G4LogicalVolume* motherLogical = motherPhysical->GetLogicalVolume();
     G4SmartVoxelHeader* pVoxelHeader = motherLogical->GetVoxelHeader();
+    G4SafetyGrid* pSafetyGrid = motherLogical->GetSafetyGrid();
     G4ThreeVector localPoint = ComputeLocalPoint(pGlobalpoint);
+    G4double gridSafety = 0.0;
+    if ( pSafetyGrid != nullptr )
+    {
+      gridSafety = pSafetyGrid->GetSafety(localPoint);
+    }
 
     if ( fHistory.GetTopVolumeType() != kReplica )
     {
       switch(CharacteriseDaughters(motherLogical))
       {
         case kNormal:
-          if ( pVoxelHeader )
+          if ( (pSafetyGrid != nullptr) && (gridSafety >= pMaxLength) )
+          {
+            // The precomputed lower bound covers the length of interest
+            //
+            newSafety = gridSafety;
+          }
+          else if ( pVoxelHeader )
           {
             newSafety = fpVoxelSafety->ComputeSafety(localPoint,
                                              *motherPhysical, pMaxLength);
@@ -1899,7 +1954,11 @@ G4double G4Navigator::ComputeSafety( const G4ThreeVector& pGlobalpoint,
           }
           break;
         case kParameterised:
-          if( GetDaughtersRegularStructureId(motherLogical) != 1 )
+          if( GetDaughtersRegularStructureId(motherLogical) == 2 )
+          {
+            newSafety=flatticeNav.ComputeSafety(localPoint,fHistory,pMaxLength);
+          }
+          else if( GetDaughtersRegularStructureId(motherLogical) != 1 )
           {
             newSafety=fparamNav.ComputeSafety(localPoint,fHistory,pMaxLength);
           }
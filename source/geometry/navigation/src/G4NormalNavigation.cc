@@ -34,6 +34,7 @@
 #include "G4NormalNavigation.hh"
 #include "G4NavigationLogger.hh"
 #include "G4AffineTransform.hh"
+#include "G4SolidEnvelope.hh"
 
 // ********************************************************************
 // Constructor
@@ -167,10 +168,14 @@ G4NormalNavigation::ComputeStep(const G4ThreeVector& localPoint,
                                  samplePhysical->GetTranslation());
       sampleTf.Invert();
       const G4ThreeVector samplePoint = sampleTf.TransformPoint(localPoint);
-      const G4VSolid *sampleSolid =
-              samplePhysical->GetLogicalVolume()->GetSolid();
-      const G4double sampleSafety =
-              sampleSolid->DistanceToIn(samplePoint);
+      const G4LogicalVolume* sampleLogical =
+              samplePhysical->GetLogicalVolume();
+      const G4VSolid *sampleSolid = sampleLogical->GetSolid();
+      const G4SolidEnvelope* sampleEnvelope =
+              sampleLogical->GetSolidEnvelope();
+      const G4double sampleSafety = (sampleEnvelope == nullptr)
+              ? sampleSolid->DistanceToIn(samplePoint)
+              : sampleEnvelope->DistanceToIn(sampleSolid, samplePoint);
 
       if ( sampleSafety<ourSafety )
       {
@@ -180,8 +185,10 @@ G4NormalNavigation::ComputeStep(const G4ThreeVector& localPoint,
       if ( sampleSafety<=ourStep )
       {
         sampleDirection = sampleTf.TransformAxis(localDirection);
-        const G4double sampleStep =
-                sampleSolid->DistanceToIn(samplePoint,sampleDirection);
+        const G4double sampleStep = (sampleEnvelope == nullptr)
+                ? sampleSolid->DistanceToIn(samplePoint,sampleDirection)
+                : sampleEnvelope->DistanceToIn(sampleSolid, samplePoint,
+                                               sampleDirection, ourStep);
 #ifdef G4VERBOSE        
         if( fCheck )
         {
@@ -368,10 +375,14 @@ G4double G4NormalNavigation::ComputeSafety(const G4ThreeVector& localPoint,
     sampleTf.Invert();
     const G4ThreeVector samplePoint =
             sampleTf.TransformPoint(localPoint);
-    const G4VSolid *sampleSolid =
-            samplePhysical->GetLogicalVolume()->GetSolid();
-    const G4double sampleSafety =
-            sampleSolid->DistanceToIn(samplePoint);
+    const G4LogicalVolume* sampleLogical =
+            samplePhysical->GetLogicalVolume();
+    const G4VSolid *sampleSolid = sampleLogical->GetSolid();
+    const G4SolidEnvelope* sampleEnvelope =
+            sampleLogical->GetSolidEnvelope();
+    const G4double sampleSafety = (sampleEnvelope == nullptr)
+            ? sampleSolid->DistanceToIn(samplePoint)
+            : sampleEnvelope->DistanceToIn(sampleSolid, samplePoint);
     if ( sampleSafety<ourSafety )
     {
       ourSafety = sampleSafety;
@@ -77,6 +77,7 @@ G4PathFinder::G4PathFinder()
   : fEndState( G4ThreeVector(), G4ThreeVector(), 0., 0., 0., 0., 0.)
 {
    fpMultiNavigator = new G4MultiNavigator(); 
+   fpMultiNavigator->SetFusedStepping( fFusedStepping );
 
    fpTransportManager= G4TransportationManager::GetTransportationManager();
    fpFieldPropagator = fpTransportManager->GetPropagatorInField();
@@ -431,6 +432,21 @@ G4PathFinder::PrepareNewTrack( const G4ThreeVector& position,
 }
 
 
+G4double G4PathFinder::ObtainEndPointSafety( G4int navId )
+{
+  // The endpoint is at most fTrueMinStep away from the pre-step point,
+  // so the shrunk pre-step safety sphere is still a valid estimate
+
+  if( fFusedStepping )
+  {
+    G4double safety = fCurrentPreStepSafety[navId] - fTrueMinStep;
+    if( safety > 0.0 )  { return safety; }
+  }
+  return GetNavigator(navId)->ComputeSafety( fEndState.GetPosition() );
+}
+
+// ----------------------------------------------------------------------------
+//
 void G4PathFinder::EndTrack()
   // Signal end of tracking of current track.  
   // Reset TransportationManager to use 'ordinary' Navigator.
@@ -838,15 +854,9 @@ G4PathFinder::DoNextLinearStep( const G4FieldTrack& initialState,
 
   MagShift= std::sqrt(MagSqShift) ;
 
-#ifdef G4PATHFINDER_OPTIMISATION
+  G4double fullSafety = 0.0;  // For all geometries, for prestep point
 
-  G4double fullSafety;  // For all geometries, for prestep point
-
-  if( MagSqShift >= sqr(fPreSafetyMinValue) )
-  {
-     fullSafety = 0.0 ;     
-  }
-  else
+  if( fFusedStepping && (MagSqShift < sqr(fPreSafetyMinValue)) )
   {
      fullSafety = fPreSafetyMinValue - MagShift;
   }
@@ -878,7 +888,6 @@ G4PathFinder::DoNextLinearStep( const G4FieldTrack& initialState,
 #endif
   }
   else
-#endif   // End of G4PATHFINDER_OPTIMISATION 1
   {
      // Move is larger than at least one of the safeties
      //  -> so we must move the safety center!
@@ -888,12 +897,17 @@ G4PathFinder::DoNextLinearStep( const G4FieldTrack& initialState,
 
      minStep = kInfinity;  // Not proposedStepLength; 
 
+     // In fused mode the step proposed to the later navigators is
+     // reduced to the running minimum (plus tolerance, so that shared
+     // boundaries are still identified in WhichLimited())
+     //
+     G4double stepLimit = proposedStepLength;
+
      for( num=0; num< fNoActiveNavigators; ++pNavigatorIter,++num ) 
      {
         safety = std::max( 0.0,  fPreSafetyValues[num] - MagShift); 
 
-#ifdef G4PATHFINDER_OPTIMISATION
-        if( proposedStepLength <= safety )  // Should be just < safety ?
+        if( fFusedStepping && (stepLimit <= safety) )
         {
            // The Step is guaranteed to be taken
 
@@ -908,17 +922,20 @@ G4PathFinder::DoNextLinearStep( const G4FieldTrack& initialState,
 #endif
         }
         else
-#endif   // End of G4PATHFINDER_OPTIMISATION 2
         {
 #ifdef G4DEBUG_PATHFINDER
            G4double previousSafety = safety; 
 #endif
            step = (*pNavigatorIter)->ComputeStep( initialPosition, 
                                                   initialDirection,
-                                                  proposedStepLength,
+                                                  stepLimit,
                                                   safety );
            minStep = std::min(step, minStep);  // OLD ==> can be 'logical'
                                                // value, ie. kInfinity
+           if( fFusedStepping && (step + kCarTolerance < stepLimit) )
+           {
+              stepLimit = step + kCarTolerance;
+           }
            
 #ifdef G4DEBUG_PATHFINDER
            if( fVerboseLevel > 0)
@@ -935,10 +952,6 @@ G4PathFinder::DoNextLinearStep( const G4FieldTrack& initialState,
         }
         fCurrentStepSize[num] = step;   // Raw value - can be kInfinity
 
-           //  TODO: consider whether/how to reduce the proposed step
-           //        to the latest minStep value - to reduce calculations.
-           //        ( If so, much change 1st minimum above. )
-        
         // Save safety value, must be done for all geometries "together"
         // (even if not recomputed using call to ComputeStep)
         // since they share the fPreSafetyLocation
@@ -68,6 +68,7 @@ void G4SafetyHelper::InitialiseHelper()
 {
   fLastSafetyPosition = G4ThreeVector(0.0,0.0,0.0);
   fLastSafety         = 0.0;
+  ClearSafetyCache();
   if (fFirstCall) { InitialiseNavigator(); }
   fFirstCall = false;
 }
@@ -88,8 +89,7 @@ G4SafetyHelper::CheckNextStep(const G4ThreeVector& position,
                                                      direction,
                                                      currentMaxStep,
                                                      newSafety);
-  fLastSafetyPosition = position;
-  fLastSafety         = newSafety;
+  StoreSafety(newSafety, position, true);
 
   // TO-DO: Can replace this with a call to PathFinder 
   //        giving id of Mass Geometry --> this avoid doing the work twice
@@ -101,6 +101,7 @@ G4double G4SafetyHelper::ComputeSafety( const G4ThreeVector& position,
                                               G4double maxLength )
 {
   G4double newSafety;
+  ++fNumberOfRequests;
   
   // Only recompute (calling Navigator/PathFinder) if 'position'
   // is  *not* the safety location and has moved 'significantly'
@@ -108,6 +109,16 @@ G4double G4SafetyHelper::ComputeSafety( const G4ThreeVector& position,
   G4double moveLengthSq = (position-fLastSafetyPosition).mag2();
   if(   (moveLengthSq > 0.0 ) )
   {
+    // A cached sphere guaranteeing the whole radius of interest
+    // is as good as a new computation
+    //
+    G4double cachedSafety = GetCachedSafety(position);
+    if( cachedSafety >= maxLength )
+    {
+      ++fNumberOfHits;
+      return cachedSafety;
+    }
+
     if( !fUseParallelGeometries )
     {
       // Safety for mass geometry
@@ -116,8 +127,7 @@ G4double G4SafetyHelper::ComputeSafety( const G4ThreeVector& position,
       // Only store a 'true' safety - one that was not restricted by maxLength
       if( newSafety < maxLength )
       {
-         fLastSafety= newSafety;
-         fLastSafetyPosition = position;
+        StoreSafety(newSafety, position, true);
       }
     }
     else
@@ -125,8 +135,7 @@ G4double G4SafetyHelper::ComputeSafety( const G4ThreeVector& position,
       // Safety for all geometries
       newSafety = fpPathFinder->ComputeSafety(position);
 
-      fLastSafety= newSafety;
-      fLastSafetyPosition = position;
+      StoreSafety(newSafety, position, false);
     } 
  
   }
@@ -137,11 +146,70 @@ G4double G4SafetyHelper::ComputeSafety( const G4ThreeVector& position,
     // G4double moveLength = 0;
     // if( moveLengthSq > 0.0 ) { moveLength= std::sqrt(moveLengthSq); }
     newSafety = fLastSafety; // -moveLength;
+    ++fNumberOfHits;
   }
   
   return newSafety;
 }
 
+G4double
+G4SafetyHelper::GetCachedSafety( const G4ThreeVector& position ) const
+{
+  // The sphere of radius r around c guarantees r - |p-c| at p
+  //
+  G4double safety = 0.0;
+  for( const auto& sphere : fSafetyCache )
+  {
+    if( sphere.radius <= safety ) continue;
+    if( sphere.massOnly && fUseParallelGeometries ) continue;
+    G4double moveLengthSq = (position - sphere.centre).mag2();
+    if( moveLengthSq >= sqr(sphere.radius - safety) ) continue;
+    safety = sphere.radius - std::sqrt(moveLengthSq);
+  }
+  return safety;
+}
+
+void G4SafetyHelper::StoreSafety( G4double val, const G4ThreeVector& pos,
+                                  G4bool massOnly )
+{
+  fLastSafety         = val;
+  fLastSafetyPosition = pos;
+
+  if( fCacheSize == 0 || val <= 0.0 ) { return; }
+  if( fSafetyCache.size() < fCacheSize )
+  {
+    fSafetyCache.push_back({ pos, val, massOnly });
+  }
+  else
+  {
+    fSafetyCache[fCacheNext] = { pos, val, massOnly };
+  }
+  fCacheNext = (fCacheNext + 1) % fCacheSize;
+}
+
+void G4SafetyHelper::SetSafetyCacheSize( G4int n )
+{
+  fCacheSize = (n > 0) ? std::size_t(n) : 0;
+  ClearSafetyCache();
+}
+
+void G4SafetyHelper::ClearSafetyCache()
+{
+  fSafetyCache.clear();
+  fSafetyCache.reserve(fCacheSize);
+  fCacheNext = 0;
+}
+
+void G4SafetyHelper::PrintStatistics( std::ostream& os ) const
+{
+  G4double rate = (fNumberOfRequests > 0)
+                ? 100.*G4double(fNumberOfHits)/G4double(fNumberOfRequests)
+                : 0.;
+  os << "G4SafetyHelper: " << fNumberOfRequests << " safety requests, "
+     << fNumberOfHits << " answered from cache of " << fCacheSize
+     << " spheres (" << rate << " %)" << G4endl;
+}
+
 void G4SafetyHelper::ReLocateWithinVolume( const G4ThreeVector& newPosition )
 {
 #ifdef G4VERBOSE
@@ -35,6 +35,7 @@
 #include "G4VoxelNavigation.hh"
 #include "G4GeometryTolerance.hh"
 #include "G4VoxelSafety.hh"
+#include "G4SolidEnvelope.hh"
 
 #include "G4AuxiliaryNavServices.hh"
 
@@ -192,10 +193,14 @@ G4VoxelNavigation::ComputeStep( const G4ThreeVector& localPoint,
           sampleTf.Invert();
           const G4ThreeVector samplePoint =
                      sampleTf.TransformPoint(localPoint);
-          const G4VSolid *sampleSolid     =
-                     samplePhysical->GetLogicalVolume()->GetSolid();
-          const G4double sampleSafety     =
-                     sampleSolid->DistanceToIn(samplePoint);
+          const G4LogicalVolume* sampleLogical =
+                     samplePhysical->GetLogicalVolume();
+          const G4VSolid *sampleSolid     = sampleLogical->GetSolid();
+          const G4SolidEnvelope* sampleEnvelope =
+                     sampleLogical->GetSolidEnvelope();
+          const G4double sampleSafety     = (sampleEnvelope == nullptr)
+                     ? sampleSolid->DistanceToIn(samplePoint)
+                     : sampleEnvelope->DistanceToIn(sampleSolid, samplePoint);
 
           if ( sampleSafety<ourSafety )
           {
@@ -204,8 +209,10 @@ G4VoxelNavigation::ComputeStep( const G4ThreeVector& localPoint,
           if ( sampleSafety<=ourStep )
           {
             sampleDirection = sampleTf.TransformAxis(localDirection);
-            G4double sampleStep =
-                     sampleSolid->DistanceToIn(samplePoint, sampleDirection);
+            G4double sampleStep = (sampleEnvelope == nullptr)
+                     ? sampleSolid->DistanceToIn(samplePoint, sampleDirection)
+                     : sampleEnvelope->DistanceToIn(sampleSolid, samplePoint,
+                                                    sampleDirection, ourStep);
 #ifdef G4VERBOSE
             if( fCheck )
             {
@@ -740,8 +747,12 @@ G4VoxelNavigation::ComputeSafety(const G4ThreeVector& localPoint,
                                samplePhysical->GetTranslation());
     sampleTf.Invert();
     const G4ThreeVector samplePoint = sampleTf.TransformPoint(localPoint);
-    const G4VSolid* sampleSolid= samplePhysical->GetLogicalVolume()->GetSolid();
-    G4double sampleSafety = sampleSolid->DistanceToIn(samplePoint);
+    const G4LogicalVolume* sampleLogical = samplePhysical->GetLogicalVolume();
+    const G4VSolid* sampleSolid= sampleLogical->GetSolid();
+    const G4SolidEnvelope* sampleEnvelope = sampleLogical->GetSolidEnvelope();
+    G4double sampleSafety = (sampleEnvelope == nullptr)
+      ? sampleSolid->DistanceToIn(samplePoint)
+      : sampleEnvelope->DistanceToIn(sampleSolid, samplePoint);
     if ( sampleSafety<ourSafety )
     {
       ourSafety = sampleSafety;
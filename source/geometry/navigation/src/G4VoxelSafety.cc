@@ -37,6 +37,7 @@
 #include "G4SmartVoxelProxy.hh"
 #include "G4SmartVoxelNode.hh"
 #include "G4SmartVoxelHeader.hh"
+#include "G4SolidEnvelope.hh"
 
 // ********************************************************************
 // Constructor
@@ -185,7 +186,11 @@ G4VoxelSafety::SafetyForVoxelNode( const G4SmartVoxelNode* curVoxelNode,
         samplePoint = sampleTf.TransformPoint(localPoint);
         ptrSolid = samplePhysical->GetLogicalVolume()->GetSolid();
 
-        sampleSafety = ptrSolid->DistanceToIn(samplePoint);
+        const G4SolidEnvelope* ptrEnvelope =
+          samplePhysical->GetLogicalVolume()->GetSolidEnvelope();
+        sampleSafety = (ptrEnvelope == nullptr)
+                     ? ptrSolid->DistanceToIn(samplePoint)
+                     : ptrEnvelope->DistanceToIn(ptrSolid, samplePoint);
         ourSafety = std::min( sampleSafety, ourSafety ); 
 #ifdef G4VERBOSE
         if(( fCheck ) && ( fVerbose == 1 ))
@@ -44,6 +44,7 @@
 #include "G4Transform3D.hh"
 
 class HepPolyhedronProcessor;
+class G4BooleanTree;
 
 class G4BooleanSolid : public G4VSolid
 {
@@ -92,6 +93,20 @@ class G4BooleanSolid : public G4VSolid
    
     G4ThreeVector GetPointOnSurface() const;
 
+    virtual void BuildOptimisation(G4bool verbose = false);
+    virtual void DeleteOptimisation();
+      // Flatten the tree of Boolean solids into a G4BooleanTree, used by
+      // Inside() and, for unions, DistanceToIn(). Invoked when the geometry
+      // is closed, if the tree has at least GetMinTreePrimitives() primitives.
+      // If verbose, statistics of calls are collected and printed when the
+      // tree is deleted, i.e. when the geometry is opened.
+    inline const G4BooleanTree* GetBooleanTree() const;
+
+    static void SetMinTreePrimitives(G4int n);
+    static G4int GetMinTreePrimitives();
+      // Minimal number of primitives for flattening a Boolean solid
+      // (default 4). A value less or equal to zero disables it.
+
   public:  // without description
 
     G4BooleanSolid(__void__&);
@@ -121,6 +136,9 @@ class G4BooleanSolid : public G4VSolid
     G4double fCubicVolume = -1.0;
       // Stored value of fCubicVolume 
 
+    G4BooleanTree* fTree = nullptr;
+      // Flattened tree, built when the geometry is closed
+
   private:
 
     G4int    fStatistics = 1000000;
@@ -136,6 +154,8 @@ class G4BooleanSolid : public G4VSolid
 
     G4bool  createdDisplacedSolid = false;
       // If & only if this object created it, it must delete it
+
+    static G4int fMinTreePrimitives;
 } ;
 
 #include "G4BooleanSolid.icc"
@@ -0,0 +1,186 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4BooleanTree
+//
+// Class description:
+//
+// Flattened representation of a tree of Boolean solids, built when the
+// geometry is closed and shared read-only by all threads. Constituent
+// solids are stored in a node list with their placements and bounding
+// boxes in the frame of the tree, so that point classification does not
+// descend into sub-trees whose bounding box does not contain the point.
+// Trees made only of unions are in addition voxelised with G4Voxelizer,
+// so that only the primitives overlapping the voxel of the point are
+// considered.
+// Optionally, counts of the calls served by the tree and of the calls
+// to primitives avoided by bounding-box culling are collected.
+
+// 19.10.2026 - First implementation
+// --------------------------------------------------------------------
+#ifndef G4BOOLEANTREE_HH
+#define G4BOOLEANTREE_HH
+
+#include <atomic>
+#include <vector>
+
+#include "G4VSolid.hh"
+#include "G4ThreeVector.hh"
+#include "G4Transform3D.hh"
+#include "G4AffineTransform.hh"
+#include "G4Voxelizer.hh"
+
+class G4BooleanTree
+{
+  public:
+
+    G4BooleanTree(const G4VSolid* root, G4bool statistics = false);
+      // Flatten the tree of Boolean solids with top node "root".
+   ~G4BooleanTree();
+
+    G4BooleanTree(const G4BooleanTree&) = delete;
+    G4BooleanTree& operator=(const G4BooleanTree&) = delete;
+
+    EInside Inside(const G4ThreeVector& p) const;
+      // Equivalent to root->Inside(p).
+
+    G4double DistanceToIn(const G4ThreeVector& p,
+                          const G4ThreeVector& v) const;
+    G4double DistanceToIn(const G4ThreeVector& p) const;
+      // Distances from outside for trees made only of unions;
+      // the safety may be larger than the one of the original tree,
+      // but it is never larger than the true distance.
+
+    inline G4bool IsUnionOnly() const;
+    inline G4int GetNumberOfNodes() const;
+    inline G4int GetNumberOfPrimitives() const;
+    inline G4int GetDepth() const;
+
+    inline G4bool IsCollectingStatistics() const;
+    void ResetStatistics();
+    std::ostream& StreamStatistics(std::ostream& os) const;
+      // Collected statistics of calls served and primitives culled.
+
+  private:
+
+    enum ENodeType { kPrimitive, kUnion, kSubtraction, kIntersection };
+
+    struct G4BooleanTreeNode
+    {
+      ENodeType type = kPrimitive;
+      G4int left = -1;                  // Child nodes of Boolean nodes
+      G4int right = -1;
+      G4int nprimitives = 1;            // Primitives in the sub-tree
+      const G4VSolid* solid = nullptr;  // Solid, without displacement
+      G4AffineTransform toLocal;        // Tree frame -> solid frame
+      G4AffineTransform toTree;         // Solid frame -> tree frame
+      G4ThreeVector pMin, pMax;         // Bounding box in tree frame
+    };
+
+    G4int AddNode(const G4VSolid* solid, const G4Transform3D& placement,
+                  G4int depth);
+      // Recursively add node and its children; return the node index.
+
+    void VoxelisePrimitives();
+
+    EInside InsideNode(G4int inode, const G4ThreeVector& p) const;
+    EInside InsideUnion(const G4ThreeVector& p) const;
+    G4ThreeVector NormalNode(G4int inode, const G4ThreeVector& p) const;
+
+    inline G4bool InBox(const G4BooleanTreeNode& node,
+                        const G4ThreeVector& p) const;
+    G4double DistanceToBox(const G4BooleanTreeNode& node,
+                           const G4ThreeVector& p,
+                           const G4ThreeVector& v) const;
+    G4double SafetyToBox(const G4BooleanTreeNode& node,
+                         const G4ThreeVector& p) const;
+    inline void Count(std::atomic<G4long>& counter, G4long n = 1) const;
+
+  private:
+
+    std::vector<G4BooleanTreeNode> fNodes;
+    std::vector<G4int> fPrimitives;          // Node indices of primitives
+    std::vector<G4Transform3D> fPlacements;  // Placements of primitives
+    G4Voxelizer fVoxels;                     // Used only for union trees
+    const G4VSolid* fRoot = nullptr;
+    G4int fDepth = 0;
+    G4bool fUnionOnly = true;
+    G4bool fStatistics = false;
+    G4double kCarTolerance;
+    G4double kRadTolerance;
+
+    mutable std::atomic<G4long> fInsideCalls{0};
+    mutable std::atomic<G4long> fDistanceCalls{0};
+    mutable std::atomic<G4long> fSafetyCalls{0};
+    mutable std::atomic<G4long> fPrimitiveCalls{0};
+    mutable std::atomic<G4long> fPrimitivesCulled{0};
+};
+
+// --------------------------------------------------------------------
+// Inline methods
+// --------------------------------------------------------------------
+
+inline G4bool G4BooleanTree::IsUnionOnly() const
+{
+  return fUnionOnly;
+}
+
+inline G4int G4BooleanTree::GetNumberOfNodes() const
+{
+  return G4int(fNodes.size());
+}
+
+inline G4int G4BooleanTree::GetNumberOfPrimitives() const
+{
+  return G4int(fPrimitives.size());
+}
+
+inline G4int G4BooleanTree::GetDepth() const
+{
+  return fDepth;
+}
+
+inline G4bool G4BooleanTree::IsCollectingStatistics() const
+{
+  return fStatistics;
+}
+
+inline G4bool G4BooleanTree::InBox(const G4BooleanTreeNode& node,
+                                   const G4ThreeVector& p) const
+{
+  return p.x() >= node.pMin.x() && p.x() <= node.pMax.x()
+      && p.y() >= node.pMin.y() && p.y() <= node.pMax.y()
+      && p.z() >= node.pMin.z() && p.z() <= node.pMax.z();
+}
+
+inline void G4BooleanTree::Count(std::atomic<G4long>& counter,
+                                 G4long n) const
+{
+  if (fStatistics) { counter.fetch_add(n, std::memory_order_relaxed); }
+}
+
+#endif
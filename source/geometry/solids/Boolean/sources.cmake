@@ -5,6 +5,7 @@ geant4_add_module(G4geomBoolean
   PUBLIC_HEADERS
     G4BooleanSolid.hh
     G4BooleanSolid.icc
+    G4BooleanTree.hh
     G4DisplacedSolid.hh
     G4IntersectionSolid.hh
     G4MultiUnion.hh
@@ -13,6 +14,7 @@ geant4_add_module(G4geomBoolean
     G4UnionSolid.hh
   SOURCES
     G4BooleanSolid.cc
+    G4BooleanTree.cc
     G4DisplacedSolid.cc
     G4IntersectionSolid.cc
     G4MultiUnion.cc
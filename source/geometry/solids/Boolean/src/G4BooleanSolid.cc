@@ -32,6 +32,7 @@
 // --------------------------------------------------------------------
 
 #include "G4BooleanSolid.hh"
+#include "G4BooleanTree.hh"
 #include "G4VSolid.hh"
 #include "G4DisplacedSolid.hh"
 #include "G4ReflectedSolid.hh"
@@ -47,6 +48,8 @@ namespace
   G4RecursiveMutex polyhedronMutex = G4MUTEX_INITIALIZER;
 }
 
+G4int G4BooleanSolid::fMinTreePrimitives = 4;
+
 //////////////////////////////////////////////////////////////////
 //
 // Constructor
@@ -108,6 +111,7 @@ G4BooleanSolid::~G4BooleanSolid()
     ((G4DisplacedSolid*)fPtrSolidB)->CleanTransformations();
   }
   delete fpPolyhedron; fpPolyhedron = nullptr;
+  delete fTree; fTree = nullptr;
 }
 
 ///////////////////////////////////////////////////////////////
@@ -148,6 +152,7 @@ G4BooleanSolid& G4BooleanSolid::operator = (const G4BooleanSolid& rhs)
   fRebuildPolyhedron = false;
   delete fpPolyhedron; fpPolyhedron = nullptr;
   fPrimitives.resize(0); fPrimitivesSurfaceArea = 0.;
+  delete fTree; fTree = nullptr;
 
   return *this;
 }  
@@ -425,3 +430,60 @@ G4double G4BooleanSolid::GetCubicVolume()
   }
   return fCubicVolume;
 }
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Flatten the tree of Boolean solids, if deep enough. Since the same
+// solid may be shared by several logical volumes, an existing tree is
+// kept as it is.
+
+void G4BooleanSolid::BuildOptimisation(G4bool verbose)
+{
+  if (fTree != nullptr || fMinTreePrimitives <= 0) { return; }
+
+  G4GeometryType type = GetEntityType();
+  if (type != "G4UnionSolid"        &&
+      type != "G4SubtractionSolid"  &&
+      type != "G4IntersectionSolid") { return; }
+
+  std::vector<std::pair<G4VSolid*,G4Transform3D>> primitives;
+  GetListOfPrimitives(primitives, G4Transform3D());
+  if (G4int(primitives.size()) < fMinTreePrimitives) { return; }
+
+  fTree = new G4BooleanTree(this, verbose);
+  if (verbose)
+  {
+    G4cout << "G4BooleanSolid::BuildOptimisation(): solid " << GetName()
+           << " flattened into " << fTree->GetNumberOfNodes()
+           << " nodes, " << fTree->GetNumberOfPrimitives()
+           << " primitives, depth " << fTree->GetDepth() << G4endl;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Delete flattened tree, printing statistics if collected
+
+void G4BooleanSolid::DeleteOptimisation()
+{
+  if (fTree == nullptr) { return; }
+  if (fTree->IsCollectingStatistics())
+  {
+    fTree->StreamStatistics(G4cout);
+  }
+  delete fTree; fTree = nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Threshold for flattening Boolean trees
+
+void G4BooleanSolid::SetMinTreePrimitives(G4int n)
+{
+  fMinTreePrimitives = n;
+}
+
+G4int G4BooleanSolid::GetMinTreePrimitives()
+{
+  return fMinTreePrimitives;
+}
@@ -0,0 +1,408 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// Implementation of G4BooleanTree, flattened representation of a tree
+// of Boolean solids
+//
+// 19.10.2026 - First implementation
+// --------------------------------------------------------------------
+
+#include <iomanip>
+
+#include "G4BooleanTree.hh"
+#include "G4DisplacedSolid.hh"
+#include "G4GeometryTolerance.hh"
+#include "G4ios.hh"
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Constructor
+
+G4BooleanTree::G4BooleanTree(const G4VSolid* root, G4bool statistics)
+  : fRoot(root), fStatistics(statistics)
+{
+  kCarTolerance = G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+  kRadTolerance = G4GeometryTolerance::GetInstance()->GetRadialTolerance();
+
+  AddNode(root, G4Transform3D(), 0);
+  if (fUnionOnly) { VoxelisePrimitives(); }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Destructor
+
+G4BooleanTree::~G4BooleanTree()
+{
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Add node to the list, skipping displaced solids. The children of
+// Boolean nodes are added recursively. Returns index of the node
+
+G4int G4BooleanTree::AddNode(const G4VSolid* solid,
+                             const G4Transform3D& placement, G4int depth)
+{
+  G4Transform3D transform = placement;
+  while (solid->GetEntityType() == "G4DisplacedSolid")
+  {
+    const G4DisplacedSolid* displaced = (const G4DisplacedSolid*)solid;
+    transform = transform * G4Transform3D(displaced->GetObjectRotation(),
+                                          displaced->GetObjectTranslation());
+    solid = displaced->GetConstituentMovedSolid();
+  }
+
+  ENodeType type = kPrimitive;
+  G4GeometryType entity = solid->GetEntityType();
+  if      (entity == "G4UnionSolid")        { type = kUnion; }
+  else if (entity == "G4SubtractionSolid")  { type = kSubtraction; }
+  else if (entity == "G4IntersectionSolid") { type = kIntersection; }
+
+  G4int inode = G4int(fNodes.size());
+  fNodes.push_back(G4BooleanTreeNode());
+  fDepth = std::max(fDepth, depth);
+
+  if (type == kPrimitive)
+  {
+    fPrimitives.push_back(inode);
+    fPlacements.push_back(transform);
+  }
+  else
+  {
+    if (type != kUnion) { fUnionOnly = false; }
+    G4int left  = AddNode(solid->GetConstituentSolid(0), transform, depth+1);
+    G4int right = AddNode(solid->GetConstituentSolid(1), transform, depth+1);
+    fNodes[inode].left  = left;
+    fNodes[inode].right = right;
+    fNodes[inode].nprimitives = fNodes[left].nprimitives
+                              + fNodes[right].nprimitives;
+  }
+
+  // Set transformations and the bounding box in the frame of the tree,
+  // enlarged by the tolerance
+  //
+  G4BooleanTreeNode& node = fNodes[inode];
+  node.type  = type;
+  node.solid = solid;
+  node.toTree = G4AffineTransform(transform.getRotation().inverse(),
+                                  transform.getTranslation());
+  node.toLocal = node.toTree.Inverse();
+
+  G4ThreeVector bmin, bmax;
+  solid->BoundingLimits(bmin, bmax);
+  G4double delta = kCarTolerance + 1.e-10*(bmax - bmin).mag();
+  bmin -= G4ThreeVector(delta, delta, delta);
+  bmax += G4ThreeVector(delta, delta, delta);
+
+  node.pMin.set( kInfinity,  kInfinity,  kInfinity);
+  node.pMax.set(-kInfinity, -kInfinity, -kInfinity);
+  for (auto icorner = 0; icorner < 8; ++icorner)
+  {
+    G4ThreeVector corner((icorner & 1) ? bmax.x() : bmin.x(),
+                         (icorner & 2) ? bmax.y() : bmin.y(),
+                         (icorner & 4) ? bmax.z() : bmin.z());
+    corner = node.toTree.TransformPoint(corner);
+    node.pMin.set(std::min(node.pMin.x(), corner.x()),
+                  std::min(node.pMin.y(), corner.y()),
+                  std::min(node.pMin.z(), corner.z()));
+    node.pMax.set(std::max(node.pMax.x(), corner.x()),
+                  std::max(node.pMax.y(), corner.y()),
+                  std::max(node.pMax.z(), corner.z()));
+  }
+  return inode;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Voxelise the primitives of a tree made only of unions
+
+void G4BooleanTree::VoxelisePrimitives()
+{
+  std::vector<G4VSolid*> solids;
+  solids.reserve(fPrimitives.size());
+  for (auto inode : fPrimitives)
+  {
+    solids.push_back(const_cast<G4VSolid*>(fNodes[inode].solid));
+  }
+  fVoxels.Voxelize(solids, fPlacements);
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Classify point, giving the same answer as the Inside() method of the
+// top Boolean solid of the tree
+
+EInside G4BooleanTree::Inside(const G4ThreeVector& p) const
+{
+  Count(fInsideCalls);
+  return (fUnionOnly) ? InsideUnion(p) : InsideNode(0, p);
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Classify point with respect to a node. The rules for combining the
+// answers of the two children are those of G4UnionSolid,
+// G4SubtractionSolid and G4IntersectionSolid
+
+EInside G4BooleanTree::InsideNode(G4int inode, const G4ThreeVector& p) const
+{
+  const G4BooleanTreeNode& node = fNodes[inode];
+  if (!InBox(node, p))
+  {
+    Count(fPrimitivesCulled, node.nprimitives);
+    return kOutside;
+  }
+
+  switch (node.type)
+  {
+    case kPrimitive:
+    {
+      Count(fPrimitiveCalls);
+      return node.solid->Inside(node.toLocal.TransformPoint(p));
+    }
+    case kUnion:
+    {
+      EInside positionA = InsideNode(node.left, p);
+      if (positionA == kInside)  { return positionA; }
+      EInside positionB = InsideNode(node.right, p);
+      if (positionA == kOutside) { return positionB; }
+      if (positionB == kInside)  { return positionB; }
+      if (positionB == kOutside) { return positionA; }
+
+      // Both points are on surface
+      //
+      return ((NormalNode(node.left, p) + NormalNode(node.right, p)).mag2()
+              < 1000*kRadTolerance) ? kInside : kSurface;
+    }
+    case kSubtraction:
+    {
+      EInside positionA = InsideNode(node.left, p);
+      if (positionA == kOutside) { return positionA; }
+      EInside positionB = InsideNode(node.right, p);
+      if (positionB == kOutside) { return positionA; }
+      if (positionB == kInside)  { return kOutside; }
+      if (positionA == kInside)  { return kSurface; }
+
+      // Point is on both surfaces
+      //
+      return ((NormalNode(node.left, p) - NormalNode(node.right, p)).mag2()
+              > 1000*kCarTolerance) ? kSurface : kOutside;
+    }
+    case kIntersection:
+    {
+      EInside positionA = InsideNode(node.left, p);
+      if (positionA == kOutside) { return positionA; }
+      EInside positionB = InsideNode(node.right, p);
+      if (positionA == kInside)  { return positionB; }
+      if (positionB == kOutside) { return positionB; }
+      return kSurface;
+    }
+  }
+  return kOutside;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Classify point for a tree made only of unions, testing only the
+// primitives overlapping the voxel of the point. The point is inside if
+// it is inside any primitive; when it is on the surface of more than one
+// primitive the rules of G4UnionSolid are applied along the tree
+
+EInside G4BooleanTree::InsideUnion(const G4ThreeVector& p) const
+{
+  std::vector<G4int> candidates;
+  G4int ncandidates = fVoxels.GetCandidatesVoxelArray(p, candidates);
+  Count(fPrimitivesCulled, G4int(fPrimitives.size()) - ncandidates);
+
+  G4int nsurface = 0;
+  for (G4int i = 0; i < ncandidates; ++i)
+  {
+    const G4BooleanTreeNode& node = fNodes[fPrimitives[candidates[i]]];
+    Count(fPrimitiveCalls);
+    EInside position = node.solid->Inside(node.toLocal.TransformPoint(p));
+    if (position == kInside) { return kInside; }
+    if (position == kSurface) { ++nsurface; }
+  }
+  if (nsurface == 0) { return kOutside; }
+  if (nsurface == 1) { return kSurface; }
+  return InsideNode(0, p);
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Surface normal of a node, in the frame of the tree
+
+G4ThreeVector
+G4BooleanTree::NormalNode(G4int inode, const G4ThreeVector& p) const
+{
+  const G4BooleanTreeNode& node = fNodes[inode];
+  G4ThreeVector normal =
+    node.solid->SurfaceNormal(node.toLocal.TransformPoint(p));
+  return node.toTree.TransformAxis(normal);
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Distance along the ray to the bounding box of a node,
+// zero if the point is in the box, kInfinity if the ray misses it
+
+G4double G4BooleanTree::DistanceToBox(const G4BooleanTreeNode& node,
+                                      const G4ThreeVector& p,
+                                      const G4ThreeVector& v) const
+{
+  G4double tmin = 0.;
+  G4double tmax = kInfinity;
+  for (auto i = 0; i < 3; ++i)
+  {
+    if (v[i] == 0.)
+    {
+      if (p[i] < node.pMin[i] || p[i] > node.pMax[i]) { return kInfinity; }
+      continue;
+    }
+    G4double invv = 1./v[i];
+    G4double t1 = (node.pMin[i] - p[i])*invv;
+    G4double t2 = (node.pMax[i] - p[i])*invv;
+    if (t1 > t2) { std::swap(t1, t2); }
+    tmin = std::max(tmin, t1);
+    tmax = std::min(tmax, t2);
+    if (tmin > tmax) { return kInfinity; }
+  }
+  return tmin;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Distance from the point to the bounding box of a node
+
+G4double G4BooleanTree::SafetyToBox(const G4BooleanTreeNode& node,
+                                    const G4ThreeVector& p) const
+{
+  G4double dx = std::max(node.pMin.x() - p.x(), p.x() - node.pMax.x());
+  G4double dy = std::max(node.pMin.y() - p.y(), p.y() - node.pMax.y());
+  G4double dz = std::max(node.pMin.z() - p.z(), p.z() - node.pMax.z());
+  G4double dist2 = 0.;
+  if (dx > 0.) { dist2 += dx*dx; }
+  if (dy > 0.) { dist2 += dy*dy; }
+  if (dz > 0.) { dist2 += dz*dz; }
+  return std::sqrt(dist2);
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Distance to in along the ray for a tree made only of unions: the
+// closest intersection with the primitives, skipping those whose
+// bounding box is not hit before the current closest intersection
+
+G4double G4BooleanTree::DistanceToIn(const G4ThreeVector& p,
+                                     const G4ThreeVector& v) const
+{
+  Count(fDistanceCalls);
+  G4double dist = kInfinity;
+  for (auto inode : fPrimitives)
+  {
+    const G4BooleanTreeNode& node = fNodes[inode];
+    if (DistanceToBox(node, p, v) >= dist)
+    {
+      Count(fPrimitivesCulled);
+      continue;
+    }
+    Count(fPrimitiveCalls);
+    G4double distNode =
+      node.solid->DistanceToIn(node.toLocal.TransformPoint(p),
+                               node.toLocal.TransformAxis(v));
+    dist = std::min(dist, distNode);
+  }
+  return dist;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Safety distance from outside for a tree made only of unions: primitives
+// whose bounding box is farther than the current safety are skipped
+
+G4double G4BooleanTree::DistanceToIn(const G4ThreeVector& p) const
+{
+  Count(fSafetyCalls);
+  G4double safety = kInfinity;
+  for (auto inode : fPrimitives)
+  {
+    const G4BooleanTreeNode& node = fNodes[inode];
+    if (SafetyToBox(node, p) >= safety)
+    {
+      Count(fPrimitivesCulled);
+      continue;
+    }
+    Count(fPrimitiveCalls);
+    G4double safetyNode =
+      node.solid->DistanceToIn(node.toLocal.TransformPoint(p));
+    safety = std::min(safety, safetyNode);
+  }
+  return (safety < 0.) ? 0. : safety;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Reset collected statistics
+
+void G4BooleanTree::ResetStatistics()
+{
+  fInsideCalls = 0;
+  fDistanceCalls = 0;
+  fSafetyCalls = 0;
+  fPrimitiveCalls = 0;
+  fPrimitivesCulled = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Stream statistics
+
+std::ostream& G4BooleanTree::StreamStatistics(std::ostream& os) const
+{
+  G4long ncalls  = fPrimitiveCalls.load();
+  G4long nculled = fPrimitivesCulled.load();
+  G4long ntotal  = ncalls + nculled;
+
+  G4long oldprc = os.precision(3);
+  os << "G4BooleanTree for solid " << fRoot->GetName() << ": "
+     << fPrimitives.size() << " primitives, " << fNodes.size()
+     << " nodes, depth " << fDepth
+     << ((fUnionOnly) ? ", voxelised union" : "") << "\n"
+     << "  Calls to Inside(): " << fInsideCalls.load()
+     << ", DistanceToIn(p,v): " << fDistanceCalls.load()
+     << ", DistanceToIn(p): " << fSafetyCalls.load() << "\n"
+     << "  Calls to primitives: " << ncalls
+     << ", avoided by bounding box culling: " << nculled;
+  if (ntotal > 0)
+  {
+    os << " (" << 100.*G4double(nculled)/G4double(ntotal) << " %)";
+  }
+  os << std::endl;
+  os.precision(oldprc);
+  return os;
+}
@@ -33,6 +33,7 @@
 #include <sstream>
 
 #include "G4IntersectionSolid.hh"
+#include "G4BooleanTree.hh"
 
 #include "G4SystemOfUnits.hh"
 #include "G4VoxelLimits.hh"
@@ -198,6 +199,8 @@ G4IntersectionSolid::CalculateExtent(const EAxis pAxis,
 
 EInside G4IntersectionSolid::Inside(const G4ThreeVector& p) const
 {
+  if (fTree != nullptr) { return fTree->Inside(p); }
+
   EInside positionA = fPtrSolidA->Inside(p);
   if(positionA == kOutside) return positionA; // outside A
 
@@ -33,6 +33,7 @@
 // --------------------------------------------------------------------
 
 #include "G4SubtractionSolid.hh"
+#include "G4BooleanTree.hh"
 
 #include "G4SystemOfUnits.hh"
 #include "G4VoxelLimits.hh"
@@ -181,6 +182,8 @@ G4SubtractionSolid::CalculateExtent( const EAxis pAxis,
 
 EInside G4SubtractionSolid::Inside( const G4ThreeVector& p ) const
 {
+  if (fTree != nullptr) { return fTree->Inside(p); }
+
   EInside positionA = fPtrSolidA->Inside(p);
   if (positionA == kOutside) return positionA; // outside A
 
@@ -35,6 +35,7 @@
 #include <sstream>
 
 #include "G4UnionSolid.hh"
+#include "G4BooleanTree.hh"
 
 #include "G4SystemOfUnits.hh"
 #include "G4VoxelLimits.hh"
@@ -228,6 +229,8 @@ G4UnionSolid::CalculateExtent( const EAxis pAxis,
 
 EInside G4UnionSolid::Inside( const G4ThreeVector& p ) const
 {
+  if (fTree != nullptr) { return fTree->Inside(p); }
+
   if (std::max(p.z()-fPMax.z(), fPMin.z()-p.z()) > 0) { return kOutside; }
 
   EInside positionA = fPtrSolidA->Inside(p);
@@ -311,6 +314,11 @@ G4UnionSolid::DistanceToIn( const G4ThreeVector& p,
   }
 #endif
 
+  if (fTree != nullptr && fTree->IsUnionOnly())
+  {
+    return fTree->DistanceToIn(p,v);
+  }
+
   return std::min(fPtrSolidA->DistanceToIn(p,v),
                   fPtrSolidB->DistanceToIn(p,v) ) ;
 }
@@ -336,6 +344,11 @@ G4UnionSolid::DistanceToIn( const G4ThreeVector& p) const
     G4cerr << "          p = " << p << G4endl;
   }
 #endif
+  if (fTree != nullptr && fTree->IsUnionOnly())
+  {
+    return fTree->DistanceToIn(p);
+  }
+
   G4double distA = fPtrSolidA->DistanceToIn(p) ;
   G4double distB = fPtrSolidB->DistanceToIn(p) ;
   G4double safety = std::min(distA,distB) ;
@@ -102,6 +102,16 @@ class G4Orb : public G4CSGSolid
 
     G4double DistanceToOut(const G4ThreeVector& p) const;
 
+    void InsideBatch(G4int n, const G4ThreeVector* p, EInside* inside) const;
+    void DistanceToInBatch(G4int n, const G4ThreeVector* p,
+                           const G4ThreeVector* v, G4double* dist) const;
+    void SafetyToInBatch(G4int n, const G4ThreeVector* p,
+                         G4double* safety) const;
+    void SafetyToOutBatch(G4int n, const G4ThreeVector* p,
+                          G4double* safety) const;
+      // Multi-point versions of the methods above, with the dimensions kept
+      // in local variables.
+
     G4GeometryType GetEntityType() const;
 
     G4ThreeVector GetPointOnSurface() const;
@@ -466,6 +466,64 @@ G4double G4Box::DistanceToOut(const G4ThreeVector& p) const
   return (dist > 0) ? dist : 0.;
 }
 
+////////////////////////////////////////////////////////////////////////////
+//
+// Multi-point versions of Inside(), DistanceToIn() and DistanceToOut(p),
+// with the dimensions of the box kept in local variables
+
+void G4Box::InsideBatch(G4int n, const G4ThreeVector* p,
+                        EInside* inside) const
+{
+  const G4double dx = fDx, dy = fDy, dz = fDz, tol = delta;
+  for (G4int i = 0; i < n; ++i)
+  {
+    G4double dist = std::max(std::max(
+                    std::abs(p[i].x())-dx,
+                    std::abs(p[i].y())-dy),
+                    std::abs(p[i].z())-dz);
+    inside[i] = (dist > tol) ? kOutside :
+      ((dist > -tol) ? kSurface : kInside);
+  }
+}
+
+void G4Box::DistanceToInBatch(G4int n, const G4ThreeVector* p,
+                              const G4ThreeVector* v,
+                              G4double* dist) const
+{
+  for (G4int i = 0; i < n; ++i)
+  {
+    dist[i] = G4Box::DistanceToIn(p[i], v[i]);
+  }
+}
+
+void G4Box::SafetyToInBatch(G4int n, const G4ThreeVector* p,
+                            G4double* safety) const
+{
+  const G4double dx = fDx, dy = fDy, dz = fDz;
+  for (G4int i = 0; i < n; ++i)
+  {
+    G4double dist = std::max(std::max(
+                    std::abs(p[i].x())-dx,
+                    std::abs(p[i].y())-dy),
+                    std::abs(p[i].z())-dz);
+    safety[i] = (dist > 0) ? dist : 0.;
+  }
+}
+
+void G4Box::SafetyToOutBatch(G4int n, const G4ThreeVector* p,
+                             G4double* safety) const
+{
+  const G4double dx = fDx, dy = fDy, dz = fDz;
+  for (G4int i = 0; i < n; ++i)
+  {
+    G4double dist = std::min(std::min(
+                    dx-std::abs(p[i].x()),
+                    dy-std::abs(p[i].y())),
+                    dz-std::abs(p[i].z()));
+    safety[i] = (dist > 0) ? dist : 0.;
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////
 //
 // GetEntityType
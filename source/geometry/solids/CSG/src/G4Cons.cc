@@ -2089,6 +2089,39 @@ G4double G4Cons::DistanceToOut(const G4ThreeVector& p) const
   return safe ;
 }
 
+//////////////////////////////////////////////////////////////////
+//
+// Multi-point versions of Inside(), DistanceToIn() and DistanceToOut(p),
+// calling the methods of this class directly
+
+void G4Cons::InsideBatch(G4int n, const G4ThreeVector* p,
+                         EInside* inside) const
+{
+  for (G4int i = 0; i < n; ++i) { inside[i] = G4Cons::Inside(p[i]); }
+}
+
+void G4Cons::DistanceToInBatch(G4int n, const G4ThreeVector* p,
+                               const G4ThreeVector* v,
+                               G4double* dist) const
+{
+  for (G4int i = 0; i < n; ++i)
+  {
+    dist[i] = G4Cons::DistanceToIn(p[i], v[i]);
+  }
+}
+
+void G4Cons::SafetyToInBatch(G4int n, const G4ThreeVector* p,
+                             G4double* safety) const
+{
+  for (G4int i = 0; i < n; ++i) { safety[i] = G4Cons::DistanceToIn(p[i]); }
+}
+
+void G4Cons::SafetyToOutBatch(G4int n, const G4ThreeVector* p,
+                              G4double* safety) const
+{
+  for (G4int i = 0; i < n; ++i) { safety[i] = G4Cons::DistanceToOut(p[i]); }
+}
+
 //////////////////////////////////////////////////////////////////////////
 //
 // GetEntityType
@@ -401,6 +401,55 @@ G4double G4Orb::DistanceToOut( const G4ThreeVector& p ) const
   return (dist > 0) ? dist : 0.;
 }
 
+//////////////////////////////////////////////////////////////////////////
+//
+// Multi-point versions of Inside(), DistanceToIn() and DistanceToOut(p),
+// with the radius and the tolerant squared radii kept in local variables
+
+void G4Orb::InsideBatch(G4int n, const G4ThreeVector* p,
+                        EInside* inside) const
+{
+  const G4double rrmax = sqrRmaxPlusTol, rrmin = sqrRmaxMinusTol;
+  for (G4int i = 0; i < n; ++i)
+  {
+    G4double rr = p[i].mag2();
+    inside[i] = (rr > rrmax) ? kOutside :
+      ((rr > rrmin) ? kSurface : kInside);
+  }
+}
+
+void G4Orb::DistanceToInBatch(G4int n, const G4ThreeVector* p,
+                              const G4ThreeVector* v,
+                              G4double* dist) const
+{
+  for (G4int i = 0; i < n; ++i)
+  {
+    dist[i] = G4Orb::DistanceToIn(p[i], v[i]);
+  }
+}
+
+void G4Orb::SafetyToInBatch(G4int n, const G4ThreeVector* p,
+                            G4double* safety) const
+{
+  const G4double rmax = fRmax;
+  for (G4int i = 0; i < n; ++i)
+  {
+    G4double dist = p[i].mag() - rmax;
+    safety[i] = (dist > 0) ? dist : 0.;
+  }
+}
+
+void G4Orb::SafetyToOutBatch(G4int n, const G4ThreeVector* p,
+                             G4double* safety) const
+{
+  const G4double rmax = fRmax;
+  for (G4int i = 0; i < n; ++i)
+  {
+    G4double dist = rmax - p[i].mag();
+    safety[i] = (dist > 0) ? dist : 0.;
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////
 //
 // G4EntityType
@@ -2728,6 +2728,39 @@ G4double G4Sphere::DistanceToOut( const G4ThreeVector& p ) const
   return safe;
 }
 
+/////////////////////////////////////////////////////////////////////////
+//
+// Multi-point versions of Inside(), DistanceToIn() and DistanceToOut(p),
+// calling the methods of this class directly
+
+void G4Sphere::InsideBatch(G4int n, const G4ThreeVector* p,
+                           EInside* inside) const
+{
+  for (G4int i = 0; i < n; ++i) { inside[i] = G4Sphere::Inside(p[i]); }
+}
+
+void G4Sphere::DistanceToInBatch(G4int n, const G4ThreeVector* p,
+                                 const G4ThreeVector* v,
+                                 G4double* dist) const
+{
+  for (G4int i = 0; i < n; ++i)
+  {
+    dist[i] = G4Sphere::DistanceToIn(p[i], v[i]);
+  }
+}
+
+void G4Sphere::SafetyToInBatch(G4int n, const G4ThreeVector* p,
+                               G4double* safety) const
+{
+  for (G4int i = 0; i < n; ++i) { safety[i] = G4Sphere::DistanceToIn(p[i]); }
+}
+
+void G4Sphere::SafetyToOutBatch(G4int n, const G4ThreeVector* p,
+                                G4double* safety) const
+{
+  for (G4int i = 0; i < n; ++i) { safety[i] = G4Sphere::DistanceToOut(p[i]); }
+}
+
 //////////////////////////////////////////////////////////////////////////
 //
 // G4EntityType
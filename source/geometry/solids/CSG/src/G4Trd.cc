@@ -672,6 +672,39 @@ G4double G4Trd::DistanceToOut( const G4ThreeVector& p ) const
   return (dist < 0) ? -dist : 0.;
 }
 
+//////////////////////////////////////////////////////////////////////////
+//
+// Multi-point versions of Inside(), DistanceToIn() and DistanceToOut(p),
+// calling the methods of this class directly
+
+void G4Trd::InsideBatch(G4int n, const G4ThreeVector* p,
+                        EInside* inside) const
+{
+  for (G4int i = 0; i < n; ++i) { inside[i] = G4Trd::Inside(p[i]); }
+}
+
+void G4Trd::DistanceToInBatch(G4int n, const G4ThreeVector* p,
+                              const G4ThreeVector* v,
+                              G4double* dist) const
+{
+  for (G4int i = 0; i < n; ++i)
+  {
+    dist[i] = G4Trd::DistanceToIn(p[i], v[i]);
+  }
+}
+
+void G4Trd::SafetyToInBatch(G4int n, const G4ThreeVector* p,
+                            G4double* safety) const
+{
+  for (G4int i = 0; i < n; ++i) { safety[i] = G4Trd::DistanceToIn(p[i]); }
+}
+
+void G4Trd::SafetyToOutBatch(G4int n, const G4ThreeVector* p,
+                             G4double* safety) const
+{
+  for (G4int i = 0; i < n; ++i) { safety[i] = G4Trd::DistanceToOut(p[i]); }
+}
+
 //////////////////////////////////////////////////////////////////////////
 //
 // GetEntityType
@@ -1627,6 +1627,39 @@ G4double G4Tubs::DistanceToOut( const G4ThreeVector& p ) const
   return safe ;
 }
 
+//////////////////////////////////////////////////////////////////////////
+//
+// Multi-point versions of Inside(), DistanceToIn() and DistanceToOut(p),
+// calling the methods of this class directly
+
+void G4Tubs::InsideBatch(G4int n, const G4ThreeVector* p,
+                         EInside* inside) const
+{
+  for (G4int i = 0; i < n; ++i) { inside[i] = G4Tubs::Inside(p[i]); }
+}
+
+void G4Tubs::DistanceToInBatch(G4int n, const G4ThreeVector* p,
+                               const G4ThreeVector* v,
+                               G4double* dist) const
+{
+  for (G4int i = 0; i < n; ++i)
+  {
+    dist[i] = G4Tubs::DistanceToIn(p[i], v[i]);
+  }
+}
+
+void G4Tubs::SafetyToInBatch(G4int n, const G4ThreeVector* p,
+                             G4double* safety) const
+{
+  for (G4int i = 0; i < n; ++i) { safety[i] = G4Tubs::DistanceToIn(p[i]); }
+}
+
+void G4Tubs::SafetyToOutBatch(G4int n, const G4ThreeVector* p,
+                              G4double* safety) const
+{
+  for (G4int i = 0; i < n; ++i) { safety[i] = G4Tubs::DistanceToOut(p[i]); }
+}
+
 //////////////////////////////////////////////////////////////////////////
 //
 // Stream object contents to an output stream
@@ -0,0 +1,255 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration and of QinetiQ Ltd,   *
+// * subject to DEFCON 705 IPR conditions.                            *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+//
+// G4TessellatedMesh
+//
+// Class description:
+//
+//    G4TessellatedMesh is a solid bounded by a closed triangle mesh, meant
+//    for large CAD-imported surfaces. Unlike G4TessellatedSolid, it does
+//    not hold one facet object per face: vertices and triangle indices are
+//    kept in flat arrays, and the triangles are indexed by a bounding volume
+//    hierarchy (BVH) built with the surface area heuristic. Navigation
+//    queries then cost O(log N) without virtual calls per facet.
+//    Inside(), SafetyFromInside() and SafetyFromOutside() are exact, i.e.
+//    the safety is the distance to the closest triangle.
+//
+//    The triangles must be given anti-clockwise as seen from outside, as
+//    for G4TriangularFacet; quadrangles are split into two triangles:
+//
+//      G4TessellatedMesh* mesh = new G4TessellatedMesh("Solid_name");
+//      mesh->Reserve(nVertices, nTriangles);
+//      G4int i0 = mesh->AddVertex(p0);
+//      ...
+//      mesh->AddTriangle(i0, i1, i2);
+//      mesh->AddQuadrangle(i0, i2, i3, i4);
+//      mesh->SetSolidClosed(true);
+//
+//    An existing G4TessellatedSolid can be converted with the constructor
+//    G4TessellatedMesh(const G4TessellatedSolid&).
+
+// 19.10.2026 - First implementation
+// --------------------------------------------------------------------
+#ifndef G4TESSELLATEDMESH_HH
+#define G4TESSELLATEDMESH_HH 1
+
+#include <vector>
+
+#include "G4VSolid.hh"
+
+class G4TessellatedSolid;
+
+class G4TessellatedMesh : public G4VSolid
+{
+  public:  // with description
+
+    G4TessellatedMesh(const G4String& pName);
+    G4TessellatedMesh(const G4TessellatedSolid& solid);
+    virtual ~G4TessellatedMesh();
+
+    // Construction of the mesh
+    void Reserve(G4int nVertices, G4int nTriangles);
+    G4int AddVertex(const G4ThreeVector& p);
+    G4bool AddTriangle(G4int i0, G4int i1, G4int i2);
+    G4bool AddQuadrangle(G4int i0, G4int i1, G4int i2, G4int i3);
+    void SetSolidClosed(G4bool t);
+    inline G4bool GetSolidClosed() const;
+
+    // Accessors
+    inline G4int GetNumberOfVertices() const;
+    inline G4int GetNumberOfTriangles() const;
+    inline G4int GetNumberOfNodes() const;
+    inline const G4ThreeVector& GetVertex(G4int i) const;
+    inline void GetTriangle(G4int i, G4int& i0, G4int& i1, G4int& i2) const;
+
+    // Standard methods
+    void BoundingLimits(G4ThreeVector& pMin, G4ThreeVector& pMax) const;
+    G4bool CalculateExtent(const EAxis pAxis,
+                           const G4VoxelLimits& pVoxelLimit,
+                           const G4AffineTransform& pTransform,
+                                 G4double& pmin, G4double& pmax) const;
+
+    EInside Inside(const G4ThreeVector& p) const;
+    G4ThreeVector SurfaceNormal(const G4ThreeVector& p) const;
+    G4double DistanceToIn(const G4ThreeVector& p,
+                          const G4ThreeVector& v) const;
+    G4double DistanceToIn(const G4ThreeVector& p) const;
+    G4double DistanceToOut(const G4ThreeVector& p,
+                           const G4ThreeVector& v,
+                           const G4bool calcNorm = false,
+                                 G4bool* validNorm = nullptr,
+                                 G4ThreeVector* n = nullptr) const;
+    G4double DistanceToOut(const G4ThreeVector& p) const;
+
+    G4GeometryType GetEntityType() const;
+
+    G4VSolid* Clone() const;
+
+    std::ostream& StreamInfo(std::ostream& os) const;
+
+    G4double GetCubicVolume();
+    G4double GetSurfaceArea();
+
+    G4ThreeVector GetPointOnSurface() const;
+
+    // Methods for visualization
+    void DescribeYourselfTo (G4VGraphicsScene& scene) const;
+    G4VisExtent GetExtent () const;
+    G4Polyhedron* CreatePolyhedron () const;
+    G4Polyhedron* GetPolyhedron () const;
+
+  public:   // without description
+
+    G4TessellatedMesh(__void__&);
+      // Fake default constructor for usage restricted to direct object
+      // persistency for clients requiring preallocation of memory for
+      // persistifiable objects.
+
+    G4TessellatedMesh(const G4TessellatedMesh& rhs);
+    G4TessellatedMesh& operator=(const G4TessellatedMesh& rhs);
+      // Copy constructor and assignment operator.
+
+  private:
+
+    struct G4MeshTriangle
+    {
+      G4ThreeVector fV0, fE1, fE2;  // first vertex and two edges
+      G4ThreeVector fNormal;        // unit outward normal
+    };
+
+    struct G4MeshNode
+    {
+      G4ThreeVector fMin, fMax;     // bounding box of the node
+      G4int fFirst = 0;             // first triangle, or first child
+      G4int fCount = 0;             // number of triangles, 0 if inner node
+    };
+
+    void BuildHierarchy();
+    G4int SplitNode(G4int first, G4int count,
+                    std::vector<G4int>& order,
+                    const std::vector<G4ThreeVector>& centre,
+                    const std::vector<G4ThreeVector>& bmin,
+                    const std::vector<G4ThreeVector>& bmax) const;
+
+    inline G4bool OutsideOfExtent(const G4ThreeVector& p,
+                                        G4double tolerance) const;
+    inline G4double BoxDistance2(const G4MeshNode& node,
+                                 const G4ThreeVector& p) const;
+
+    G4double ClosestTriangle(const G4ThreeVector& p, G4int& itri,
+                             G4bool& interior) const;
+      // Distance to the closest triangle; interior is true if the closest
+      // point is inside the face, i.e. not on an edge or at a vertex
+
+    G4double ClosestPoint(const G4MeshTriangle& tri, const G4ThreeVector& p,
+                          G4bool& interior) const;
+      // Squared distance from p to a triangle
+
+    G4double Intersect(const G4ThreeVector& p, const G4ThreeVector& v,
+                       G4int orientation, G4int& itri, G4bool& edge) const;
+      // Distance along v to the closest triangle crossed in the given
+      // orientation: -1 entering, +1 exiting, 0 any. Returns kInfinity if
+      // no triangle is crossed; edge is set if the crossing is ambiguous
+
+  private:
+
+    G4double halfTolerance = 0.;
+    G4bool fSolidClosed = false;
+
+    std::vector<G4ThreeVector> fVertices;
+    std::vector<G4int> fIndices;          // 3 vertex indices per triangle
+
+    std::vector<G4MeshTriangle> fTriangles;  // in BVH leaf order
+    std::vector<G4MeshNode> fNodes;
+    std::vector<G4double> fCumulArea;        // for GetPointOnSurface()
+
+    G4ThreeVector fMinExtent, fMaxExtent;
+    G4double fCubicVolume = 0.;
+    G4double fSurfaceArea = 0.;
+
+    mutable G4bool fRebuildPolyhedron = false;
+    mutable G4Polyhedron* fpPolyhedron = nullptr;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Inlined Methods
+///////////////////////////////////////////////////////////////////////////////
+
+inline G4bool G4TessellatedMesh::GetSolidClosed() const
+{
+  return fSolidClosed;
+}
+
+inline G4int G4TessellatedMesh::GetNumberOfVertices() const
+{
+  return G4int(fVertices.size());
+}
+
+inline G4int G4TessellatedMesh::GetNumberOfTriangles() const
+{
+  return G4int(fIndices.size()/3);
+}
+
+inline G4int G4TessellatedMesh::GetNumberOfNodes() const
+{
+  return G4int(fNodes.size());
+}
+
+inline const G4ThreeVector& G4TessellatedMesh::GetVertex(G4int i) const
+{
+  return fVertices[i];
+}
+
+inline void G4TessellatedMesh::GetTriangle(G4int i, G4int& i0,
+                                           G4int& i1, G4int& i2) const
+{
+  i0 = fIndices[3*i];
+  i1 = fIndices[3*i + 1];
+  i2 = fIndices[3*i + 2];
+}
+
+inline G4bool G4TessellatedMesh::OutsideOfExtent(const G4ThreeVector& p,
+                                                 G4double tolerance) const
+{
+  return ( p.x() < fMinExtent.x() - tolerance
+        || p.x() > fMaxExtent.x() + tolerance
+        || p.y() < fMinExtent.y() - tolerance
+        || p.y() > fMaxExtent.y() + tolerance
+        || p.z() < fMinExtent.z() - tolerance
+        || p.z() > fMaxExtent.z() + tolerance);
+}
+
+inline G4double G4TessellatedMesh::BoxDistance2(const G4MeshNode& node,
+                                                const G4ThreeVector& p) const
+{
+  G4double dx = std::max(std::max(node.fMin.x() - p.x(), p.x() - node.fMax.x()), 0.);
+  G4double dy = std::max(std::max(node.fMin.y() - p.y(), p.y() - node.fMax.y()), 0.);
+  G4double dz = std::max(std::max(node.fMin.z() - p.z(), p.z() - node.fMax.z()), 0.);
+  return dx*dx + dy*dy + dz*dz;
+}
+
+#endif
@@ -39,6 +39,7 @@ geant4_add_module(G4specsolids
     G4SolidsWorkspace.hh
     G4SurfBits.hh
     G4TessellatedGeometryAlgorithms.hh
+    G4TessellatedMesh.hh
     G4TessellatedSolid.hh
     G4Tet.hh
     G4TriangularFacet.hh
@@ -99,6 +100,7 @@ geant4_add_module(G4specsolids
     G4SolidsWorkspace.cc
     G4SurfBits.cc
     G4TessellatedGeometryAlgorithms.cc
+    G4TessellatedMesh.cc
     G4TessellatedSolid.cc
     G4Tet.cc
     G4TriangularFacet.cc
@@ -0,0 +1,1004 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration and of QinetiQ Ltd,   *
+// * subject to DEFCON 705 IPR conditions.                            *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+//
+// Implementation for G4TessellatedMesh class
+//
+// 19.10.2026 - First implementation
+// --------------------------------------------------------------------
+
+#include "G4TessellatedMesh.hh"
+#include "G4TessellatedSolid.hh"
+#include "G4VFacet.hh"
+
+#include "G4VoxelLimits.hh"
+#include "G4AffineTransform.hh"
+#include "G4BoundingEnvelope.hh"
+
+#include "G4QuickRand.hh"
+
+#include "G4VGraphicsScene.hh"
+#include "G4PolyhedronArbitrary.hh"
+#include "G4VisExtent.hh"
+
+#include "G4AutoLock.hh"
+
+#include <algorithm>
+#include <numeric>
+#include <map>
+#include <tuple>
+
+namespace
+{
+  G4Mutex polyhedronMutex = G4MUTEX_INITIALIZER;
+
+  // Parameters of the bounding volume hierarchy
+  //
+  const G4int kMaxLeafSize = 4;   // max number of triangles in a leaf
+  const G4int kNumberOfBins = 16; // number of bins for the SAH split
+  const G4int kMaxDepth = 64;     // below this depth use median split
+  const G4int kStackSize = 128;   // > kMaxDepth + log2(max number of nodes)
+
+  // Tolerance on barycentric coordinates in the ray-triangle test
+  //
+  const G4double kBaryTolerance = 1.e-9;
+
+  inline void Expand(G4ThreeVector& lo, G4ThreeVector& hi,
+                     const G4ThreeVector& pmin, const G4ThreeVector& pmax)
+  {
+    lo.set(std::min(lo.x(), pmin.x()), std::min(lo.y(), pmin.y()),
+           std::min(lo.z(), pmin.z()));
+    hi.set(std::max(hi.x(), pmax.x()), std::max(hi.y(), pmax.y()),
+           std::max(hi.z(), pmax.z()));
+  }
+
+  inline G4double HalfArea(const G4ThreeVector& lo, const G4ThreeVector& hi)
+  {
+    G4ThreeVector d = hi - lo;
+    return d.x()*d.y() + d.y()*d.z() + d.z()*d.x();
+  }
+}
+
+using namespace CLHEP;
+
+////////////////////////////////////////////////////////////////////////
+//
+// Constructor - create an empty mesh
+//
+G4TessellatedMesh::G4TessellatedMesh(const G4String& pName)
+  : G4VSolid(pName)
+{
+  halfTolerance = 0.5 * kCarTolerance;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Constructor - convert a tessellated solid,
+//               coincident vertices of the facets are merged
+//
+G4TessellatedMesh::G4TessellatedMesh(const G4TessellatedSolid& solid)
+  : G4VSolid(solid.GetName())
+{
+  halfTolerance = 0.5 * kCarTolerance;
+
+  std::map<std::tuple<G4double,G4double,G4double>, G4int> vertexMap;
+  G4int nfacets = solid.GetNumberOfFacets();
+  Reserve(nfacets, 2*nfacets);
+  for (G4int i = 0; i < nfacets; ++i)
+  {
+    G4VFacet* facet = solid.GetFacet(i);
+    G4int nv = std::min(facet->GetNumberOfVertices(), 4);
+    G4int iv[4] = { 0 };
+    for (G4int k = 0; k < nv; ++k)
+    {
+      G4ThreeVector p = facet->GetVertex(k);
+      auto key = std::make_tuple(p.x(), p.y(), p.z());
+      auto it = vertexMap.find(key);
+      if (it == vertexMap.end())
+      {
+        it = vertexMap.insert(std::make_pair(key, AddVertex(p))).first;
+      }
+      iv[k] = it->second;
+    }
+    if (nv == 3) { AddTriangle(iv[0], iv[1], iv[2]); }
+    if (nv == 4) { AddQuadrangle(iv[0], iv[1], iv[2], iv[3]); }
+  }
+  SetSolidClosed(true);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Fake default constructor - sets only member data and allocates memory
+//                            for usage restricted to object persistency.
+//
+G4TessellatedMesh::G4TessellatedMesh( __void__& a )
+  : G4VSolid(a)
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Destructor
+//
+G4TessellatedMesh::~G4TessellatedMesh()
+{
+  delete fpPolyhedron; fpPolyhedron = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Copy constructor
+//
+G4TessellatedMesh::G4TessellatedMesh(const G4TessellatedMesh& rhs)
+  : G4VSolid(rhs),
+    halfTolerance(rhs.halfTolerance), fSolidClosed(rhs.fSolidClosed),
+    fVertices(rhs.fVertices), fIndices(rhs.fIndices),
+    fTriangles(rhs.fTriangles), fNodes(rhs.fNodes),
+    fCumulArea(rhs.fCumulArea),
+    fMinExtent(rhs.fMinExtent), fMaxExtent(rhs.fMaxExtent),
+    fCubicVolume(rhs.fCubicVolume), fSurfaceArea(rhs.fSurfaceArea)
+{
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Assignment operator
+//
+G4TessellatedMesh& G4TessellatedMesh::operator = (const G4TessellatedMesh& rhs)
+{
+   // Check assignment to self
+   //
+   if (this == &rhs)  { return *this; }
+
+   // Copy base class data
+   //
+   G4VSolid::operator=(rhs);
+
+   // Copy data
+   //
+   halfTolerance = rhs.halfTolerance;
+   fSolidClosed = rhs.fSolidClosed;
+   fVertices = rhs.fVertices;
+   fIndices = rhs.fIndices;
+   fTriangles = rhs.fTriangles;
+   fNodes = rhs.fNodes;
+   fCumulArea = rhs.fCumulArea;
+   fMinExtent = rhs.fMinExtent;
+   fMaxExtent = rhs.fMaxExtent;
+   fCubicVolume = rhs.fCubicVolume;
+   fSurfaceArea = rhs.fSurfaceArea;
+   fRebuildPolyhedron = false;
+   delete fpPolyhedron; fpPolyhedron = nullptr;
+
+   return *this;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Reserve memory for the vertices and triangles
+//
+void G4TessellatedMesh::Reserve(G4int nVertices, G4int nTriangles)
+{
+  fVertices.reserve(nVertices);
+  fIndices.reserve(3*nTriangles);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Add a vertex, return its index
+//
+G4int G4TessellatedMesh::AddVertex(const G4ThreeVector& p)
+{
+  if (fSolidClosed)
+  {
+    G4Exception("G4TessellatedMesh::AddVertex()", "GeomSolids1002",
+                JustWarning, "Attempt to add vertices when solid is closed.");
+    return -1;
+  }
+  fVertices.push_back(p);
+  return G4int(fVertices.size()) - 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Add a triangle, vertices anti-clockwise as seen from outside
+//
+G4bool G4TessellatedMesh::AddTriangle(G4int i0, G4int i1, G4int i2)
+{
+  if (fSolidClosed)
+  {
+    G4Exception("G4TessellatedMesh::AddTriangle()", "GeomSolids1002",
+                JustWarning, "Attempt to add facets when solid is closed.");
+    return false;
+  }
+  G4int nv = G4int(fVertices.size());
+  if (i0 < 0 || i1 < 0 || i2 < 0 || i0 >= nv || i1 >= nv || i2 >= nv ||
+      i0 == i1 || i1 == i2 || i2 == i0)
+  {
+    std::ostringstream message;
+    message << "Invalid triangle (" << i0 << ", " << i1 << ", " << i2
+            << ") for solid: " << GetName() << " with " << nv << " vertices";
+    G4Exception("G4TessellatedMesh::AddTriangle()", "GeomSolids1001",
+                JustWarning, message);
+    return false;
+  }
+  fIndices.push_back(i0);
+  fIndices.push_back(i1);
+  fIndices.push_back(i2);
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Add a quadrangle as two triangles
+//
+G4bool G4TessellatedMesh::AddQuadrangle(G4int i0, G4int i1,
+                                        G4int i2, G4int i3)
+{
+  return AddTriangle(i0, i1, i2) && AddTriangle(i0, i2, i3);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Close the solid: remove degenerate triangles, build the hierarchy
+// and precompute volume, area and extent
+//
+void G4TessellatedMesh::SetSolidClosed(G4bool t)
+{
+  if (!t)
+  {
+    fSolidClosed = false;
+    fTriangles.clear();
+    fNodes.clear();
+    fCumulArea.clear();
+    return;
+  }
+  if (fSolidClosed) { return; }
+
+  // Remove degenerate triangles
+  //
+  G4int ntri = GetNumberOfTriangles();
+  G4int ndegenerate = 0;
+  std::vector<G4int> indices;
+  indices.reserve(fIndices.size());
+  for (G4int i = 0; i < ntri; ++i)
+  {
+    const G4ThreeVector& p0 = fVertices[fIndices[3*i]];
+    G4ThreeVector e1 = fVertices[fIndices[3*i + 1]] - p0;
+    G4ThreeVector e2 = fVertices[fIndices[3*i + 2]] - p0;
+    if (e1.cross(e2).mag() <= kCarTolerance*kCarTolerance)
+    {
+      ++ndegenerate;
+      continue;
+    }
+    for (G4int k = 0; k < 3; ++k) { indices.push_back(fIndices[3*i + k]); }
+  }
+  fIndices.swap(indices);
+  if (ndegenerate > 0)
+  {
+    std::ostringstream message;
+    message << ndegenerate << " degenerate triangles removed from solid: "
+            << GetName();
+    G4Exception("G4TessellatedMesh::SetSolidClosed()", "GeomSolids1001",
+                JustWarning, message);
+  }
+  if (fIndices.empty())
+  {
+    std::ostringstream message;
+    message << "No triangles defined for solid: " << GetName();
+    G4Exception("G4TessellatedMesh::SetSolidClosed()", "GeomSolids0002",
+                FatalException, message);
+    return;
+  }
+
+  // Build hierarchy, fill triangles in leaf order
+  //
+  BuildHierarchy();
+  fMinExtent = fNodes[0].fMin + G4ThreeVector(halfTolerance, halfTolerance,
+                                              halfTolerance);
+  fMaxExtent = fNodes[0].fMax - G4ThreeVector(halfTolerance, halfTolerance,
+                                              halfTolerance);
+
+  // Volume, surface area and table for GetPointOnSurface()
+  //
+  fCubicVolume = 0.;
+  fSurfaceArea = 0.;
+  fCumulArea.resize(fTriangles.size());
+  for (std::size_t i = 0; i < fTriangles.size(); ++i)
+  {
+    const G4MeshTriangle& tri = fTriangles[i];
+    G4ThreeVector cross = tri.fE1.cross(tri.fE2);
+    fCubicVolume += tri.fV0.dot(cross);
+    fSurfaceArea += 0.5*cross.mag();
+    fCumulArea[i] = fSurfaceArea;
+  }
+  fCubicVolume /= 6.;
+
+  fSolidClosed = true;
+  fRebuildPolyhedron = true;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Build bounding volume hierarchy. The node boxes are enlarged by the
+// surface tolerance, the triangles are stored in the order of the leaves
+//
+void G4TessellatedMesh::BuildHierarchy()
+{
+  G4int ntri = GetNumberOfTriangles();
+  G4ThreeVector tol(halfTolerance, halfTolerance, halfTolerance);
+  std::vector<G4ThreeVector> centre(ntri), bmin(ntri), bmax(ntri);
+  for (G4int i = 0; i < ntri; ++i)
+  {
+    const G4ThreeVector& p0 = fVertices[fIndices[3*i]];
+    const G4ThreeVector& p1 = fVertices[fIndices[3*i + 1]];
+    const G4ThreeVector& p2 = fVertices[fIndices[3*i + 2]];
+    bmin[i] = p0;
+    bmax[i] = p0;
+    Expand(bmin[i], bmax[i], p1, p1);
+    Expand(bmin[i], bmax[i], p2, p2);
+    bmin[i] -= tol;
+    bmax[i] += tol;
+    centre[i] = 0.5*(bmin[i] + bmax[i]);
+  }
+  std::vector<G4int> order(ntri);
+  std::iota(order.begin(), order.end(), 0);
+
+  struct Task { G4int node, first, count, depth; };
+  std::vector<Task> tasks;
+  tasks.push_back({ 0, 0, ntri, 0 });
+  fNodes.clear();
+  fNodes.reserve(2*(ntri/kMaxLeafSize + 1));
+  fNodes.emplace_back();
+  while (!tasks.empty())
+  {
+    Task task = tasks.back();
+    tasks.pop_back();
+
+    G4ThreeVector lo = bmin[order[task.first]];
+    G4ThreeVector hi = bmax[order[task.first]];
+    for (G4int k = task.first + 1; k < task.first + task.count; ++k)
+    {
+      Expand(lo, hi, bmin[order[k]], bmax[order[k]]);
+    }
+    fNodes[task.node].fMin = lo;
+    fNodes[task.node].fMax = hi;
+
+    G4int nleft = 0;
+    if (task.count > kMaxLeafSize)
+    {
+      if (task.depth < kMaxDepth)
+      {
+        nleft = SplitNode(task.first, task.count, order, centre, bmin, bmax);
+      }
+      else
+      {
+        // Median split along the largest extent to bound the depth
+        nleft = task.count/2;
+        G4ThreeVector d = hi - lo;
+        G4int axis = (d.x() > d.y()) ? ((d.x() > d.z()) ? 0 : 2)
+                                     : ((d.y() > d.z()) ? 1 : 2);
+        std::nth_element(order.begin() + task.first,
+                         order.begin() + task.first + nleft,
+                         order.begin() + task.first + task.count,
+                         [&centre, axis](G4int a, G4int b)
+                         { return centre[a][axis] < centre[b][axis]; });
+      }
+    }
+    if (nleft == 0)
+    {
+      fNodes[task.node].fFirst = task.first;
+      fNodes[task.node].fCount = task.count;
+      continue;
+    }
+    G4int child = G4int(fNodes.size());
+    fNodes.emplace_back();
+    fNodes.emplace_back();
+    fNodes[task.node].fFirst = child;
+    fNodes[task.node].fCount = 0;
+    tasks.push_back({ child, task.first, nleft, task.depth + 1 });
+    tasks.push_back({ child + 1, task.first + nleft, task.count - nleft,
+                      task.depth + 1 });
+  }
+
+  fTriangles.resize(ntri);
+  for (G4int k = 0; k < ntri; ++k)
+  {
+    G4int i = order[k];
+    G4MeshTriangle& tri = fTriangles[k];
+    tri.fV0 = fVertices[fIndices[3*i]];
+    tri.fE1 = fVertices[fIndices[3*i + 1]] - tri.fV0;
+    tri.fE2 = fVertices[fIndices[3*i + 2]] - tri.fV0;
+    tri.fNormal = tri.fE1.cross(tri.fE2).unit();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Binned surface area heuristic: reorder triangles [first, first+count)
+// and return the number of triangles in the left child, or 0 if it is
+// cheaper to keep a leaf
+//
+G4int
+G4TessellatedMesh::SplitNode(G4int first, G4int count,
+                             std::vector<G4int>& order,
+                             const std::vector<G4ThreeVector>& centre,
+                             const std::vector<G4ThreeVector>& bmin,
+                             const std::vector<G4ThreeVector>& bmax) const
+{
+  G4ThreeVector cmin = centre[order[first]];
+  G4ThreeVector cmax = cmin;
+  G4ThreeVector lo = bmin[order[first]];
+  G4ThreeVector hi = bmax[order[first]];
+  for (G4int k = first + 1; k < first + count; ++k)
+  {
+    Expand(cmin, cmax, centre[order[k]], centre[order[k]]);
+    Expand(lo, hi, bmin[order[k]], bmax[order[k]]);
+  }
+
+  G4double bestCost = count*HalfArea(lo, hi);  // cost of the leaf
+  G4int bestAxis = -1;
+  G4int bestBin = 0;
+  for (G4int axis = 0; axis < 3; ++axis)
+  {
+    G4double extent = cmax[axis] - cmin[axis];
+    if (extent <= 0.) continue;
+    G4double scale = kNumberOfBins/extent;
+
+    G4int binCount[kNumberOfBins] = { 0 };
+    G4ThreeVector binMin[kNumberOfBins], binMax[kNumberOfBins];
+    for (G4int k = first; k < first + count; ++k)
+    {
+      G4int i = order[k];
+      G4int b = std::min(G4int((centre[i][axis] - cmin[axis])*scale),
+                         kNumberOfBins - 1);
+      if (binCount[b] == 0) { binMin[b] = bmin[i]; binMax[b] = bmax[i]; }
+      else { Expand(binMin[b], binMax[b], bmin[i], bmax[i]); }
+      ++binCount[b];
+    }
+
+    // Sweep from the right, then from the left
+    G4double rightCost[kNumberOfBins] = { 0. };
+    G4int n = 0;
+    G4ThreeVector rlo, rhi;
+    for (G4int b = kNumberOfBins - 1; b > 0; --b)
+    {
+      if (binCount[b] > 0)
+      {
+        if (n == 0) { rlo = binMin[b]; rhi = binMax[b]; }
+        else { Expand(rlo, rhi, binMin[b], binMax[b]); }
+        n += binCount[b];
+      }
+      rightCost[b] = (n > 0) ? n*HalfArea(rlo, rhi) : 0.;
+    }
+    n = 0;
+    G4ThreeVector llo, lhi;
+    for (G4int b = 0; b < kNumberOfBins - 1; ++b)
+    {
+      if (binCount[b] > 0)
+      {
+        if (n == 0) { llo = binMin[b]; lhi = binMax[b]; }
+        else { Expand(llo, lhi, binMin[b], binMax[b]); }
+        n += binCount[b];
+      }
+      if (n == 0 || n == count) continue;
+      G4double cost = n*HalfArea(llo, lhi) + rightCost[b + 1];
+      if (cost < bestCost)
+      {
+        bestCost = cost;
+        bestAxis = axis;
+        bestBin = b;
+      }
+    }
+  }
+
+  if (bestAxis < 0)
+  {
+    // No split is found cheaper than the leaf, or all centres coincide;
+    // large nodes are split anyway
+    return (count > 4*kMaxLeafSize) ? count/2 : 0;
+  }
+
+  G4double scale = kNumberOfBins/(cmax[bestAxis] - cmin[bestAxis]);
+  G4double cbase = cmin[bestAxis];
+  auto mid = std::partition(order.begin() + first,
+                            order.begin() + first + count,
+                            [&](G4int i)
+                            {
+                              G4int b = std::min(G4int((centre[i][bestAxis]
+                                                 - cbase)*scale),
+                                                 kNumberOfBins - 1);
+                              return b <= bestBin;
+                            });
+  return G4int(mid - (order.begin() + first));
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Squared distance from a point to a triangle, see
+// C.Ericson, Real-Time Collision Detection, 2005, section 5.1.5
+//
+G4double G4TessellatedMesh::ClosestPoint(const G4MeshTriangle& tri,
+                                         const G4ThreeVector& p,
+                                         G4bool& interior) const
+{
+  interior = false;
+  G4ThreeVector ap = p - tri.fV0;
+  G4double d1 = tri.fE1.dot(ap);
+  G4double d2 = tri.fE2.dot(ap);
+  if (d1 <= 0. && d2 <= 0.) { return ap.mag2(); }  // vertex 0
+
+  G4ThreeVector bp = ap - tri.fE1;
+  G4double d3 = tri.fE1.dot(bp);
+  G4double d4 = tri.fE2.dot(bp);
+  if (d3 >= 0. && d4 <= d3) { return bp.mag2(); }  // vertex 1
+
+  G4double vc = d1*d4 - d3*d2;
+  if (vc <= 0. && d1 >= 0. && d3 <= 0.)             // edge 0-1
+  {
+    return (ap - tri.fE1*(d1/(d1 - d3))).mag2();
+  }
+
+  G4ThreeVector cp = ap - tri.fE2;
+  G4double d5 = tri.fE1.dot(cp);
+  G4double d6 = tri.fE2.dot(cp);
+  if (d6 >= 0. && d5 <= d6) { return cp.mag2(); }  // vertex 2
+
+  G4double vb = d5*d2 - d1*d6;
+  if (vb <= 0. && d2 >= 0. && d6 <= 0.)             // edge 0-2
+  {
+    return (ap - tri.fE2*(d2/(d2 - d6))).mag2();
+  }
+
+  G4double va = d3*d6 - d5*d4;
+  if (va <= 0. && (d4 - d3) >= 0. && (d5 - d6) >= 0.) // edge 1-2
+  {
+    G4double w = (d4 - d3)/((d4 - d3) + (d5 - d6));
+    return (bp - (tri.fE2 - tri.fE1)*w).mag2();
+  }
+
+  interior = true;                                  // face
+  G4double dist = tri.fNormal.dot(ap);
+  return dist*dist;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Distance to the closest triangle, best-first traversal of the BVH
+//
+G4double G4TessellatedMesh::ClosestTriangle(const G4ThreeVector& p,
+                                            G4int& itri,
+                                            G4bool& interior) const
+{
+  itri = -1;
+  interior = false;
+  if (fNodes.empty()) { return kInfinity; }
+
+  G4double best2 = kInfinity;
+  G4int stack[kStackSize];
+  G4int nstack = 0;
+  stack[nstack++] = 0;
+  while (nstack > 0)
+  {
+    const G4MeshNode& node = fNodes[stack[--nstack]];
+    if (BoxDistance2(node, p) >= best2) continue;
+    if (node.fCount > 0)
+    {
+      for (G4int k = node.fFirst; k < node.fFirst + node.fCount; ++k)
+      {
+        G4bool in;
+        G4double dist2 = ClosestPoint(fTriangles[k], p, in);
+        if (dist2 < best2)
+        {
+          best2 = dist2;
+          itri = k;
+          interior = in;
+        }
+      }
+      continue;
+    }
+    G4int c0 = node.fFirst;
+    G4int c1 = node.fFirst + 1;
+    G4double d0 = BoxDistance2(fNodes[c0], p);
+    G4double d1 = BoxDistance2(fNodes[c1], p);
+    if (d0 < d1) { std::swap(c0, c1); std::swap(d0, d1); }
+    if (d0 < best2) { stack[nstack++] = c0; }  // farther child first
+    if (d1 < best2) { stack[nstack++] = c1; }
+  }
+  return std::sqrt(best2);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Ray traversal of the BVH, Moller-Trumbore test of the triangles.
+// With orientation != 0 a triangle is accepted if the point is not
+// beyond its plane by more than the surface tolerance
+//
+G4double G4TessellatedMesh::Intersect(const G4ThreeVector& p,
+                                      const G4ThreeVector& v,
+                                      G4int orientation,
+                                      G4int& itri, G4bool& edge) const
+{
+  itri = -1;
+  edge = false;
+  if (fNodes.empty()) { return kInfinity; }
+
+  G4ThreeVector invdir((v.x() != 0.) ? 1./v.x() : kInfinity,
+                       (v.y() != 0.) ? 1./v.y() : kInfinity,
+                       (v.z() != 0.) ? 1./v.z() : kInfinity);
+  G4double tbest = kInfinity;
+  G4int stack[kStackSize];
+  G4int nstack = 0;
+  stack[nstack++] = 0;
+  while (nstack > 0)
+  {
+    const G4MeshNode& node = fNodes[stack[--nstack]];
+
+    // Slab test
+    G4double tmin = -kInfinity, tmax = tbest;
+    for (G4int i = 0; i < 3; ++i)
+    {
+      G4double t1 = (node.fMin[i] - p[i])*invdir[i];
+      G4double t2 = (node.fMax[i] - p[i])*invdir[i];
+      tmin = std::max(tmin, std::min(t1, t2));
+      tmax = std::min(tmax, std::max(t1, t2));
+    }
+    if (tmin > tmax || tmax < 0.) continue;
+
+    if (node.fCount == 0)
+    {
+      stack[nstack++] = node.fFirst;
+      stack[nstack++] = node.fFirst + 1;
+      continue;
+    }
+    for (G4int k = node.fFirst; k < node.fFirst + node.fCount; ++k)
+    {
+      const G4MeshTriangle& tri = fTriangles[k];
+      G4double vn = v.dot(tri.fNormal);
+      if (orientation*vn < 0. || (orientation != 0 && vn == 0.)) continue;
+
+      G4ThreeVector pvec = v.cross(tri.fE2);
+      G4double det = tri.fE1.dot(pvec);
+      if (det == 0.) continue;
+      G4double invdet = 1./det;
+      G4ThreeVector tvec = p - tri.fV0;
+      G4double u = tvec.dot(pvec)*invdet;
+      if (u < -kBaryTolerance || u > 1. + kBaryTolerance) continue;
+      G4ThreeVector qvec = tvec.cross(tri.fE1);
+      G4double w = v.dot(qvec)*invdet;
+      if (w < -kBaryTolerance || u + w > 1. + kBaryTolerance) continue;
+      G4double t = tri.fE2.dot(qvec)*invdet;
+      if (t >= tbest) continue;
+      if (orientation == 0)
+      {
+        if (t <= 0.) continue;
+      }
+      else if (orientation*tri.fNormal.dot(tvec) > halfTolerance)
+      {
+        continue;  // the plane is already crossed
+      }
+      tbest = t;
+      itri = k;
+      edge = (u < kBaryTolerance || w < kBaryTolerance ||
+              u + w > 1. - kBaryTolerance ||
+              std::abs(vn) < kBaryTolerance);
+    }
+  }
+  return tbest;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Get bounding box
+//
+void G4TessellatedMesh::BoundingLimits(G4ThreeVector& pMin,
+                                       G4ThreeVector& pMax) const
+{
+  pMin = fMinExtent;
+  pMax = fMaxExtent;
+
+  // Check correctness of the bounding box
+  //
+  if (pMin.x() >= pMax.x() || pMin.y() >= pMax.y() || pMin.z() >= pMax.z())
+  {
+    std::ostringstream message;
+    message << "Bad bounding box (min >= max) for solid: "
+            << GetName() << " !"
+            << "\npMin = " << pMin
+            << "\npMax = " << pMax;
+    G4Exception("G4TessellatedMesh::BoundingLimits()",
+                "GeomMgt0001", JustWarning, message);
+    DumpInfo();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Calculate extent under transform and specified limit
+//
+G4bool
+G4TessellatedMesh::CalculateExtent(const EAxis pAxis,
+                                   const G4VoxelLimits& pVoxelLimit,
+                                   const G4AffineTransform& pTransform,
+                                         G4double& pMin, G4double& pMax) const
+{
+  G4ThreeVector bmin, bmax;
+  BoundingLimits(bmin,bmax);
+  G4BoundingEnvelope bbox(bmin,bmax);
+  return bbox.CalculateExtent(pAxis,pVoxelLimit,pTransform,pMin,pMax);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Return position of point: inside/outside/on surface.
+// Points farther than the tolerance from the surface are classified by
+// the closest triangle if the closest point is inside the face, otherwise
+// by the orientation of the first triangle crossed by a ray
+//
+EInside G4TessellatedMesh::Inside(const G4ThreeVector& p) const
+{
+  if (OutsideOfExtent(p, halfTolerance)) { return kOutside; }
+
+  G4int itri;
+  G4bool interior;
+  G4double dist = ClosestTriangle(p, itri, interior);
+  if (dist <= halfTolerance) { return kSurface; }
+  if (interior)
+  {
+    const G4MeshTriangle& tri = fTriangles[itri];
+    return (tri.fNormal.dot(p - tri.fV0) < 0.) ? kInside : kOutside;
+  }
+
+  static const G4ThreeVector dirs[4] =
+  {
+    G4ThreeVector( 0.5773502692, 0.5773502692, 0.5773502692),
+    G4ThreeVector(-0.2672612419, 0.5345224838, 0.8017837257),
+    G4ThreeVector( 0.8728715609,-0.4364357805, 0.2182178902),
+    G4ThreeVector(-0.4850712501,-0.7276068751, 0.4850712501)
+  };
+  EInside location = kOutside;
+  for (const auto& dir : dirs)
+  {
+    G4bool edge;
+    G4double t = Intersect(p, dir, 0, itri, edge);
+    if (t == kInfinity) { return kOutside; }
+    location = (dir.dot(fTriangles[itri].fNormal) > 0.) ? kInside : kOutside;
+    if (!edge) break;
+  }
+  return location;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Return unit normal of the closest triangle
+//
+G4ThreeVector G4TessellatedMesh::SurfaceNormal(const G4ThreeVector& p) const
+{
+  G4int itri;
+  G4bool interior;
+  ClosestTriangle(p, itri, interior);
+  return (itri < 0) ? G4ThreeVector(0., 0., 1.) : fTriangles[itri].fNormal;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Calculate distance to surface from outside,
+// return kInfinity if no intersection
+//
+G4double G4TessellatedMesh::DistanceToIn(const G4ThreeVector& p,
+                                         const G4ThreeVector& v) const
+{
+  G4int itri;
+  G4bool edge;
+  G4double t = Intersect(p, v, -1, itri, edge);
+  return (t == kInfinity) ? kInfinity : std::max(t, 0.);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Estimate safety distance to surface from outside,
+// the distance to the closest triangle
+//
+G4double G4TessellatedMesh::DistanceToIn(const G4ThreeVector& p) const
+{
+  G4int itri;
+  G4bool interior;
+  G4double dist = ClosestTriangle(p, itri, interior);
+  return (dist > halfTolerance) ? dist : 0.;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Calcluate distance to surface from inside
+//
+G4double G4TessellatedMesh::DistanceToOut(const G4ThreeVector& p,
+                                          const G4ThreeVector& v,
+                                          const G4bool calcNorm,
+                                                G4bool* validNorm,
+                                                G4ThreeVector* n) const
+{
+  G4int itri;
+  G4bool edge;
+  G4double t = Intersect(p, v, +1, itri, edge);
+  if (calcNorm)
+  {
+    *validNorm = false;
+    *n = (itri < 0) ? SurfaceNormal(p) : fTriangles[itri].fNormal;
+  }
+  return (t == kInfinity) ? 0. : std::max(t, 0.);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Estimate safety distance to surface from inside,
+// the distance to the closest triangle
+//
+G4double G4TessellatedMesh::DistanceToOut(const G4ThreeVector& p) const
+{
+  G4int itri;
+  G4bool interior;
+  G4double dist = ClosestTriangle(p, itri, interior);
+  return (dist > halfTolerance) ? dist : 0.;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// GetEntityType
+//
+G4GeometryType G4TessellatedMesh::GetEntityType() const
+{
+  return G4String("G4TessellatedMesh");
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Make a clone of the object
+//
+G4VSolid* G4TessellatedMesh::Clone() const
+{
+  return new G4TessellatedMesh(*this);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Stream object contents to an output stream
+//
+std::ostream& G4TessellatedMesh::StreamInfo(std::ostream& os) const
+{
+  G4int oldprc = os.precision(16);
+  os << "-----------------------------------------------------------\n"
+     << "    *** Dump for solid - " << GetName() << " ***\n"
+     << "    ===================================================\n"
+     << " Solid type: " << GetEntityType() << "\n"
+     << " Parameters: \n"
+     << "    number of vertices : " << GetNumberOfVertices() << "\n"
+     << "    number of triangles: " << GetNumberOfTriangles() << "\n"
+     << "    number of BVH nodes: " << GetNumberOfNodes() << "\n"
+     << "    extent min: " << fMinExtent/mm << " mm\n"
+     << "    extent max: " << fMaxExtent/mm << " mm\n"
+     << "-----------------------------------------------------------\n";
+  os.precision(oldprc);
+  return os;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Return random point on the surface
+//
+G4ThreeVector G4TessellatedMesh::GetPointOnSurface() const
+{
+  // Select triangle
+  G4double select = fSurfaceArea*G4QuickRand();
+  auto it = std::lower_bound(fCumulArea.cbegin(), fCumulArea.cend(), select);
+  std::size_t i = std::min(std::size_t(it - fCumulArea.cbegin()),
+                           fTriangles.size() - 1);
+  const G4MeshTriangle& tri = fTriangles[i];
+
+  // Return random point
+  G4double r1 = G4QuickRand();
+  G4double r2 = G4QuickRand();
+  return (r1 + r2 > 1.) ?
+    tri.fV0 + tri.fE1*(1. - r1) + tri.fE2*(1. - r2) :
+    tri.fV0 + tri.fE1*r1 + tri.fE2*r2;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Return volume of the solid
+//
+G4double G4TessellatedMesh::GetCubicVolume()
+{
+  return fCubicVolume;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Return surface area of the solid
+//
+G4double G4TessellatedMesh::GetSurfaceArea()
+{
+  return fSurfaceArea;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Methods for visualisation
+//
+void G4TessellatedMesh::DescribeYourselfTo (G4VGraphicsScene& scene) const
+{
+  scene.AddSolid (*this);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Return VisExtent
+//
+G4VisExtent G4TessellatedMesh::GetExtent() const
+{
+  return G4VisExtent(fMinExtent.x(), fMaxExtent.x(),
+                     fMinExtent.y(), fMaxExtent.y(),
+                     fMinExtent.z(), fMaxExtent.z());
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// CreatePolyhedron
+//
+G4Polyhedron* G4TessellatedMesh::CreatePolyhedron() const
+{
+  G4int nVertices = GetNumberOfVertices();
+  G4int nTriangles = GetNumberOfTriangles();
+  G4PolyhedronArbitrary* polyhedron =
+    new G4PolyhedronArbitrary (nVertices, nTriangles);
+  for (const auto& vertex : fVertices) { polyhedron->AddVertex(vertex); }
+  for (G4int i = 0; i < nTriangles; ++i)
+  {
+    polyhedron->AddFacet(fIndices[3*i] + 1, fIndices[3*i + 1] + 1,
+                         fIndices[3*i + 2] + 1);
+  }
+  polyhedron->SetReferences();
+  return (G4Polyhedron*) polyhedron;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// GetPolyhedron
+//
+G4Polyhedron* G4TessellatedMesh::GetPolyhedron() const
+{
+  if (fpPolyhedron == nullptr ||
+      fRebuildPolyhedron ||
+      fpPolyhedron->GetNumberOfRotationStepsAtTimeOfCreation() !=
+      fpPolyhedron->GetNumberOfRotationSteps())
+  {
+    G4AutoLock l(&polyhedronMutex);
+    delete fpPolyhedron;
+    fpPolyhedron = CreatePolyhedron();
+    fRebuildPolyhedron = false;
+    l.unlock();
+  }
+  return fpPolyhedron;
+}
@@ -183,7 +183,8 @@ G4PVParameterised::CheckOverlaps(G4int res, G4double tol,
   G4VSolid *solidA = nullptr, *solidB = nullptr;
   G4LogicalVolume* motherLog = GetMotherLogical();
   G4VSolid *motherSolid = motherLog->GetSolid();
-  std::vector<G4ThreeVector> points;
+  std::vector<G4ThreeVector> points, local;
+  std::vector<EInside> location;
 
   if (verbose)
   {
@@ -253,13 +254,23 @@ G4PVParameterised::CheckOverlaps(G4int res, G4double tol,
       //
       G4AffineTransform Td( GetRotation(), GetTranslation() );
 
-      for (auto pos=points.cbegin(); pos!=points.cend(); ++pos)
+      // Transform the points according to daughter's frame
+      // and classify them all at once
+      //
+      G4int npoints = G4int(points.size());
+      local.resize(npoints);
+      location.resize(npoints);
+      for (auto n=0; n<npoints; ++n)
+      {
+        local[n] = Td.InverseTransformPoint(points[n]);
+      }
+      solidB->InsideBatch(npoints, local.data(), location.data());
+
+      for (auto n=0; n<npoints; ++n)
       {
-        // Transform each point according to daughter's frame
-        //
-        G4ThreeVector md = Td.InverseTransformPoint(*pos);
+        const G4ThreeVector& md = local[n];
 
-        if (solidB->Inside(md)==kInside)
+        if (location[n]==kInside)
         {
           G4double distout = solidB->DistanceToOut(md);
           if (distout > tol)
@@ -306,16 +306,32 @@ G4bool G4PVPlacement::CheckOverlaps(G4int res, G4double tol,
   G4double overlapSize = -kInfinity;
   G4ThreeVector overlapPoint;
   G4VSolid* motherSolid = motherLog->GetSolid();
+
+  // Points are classified and measured in batches, first the position
+  // of all of them, then the distance for the selected ones
+  //
+  std::vector<EInside> location(res);
+  std::vector<G4ThreeVector> selected;
+  std::vector<G4double> distance;
+  selected.reserve(res);
+  distance.reserve(res);
+
+  motherSolid->InsideBatch(res, points.data(), location.data());
   for (G4int i = 0; i < res; ++i)
   {
-    G4ThreeVector mp = points[i];
-    if (motherSolid->Inside(mp) != kOutside) continue;
-    G4double distin = motherSolid->DistanceToIn(mp);
+    if (location[i] == kOutside) selected.push_back(points[i]);
+  }
+  G4int nselected = G4int(selected.size());
+  distance.resize(nselected);
+  motherSolid->SafetyToInBatch(nselected, selected.data(), distance.data());
+  for (G4int i = 0; i < nselected; ++i)
+  {
+    G4double distin = distance[i];
     if (distin < tol) continue; // too small overlap
     ++overlapCount;
     if (distin <= overlapSize) continue;
     overlapSize = distin;
-    overlapPoint = mp;
+    overlapPoint = selected[i];
   }
 
   // Print information on overlap
@@ -375,6 +391,7 @@ G4bool G4PVPlacement::CheckOverlaps(G4int res, G4double tol,
       if (pmax.x() <= xmin) continue;
       if (pmax.y() <= ymin) continue;
       if (pmax.z() <= zmin) continue;
+      selected.clear();
       for (G4int i = 0; i < res; ++i)
       {
         G4ThreeVector p = points[i];
@@ -384,17 +401,7 @@ G4bool G4PVPlacement::CheckOverlaps(G4int res, G4double tol,
         if (p.y() >= pmax.y()) continue;
         if (p.z() <= pmin.z()) continue;
         if (p.z() >= pmax.z()) continue;
-        G4ThreeVector md = p - offset;
-        if (daughterSolid->Inside(md) == kInside)
-        {
-          check_encapsulation = false;
-          G4double distout = daughterSolid->DistanceToOut(md);
-          if (distout < tol) continue; // too small overlap
-          ++overlapCount;
-          if (distout <= overlapSize) continue;
-          overlapSize = distout;
-          overlapPoint = md;
-        }
+        selected.push_back(p - offset);
       }
     }
     else // transformation with rotation
@@ -438,6 +445,7 @@ G4bool G4PVPlacement::CheckOverlaps(G4int res, G4double tol,
       if (dxmax <= xmin) continue;
       if (dymax <= ymin) continue;
       if (dzmax <= zmin) continue;
+      selected.clear();
       for (G4int i = 0; i < res; ++i)
       {
         G4ThreeVector p = points[i];
@@ -447,20 +455,33 @@ G4bool G4PVPlacement::CheckOverlaps(G4int res, G4double tol,
         if (p.y() <= dymin) continue;
         if (p.z() >= dzmax) continue;
         if (p.z() <= dzmin) continue;
-        G4ThreeVector md = Td.InverseTransformPoint(p);
-        if (daughterSolid->Inside(md) == kInside)
-        {
-          check_encapsulation = false;
-          G4double distout = daughterSolid->DistanceToOut(md);
-          if (distout < tol) continue; // too small overlap
-          ++overlapCount;
-          if (distout <= overlapSize) continue;
-          overlapSize = distout;
-          overlapPoint = md;
-        }
+        selected.push_back(Td.InverseTransformPoint(p));
       }
     }
 
+    // Find the points inside the daughter and their depth
+    //
+    nselected = G4int(selected.size());
+    location.resize(nselected);
+    daughterSolid->InsideBatch(nselected, selected.data(), location.data());
+    G4int ninside = 0;
+    for (G4int i = 0; i < nselected; ++i)
+    {
+      if (location[i] == kInside) selected[ninside++] = selected[i];
+    }
+    distance.resize(ninside);
+    daughterSolid->SafetyToOutBatch(ninside, selected.data(), distance.data());
+    if (ninside > 0) check_encapsulation = false;
+    for (G4int i = 0; i < ninside; ++i)
+    {
+      G4double distout = distance[i];
+      if (distout < tol) continue; // too small overlap
+      ++overlapCount;
+      if (distout <= overlapSize) continue;
+      overlapSize = distout;
+      overlapPoint = selected[i];
+    }
+
     // Print information on overlap
     //
     if (overlapCount > 0)
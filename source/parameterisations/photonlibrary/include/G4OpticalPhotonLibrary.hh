@@ -0,0 +1,138 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// G4OpticalPhotonLibrary
+//
+// Class description:
+//
+// Voxelised optical photon library ("visibility library"). For each voxel
+// of a regular grid, given in global coordinates, it stores the
+// probability that an optical photon emitted isotropically in the voxel
+// reaches each photodetector and, optionally, the cumulative distribution
+// of the photon arrival time at each photodetector.
+//
+// The library is written to and read from a binary file with a fixed
+// size header followed by contiguous single precision arrays, so that
+// the file can also be memory-mapped by external tools:
+//
+//   char[8]   "G4OPLIB"
+//   uint32    format version (2), 0
+//   int32     nx, ny, nz, number of detectors, number of time bins, 0
+//   double    lower corner (x,y,z), upper corner (x,y,z), maximum time
+//   float     visibility[voxel][detector]
+//   float     time CDF[voxel][detector][time bin]
+//
+// All fields are naturally aligned when the file is mapped at a page
+// boundary. Voxels are ordered with x running fastest. Lengths are in mm and times
+// in ns. The library is read-only once filled and can be shared by the
+// worker threads.
+// --------------------------------------------------------------------
+#ifndef G4OpticalPhotonLibrary_hh
+#define G4OpticalPhotonLibrary_hh 1
+
+#include "globals.hh"
+#include "G4ThreeVector.hh"
+
+#include <vector>
+
+class G4OpticalPhotonLibrary
+{
+  public:
+
+    G4OpticalPhotonLibrary();
+      // Constructs an empty library, to be filled with Load()
+
+    G4OpticalPhotonLibrary(const G4ThreeVector& lower,
+                           const G4ThreeVector& upper,
+                           G4int nx, G4int ny, G4int nz,
+                           G4int nDetectors,
+                           G4int nTimeBins = 0, G4double maxTime = 0.);
+      // Constructs a library with all visibilities set to zero
+
+    ~G4OpticalPhotonLibrary() = default;
+
+    G4bool Load(const G4String& fileName);
+    G4bool Write(const G4String& fileName) const;
+      // Read/write the library from/to a binary file.
+      // Return false in case of failure
+
+    inline G4int GetNumberOfVoxels() const;
+    inline G4int GetNumberOfDetectors() const;
+    inline G4int GetNumberOfTimeBins() const;
+    inline G4double GetMaxTime() const;
+    inline const G4ThreeVector& GetLowerCorner() const;
+    inline const G4ThreeVector& GetUpperCorner() const;
+    inline G4ThreeVector GetVoxelSize() const;
+
+    G4int GetVoxelIndex(const G4ThreeVector& position) const;
+      // Returns the voxel containing the position, -1 if outside
+
+    G4ThreeVector GetVoxelLowerCorner(G4int voxel) const;
+
+    inline G4double GetVisibility(G4int voxel, G4int detector) const;
+    inline G4double GetTotalVisibility(G4int voxel) const;
+      // Probability to reach a detector / any detector
+
+    void SetVisibility(G4int voxel, G4int detector, G4double value);
+
+    void SetTimeDistribution(G4int voxel, G4int detector,
+                             const std::vector<G4double>& binContents);
+      // Sets the arrival time distribution from a histogram with
+      // GetNumberOfTimeBins() bins between 0 and GetMaxTime()
+
+    G4int SampleDetector(G4int voxel) const;
+      // Samples which detector a single photon emitted in the voxel
+      // reaches; returns -1 if it is not detected
+
+    G4double SampleArrivalTime(G4int voxel, G4int detector) const;
+      // Samples the arrival time of a detected photon relative to its
+      // emission time; returns 0 if no time distribution is stored
+
+  private:
+
+    G4bool CheckHeader() const;
+    void ComputeTotalVisibilities();
+
+  private:
+
+    G4ThreeVector fLower, fUpper;
+    G4int fNx = 0, fNy = 0, fNz = 0;
+    G4int fNumVoxels = 0;
+    G4int fNumDetectors = 0;
+    G4int fNumTimeBins = 0;
+    G4double fMaxTime = 0.;
+    G4double fInvSizeX = 0., fInvSizeY = 0., fInvSizeZ = 0.;
+
+    std::vector<passivefloat> fVisibility;       // [voxel][detector]
+    std::vector<passivefloat> fTimeCDF;          // [voxel][detector][bin]
+    std::vector<passivefloat> fTotalVisibility;  // [voxel]
+};
+
+#include "G4OpticalPhotonLibrary.icc"
+
+#endif
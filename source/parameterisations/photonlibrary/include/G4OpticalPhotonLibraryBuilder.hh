@@ -0,0 +1,127 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// G4OpticalPhotonLibraryBuilder
+//
+// Class description:
+//
+// Tool filling a G4OpticalPhotonLibrary by scanning its voxels with full
+// optical photon transport (G4OpBoundaryProcess and the bulk optical
+// processes) in the user geometry. Event N of the scan run emits the
+// configured number of isotropic, randomly polarised optical photons
+// uniformly inside voxel N, so a run of GetNumberOfScanEvents() events
+// covers the whole library.
+//
+// The builder is shared by all threads and is used from the user actions:
+//  - GeneratePrimaries() from the primary generator action;
+//  - ProcessStep() from the stepping action; a photon is counted as
+//    detected when G4OpBoundaryProcess reports the Detection status. The
+//    detector index is by default the copy number of the volume hit;
+//    GetDetectorIndex() can be overridden to provide another mapping;
+//  - FillLibrary() at the end of the run in the master thread, then
+//    G4OpticalPhotonLibrary::Write().
+// --------------------------------------------------------------------
+#ifndef G4OpticalPhotonLibraryBuilder_hh
+#define G4OpticalPhotonLibraryBuilder_hh 1
+
+#include "globals.hh"
+#include "G4Threading.hh"
+
+#include <vector>
+
+class G4Event;
+class G4OpBoundaryProcess;
+class G4OpticalPhotonLibrary;
+class G4Step;
+
+class G4OpticalPhotonLibraryBuilder
+{
+  public:
+
+    G4OpticalPhotonLibraryBuilder(G4OpticalPhotonLibrary* library,
+                                  G4int photonsPerVoxel,
+                                  G4double photonEnergy);
+    virtual ~G4OpticalPhotonLibraryBuilder() = default;
+
+    G4OpticalPhotonLibraryBuilder(const G4OpticalPhotonLibraryBuilder&)
+      = delete;
+    G4OpticalPhotonLibraryBuilder&
+      operator=(const G4OpticalPhotonLibraryBuilder&) = delete;
+
+    void GeneratePrimaries(G4Event* event);
+      // Emits the scan photons of the voxel matching the event number
+
+    void ProcessStep(const G4Step* step);
+      // Records the photons detected in the step
+
+    void FillLibrary();
+      // Converts the accumulated counts into visibilities and arrival
+      // time distributions of the library
+
+    void Reset();
+      // Clears the accumulated counts
+
+    inline G4int GetNumberOfScanEvents() const;
+    inline G4OpticalPhotonLibrary* GetLibrary() const;
+
+  protected:
+
+    virtual G4int GetDetectorIndex(const G4Step* step) const;
+      // Returns the photodetector reached in a detection step,
+      // or -1 to ignore the detection
+
+  private:
+
+    G4OpBoundaryProcess* GetBoundaryProcess() const;
+
+  private:
+
+    G4OpticalPhotonLibrary* fLibrary;
+    G4int fPhotonsPerVoxel;
+    G4double fPhotonEnergy;
+
+    std::vector<G4long> fEmitted;     // [voxel]
+    std::vector<G4long> fDetected;    // [voxel][detector]
+    std::vector<G4long> fTimeCounts;  // [voxel][detector][time bin]
+
+    G4Mutex fMutex = G4MUTEX_INITIALIZER;
+
+    static G4ThreadLocal G4OpBoundaryProcess* fBoundary;
+};
+
+inline G4int G4OpticalPhotonLibraryBuilder::GetNumberOfScanEvents() const
+{
+  return (G4int)fEmitted.size();
+}
+
+inline G4OpticalPhotonLibrary* G4OpticalPhotonLibraryBuilder::GetLibrary() const
+{
+  return fLibrary;
+}
+
+#endif
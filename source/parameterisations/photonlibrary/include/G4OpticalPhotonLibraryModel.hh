@@ -0,0 +1,97 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// G4OpticalPhotonLibraryModel
+//
+// Class description:
+//
+// Fast simulation model replacing the transport of optical photons in
+// an envelope by a look-up in a G4OpticalPhotonLibrary. Each optical
+// photon entering or created inside the envelope, within the bounds of
+// the library, is killed; the photodetector it reaches, if any, and its
+// arrival time are sampled from the library and passed to the hit
+// handler.
+//
+// ProcessGenStep() applies the same detector response directly to the
+// photon generation steps recorded by G4Cerenkov and G4Scintillation in
+// G4OpticalPhotonGenStepStore, without creating any photon track.
+// --------------------------------------------------------------------
+#ifndef G4OpticalPhotonLibraryModel_hh
+#define G4OpticalPhotonLibraryModel_hh 1
+
+#include "G4VFastSimulationModel.hh"
+
+class G4OpticalPhotonLibrary;
+class G4VOpticalPhotonLibraryHitHandler;
+struct G4OpticalPhotonGenStep;
+
+class G4OpticalPhotonLibraryModel : public G4VFastSimulationModel
+{
+  public:
+
+    G4OpticalPhotonLibraryModel(const G4String& name, G4Envelope* envelope,
+                                const G4OpticalPhotonLibrary* library,
+                                G4VOpticalPhotonLibraryHitHandler* handler);
+    G4OpticalPhotonLibraryModel(const G4String& name,
+                                const G4OpticalPhotonLibrary* library,
+                                G4VOpticalPhotonLibraryHitHandler* handler);
+    ~G4OpticalPhotonLibraryModel() override = default;
+
+    G4bool IsApplicable(const G4ParticleDefinition&) override;
+      // True for optical photons only
+
+    G4bool ModelTrigger(const G4FastTrack&) override;
+      // True if the photon is within the bounds of the library
+
+    void DoIt(const G4FastTrack&, G4FastStep&) override;
+
+    G4int ProcessGenStep(const G4OpticalPhotonGenStep& genStep);
+      // Produces the hits of the photons of a generation step, emitted
+      // evenly along the step. The step is split in segments of at most
+      // one voxel size and the number of detected photons per detector
+      // and segment is sampled from a Poisson distribution.
+      // Returns the number of hits
+
+    inline void SetHitHandler(G4VOpticalPhotonLibraryHitHandler* handler)
+      { fHandler = handler; }
+    inline G4VOpticalPhotonLibraryHitHandler* GetHitHandler() const
+      { return fHandler; }
+    inline const G4OpticalPhotonLibrary* GetLibrary() const
+      { return fLibrary; }
+
+  private:
+
+    G4double SampleEmissionDelay(const G4OpticalPhotonGenStep& genStep) const;
+
+  private:
+
+    const G4OpticalPhotonLibrary* fLibrary = nullptr;
+    G4VOpticalPhotonLibraryHitHandler* fHandler = nullptr;
+};
+
+#endif
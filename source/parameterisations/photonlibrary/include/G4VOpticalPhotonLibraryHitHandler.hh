@@ -0,0 +1,59 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// G4VOpticalPhotonLibraryHitHandler
+//
+// Class description:
+//
+// Abstract interface receiving the photodetector hits produced by
+// G4OpticalPhotonLibraryModel. Users implement ProcessHit() to fill
+// their hit collections or digitisation.
+// --------------------------------------------------------------------
+#ifndef G4VOpticalPhotonLibraryHitHandler_hh
+#define G4VOpticalPhotonLibraryHitHandler_hh 1
+
+#include "globals.hh"
+
+class G4Track;
+
+class G4VOpticalPhotonLibraryHitHandler
+{
+  public:
+
+    G4VOpticalPhotonLibraryHitHandler() = default;
+    virtual ~G4VOpticalPhotonLibraryHitHandler() = default;
+
+    virtual void ProcessHit(G4int detector, G4double time,
+                            const G4Track* photon) = 0;
+      // Called for each photon reaching the given photodetector at the
+      // given global time. The photon track is provided when the hit
+      // comes from a tracked optical photon, and is null when the hit
+      // is produced from a stored photon generation step
+};
+
+#endif
@@ -0,0 +1,31 @@
+# - G4photonlibrary module build definition
+
+# Define the Geant4 Module.
+geant4_add_module(G4photonlibrary
+  PUBLIC_HEADERS
+    G4OpticalPhotonLibrary.hh
+    G4OpticalPhotonLibrary.icc
+    G4OpticalPhotonLibraryBuilder.hh
+    G4OpticalPhotonLibraryModel.hh
+    G4VOpticalPhotonLibraryHitHandler.hh
+  SOURCES
+    G4OpticalPhotonLibrary.cc
+    G4OpticalPhotonLibraryBuilder.cc
+    G4OpticalPhotonLibraryModel.cc)
+
+geant4_module_link_libraries(G4photonlibrary
+  PUBLIC
+    G4parameterisation
+    G4track
+    G4globman
+    G4hepgeometry
+    G4xrays
+  PRIVATE
+    G4bosons
+    G4event
+    G4heprandom
+    G4hepnumerics
+    G4optical
+    G4partman
+    G4procman
+  )
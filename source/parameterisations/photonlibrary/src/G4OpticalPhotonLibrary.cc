@@ -0,0 +1,303 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// G4OpticalPhotonLibrary implementation
+//
+// --------------------------------------------------------------------
+
+#include "G4OpticalPhotonLibrary.hh"
+
+#include "G4SystemOfUnits.hh"
+#include "Randomize.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+  const char kMagic[8] = "G4OPLIB";
+  const std::uint32_t kVersion = 2;
+}
+
+// --------------------------------------------------------------------
+G4OpticalPhotonLibrary::G4OpticalPhotonLibrary() = default;
+
+// --------------------------------------------------------------------
+G4OpticalPhotonLibrary::G4OpticalPhotonLibrary(const G4ThreeVector& lower,
+                                               const G4ThreeVector& upper,
+                                               G4int nx, G4int ny, G4int nz,
+                                               G4int nDetectors,
+                                               G4int nTimeBins,
+                                               G4double maxTime)
+  : fLower(lower), fUpper(upper), fNx(nx), fNy(ny), fNz(nz),
+    fNumDetectors(nDetectors), fNumTimeBins(nTimeBins), fMaxTime(maxTime)
+{
+  if (!CheckHeader())
+  {
+    G4ExceptionDescription ed;
+    ed << "Invalid library definition: " << nx << " x " << ny << " x " << nz
+       << " voxels between " << lower << " and " << upper << ", "
+       << nDetectors << " detectors, " << nTimeBins << " time bins up to "
+       << maxTime/ns << " ns.";
+    G4Exception("G4OpticalPhotonLibrary::G4OpticalPhotonLibrary()",
+                "PhotonLib001", FatalException, ed);
+    return;
+  }
+  fNumVoxels = fNx*fNy*fNz;
+  fInvSizeX = fNx/(fUpper.x()-fLower.x());
+  fInvSizeY = fNy/(fUpper.y()-fLower.y());
+  fInvSizeZ = fNz/(fUpper.z()-fLower.z());
+  fVisibility.assign(std::size_t(fNumVoxels)*fNumDetectors, 0.f);
+  fTimeCDF.assign(std::size_t(fNumVoxels)*fNumDetectors*fNumTimeBins, 0.f);
+  fTotalVisibility.assign(fNumVoxels, 0.f);
+}
+
+// --------------------------------------------------------------------
+G4bool G4OpticalPhotonLibrary::CheckHeader() const
+{
+  return fNx > 0 && fNy > 0 && fNz > 0 && fNumDetectors > 0
+      && fNumTimeBins >= 0 && (fNumTimeBins == 0 || fMaxTime > 0.)
+      && fUpper.x() > fLower.x() && fUpper.y() > fLower.y()
+      && fUpper.z() > fLower.z();
+}
+
+// --------------------------------------------------------------------
+G4bool G4OpticalPhotonLibrary::Load(const G4String& fileName)
+{
+  std::ifstream in(fileName, std::ios::binary);
+  if (!in)
+  {
+    G4ExceptionDescription ed;
+    ed << "Cannot open optical photon library file " << fileName;
+    G4Exception("G4OpticalPhotonLibrary::Load()", "PhotonLib002",
+                JustWarning, ed);
+    return false;
+  }
+
+  char magic[8];
+  std::uint32_t version = 0;
+  std::uint32_t padding = 0;
+  std::int32_t dims[6];
+  passivedouble bounds[7];
+  in.read(magic, sizeof(magic));
+  in.read(reinterpret_cast<char*>(&version), sizeof(version));
+  in.read(reinterpret_cast<char*>(&padding), sizeof(padding));
+  in.read(reinterpret_cast<char*>(dims), sizeof(dims));
+  in.read(reinterpret_cast<char*>(bounds), sizeof(bounds));
+  if (!in || std::memcmp(magic, kMagic, sizeof(magic)) != 0
+          || version != kVersion)
+  {
+    G4ExceptionDescription ed;
+    ed << "File " << fileName << " is not an optical photon library"
+       << " of format version " << kVersion;
+    G4Exception("G4OpticalPhotonLibrary::Load()", "PhotonLib003",
+                JustWarning, ed);
+    return false;
+  }
+
+  fNx = dims[0];
+  fNy = dims[1];
+  fNz = dims[2];
+  fNumDetectors = dims[3];
+  fNumTimeBins = dims[4];
+  fLower.set(bounds[0], bounds[1], bounds[2]);
+  fUpper.set(bounds[3], bounds[4], bounds[5]);
+  fMaxTime = bounds[6];
+  if (!CheckHeader())
+  {
+    G4ExceptionDescription ed;
+    ed << "Corrupted header in optical photon library file " << fileName;
+    G4Exception("G4OpticalPhotonLibrary::Load()", "PhotonLib003",
+                JustWarning, ed);
+    return false;
+  }
+
+  fNumVoxels = fNx*fNy*fNz;
+  fInvSizeX = fNx/(fUpper.x()-fLower.x());
+  fInvSizeY = fNy/(fUpper.y()-fLower.y());
+  fInvSizeZ = fNz/(fUpper.z()-fLower.z());
+  fVisibility.resize(std::size_t(fNumVoxels)*fNumDetectors);
+  fTimeCDF.resize(std::size_t(fNumVoxels)*fNumDetectors*fNumTimeBins);
+  in.read(reinterpret_cast<char*>(fVisibility.data()),
+          fVisibility.size()*sizeof(passivefloat));
+  in.read(reinterpret_cast<char*>(fTimeCDF.data()),
+          fTimeCDF.size()*sizeof(passivefloat));
+  if (!in)
+  {
+    G4ExceptionDescription ed;
+    ed << "Truncated optical photon library file " << fileName;
+    G4Exception("G4OpticalPhotonLibrary::Load()", "PhotonLib004",
+                JustWarning, ed);
+    return false;
+  }
+  ComputeTotalVisibilities();
+  return true;
+}
+
+// --------------------------------------------------------------------
+G4bool G4OpticalPhotonLibrary::Write(const G4String& fileName) const
+{
+  std::ofstream out(fileName, std::ios::binary);
+  if (!out)
+  {
+    G4ExceptionDescription ed;
+    ed << "Cannot open optical photon library file " << fileName;
+    G4Exception("G4OpticalPhotonLibrary::Write()", "PhotonLib002",
+                JustWarning, ed);
+    return false;
+  }
+
+  const std::int32_t dims[6] = { fNx, fNy, fNz,
+                                 fNumDetectors, fNumTimeBins, 0 };
+  const passivedouble bounds[7] = {
+    (passivedouble)fLower.x(), (passivedouble)fLower.y(),
+    (passivedouble)fLower.z(), (passivedouble)fUpper.x(),
+    (passivedouble)fUpper.y(), (passivedouble)fUpper.z(),
+    (passivedouble)fMaxTime };
+  // The padding word keeps the doubles of the header 8-byte aligned
+  const std::uint32_t padding = 0;
+  out.write(kMagic, sizeof(kMagic));
+  out.write(reinterpret_cast<const char*>(&kVersion), sizeof(kVersion));
+  out.write(reinterpret_cast<const char*>(&padding), sizeof(padding));
+  out.write(reinterpret_cast<const char*>(dims), sizeof(dims));
+  out.write(reinterpret_cast<const char*>(bounds), sizeof(bounds));
+  out.write(reinterpret_cast<const char*>(fVisibility.data()),
+            fVisibility.size()*sizeof(passivefloat));
+  out.write(reinterpret_cast<const char*>(fTimeCDF.data()),
+            fTimeCDF.size()*sizeof(passivefloat));
+  return out.good();
+}
+
+// --------------------------------------------------------------------
+G4int G4OpticalPhotonLibrary::GetVoxelIndex(const G4ThreeVector& p) const
+{
+  if (p.x() < fLower.x() || p.x() >= fUpper.x()
+   || p.y() < fLower.y() || p.y() >= fUpper.y()
+   || p.z() < fLower.z() || p.z() >= fUpper.z())
+  {
+    return -1;
+  }
+  G4int ix = std::min(G4int((p.x()-fLower.x())*fInvSizeX), fNx-1);
+  G4int iy = std::min(G4int((p.y()-fLower.y())*fInvSizeY), fNy-1);
+  G4int iz = std::min(G4int((p.z()-fLower.z())*fInvSizeZ), fNz-1);
+  return ix + fNx*(iy + fNy*iz);
+}
+
+// --------------------------------------------------------------------
+G4ThreeVector G4OpticalPhotonLibrary::GetVoxelLowerCorner(G4int voxel) const
+{
+  G4int ix = voxel % fNx;
+  G4int iy = (voxel / fNx) % fNy;
+  G4int iz = voxel / (fNx*fNy);
+  G4ThreeVector size = GetVoxelSize();
+  return G4ThreeVector(fLower.x() + ix*size.x(),
+                       fLower.y() + iy*size.y(),
+                       fLower.z() + iz*size.z());
+}
+
+// --------------------------------------------------------------------
+void G4OpticalPhotonLibrary::SetVisibility(G4int voxel, G4int detector,
+                                           G4double value)
+{
+  passivefloat& vis = fVisibility[std::size_t(voxel)*fNumDetectors + detector];
+  fTotalVisibility[voxel] += (passivefloat)((passivedouble)value) - vis;
+  vis = (passivefloat)((passivedouble)value);
+}
+
+// --------------------------------------------------------------------
+void G4OpticalPhotonLibrary::
+SetTimeDistribution(G4int voxel, G4int detector,
+                    const std::vector<G4double>& binContents)
+{
+  if (fNumTimeBins == 0) { return; }
+
+  passivefloat* cdf =
+    &fTimeCDF[(std::size_t(voxel)*fNumDetectors + detector)*fNumTimeBins];
+  passivedouble sum = 0.;
+  for (G4int i=0; i<fNumTimeBins; ++i)
+  {
+    if (i < (G4int)binContents.size())
+    {
+      sum += std::max((passivedouble)binContents[i], 0.);
+    }
+    cdf[i] = (passivefloat)sum;
+  }
+  if (sum > 0.)
+  {
+    for (G4int i=0; i<fNumTimeBins; ++i) { cdf[i] /= (passivefloat)sum; }
+  }
+}
+
+// --------------------------------------------------------------------
+void G4OpticalPhotonLibrary::ComputeTotalVisibilities()
+{
+  fTotalVisibility.assign(fNumVoxels, 0.f);
+  for (G4int v=0; v<fNumVoxels; ++v)
+  {
+    const passivefloat* vis = &fVisibility[std::size_t(v)*fNumDetectors];
+    for (G4int d=0; d<fNumDetectors; ++d) { fTotalVisibility[v] += vis[d]; }
+  }
+}
+
+// --------------------------------------------------------------------
+G4int G4OpticalPhotonLibrary::SampleDetector(G4int voxel) const
+{
+  const passivedouble u = (passivedouble)G4UniformRand();
+  if (u >= fTotalVisibility[voxel]) { return -1; }
+
+  const passivefloat* vis = &fVisibility[std::size_t(voxel)*fNumDetectors];
+  passivedouble sum = 0.;
+  for (G4int d=0; d<fNumDetectors; ++d)
+  {
+    sum += vis[d];
+    if (u < sum) { return d; }
+  }
+  return -1;
+}
+
+// --------------------------------------------------------------------
+G4double G4OpticalPhotonLibrary::SampleArrivalTime(G4int voxel,
+                                                   G4int detector) const
+{
+  if (fNumTimeBins == 0) { return 0.; }
+
+  const passivefloat* cdf =
+    &fTimeCDF[(std::size_t(voxel)*fNumDetectors + detector)*fNumTimeBins];
+  const passivefloat last = cdf[fNumTimeBins-1];
+  if (last <= 0.f) { return 0.; }
+
+  const passivefloat u = (passivefloat)((passivedouble)G4UniformRand())*last;
+  G4int bin = G4int(std::upper_bound(cdf, cdf+fNumTimeBins, u) - cdf);
+  bin = std::min(bin, fNumTimeBins-1);
+  const passivefloat lo = (bin > 0) ? cdf[bin-1] : 0.f;
+  const passivefloat hi = cdf[bin];
+  const passivedouble frac = (hi > lo) ? (u-lo)/(hi-lo) : 0.5;
+  return (bin + frac)*fMaxTime/fNumTimeBins;
+}
@@ -0,0 +1,200 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// G4OpticalPhotonLibraryBuilder implementation
+//
+// --------------------------------------------------------------------
+
+#include "G4OpticalPhotonLibraryBuilder.hh"
+#include "G4OpticalPhotonLibrary.hh"
+
+#include "G4AutoLock.hh"
+#include "G4Event.hh"
+#include "G4EventManager.hh"
+#include "G4OpBoundaryProcess.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4PrimaryParticle.hh"
+#include "G4PrimaryVertex.hh"
+#include "G4ProcessManager.hh"
+#include "G4ProcessVector.hh"
+#include "G4Step.hh"
+#include "G4VPhysicalVolume.hh"
+#include "Randomize.hh"
+
+#include <algorithm>
+
+G4ThreadLocal G4OpBoundaryProcess*
+  G4OpticalPhotonLibraryBuilder::fBoundary = nullptr;
+
+// --------------------------------------------------------------------
+G4OpticalPhotonLibraryBuilder::
+G4OpticalPhotonLibraryBuilder(G4OpticalPhotonLibrary* library,
+                              G4int photonsPerVoxel, G4double photonEnergy)
+  : fLibrary(library), fPhotonsPerVoxel(photonsPerVoxel),
+    fPhotonEnergy(photonEnergy)
+{
+  Reset();
+}
+
+// --------------------------------------------------------------------
+void G4OpticalPhotonLibraryBuilder::Reset()
+{
+  const std::size_t nVoxels = fLibrary->GetNumberOfVoxels();
+  const std::size_t nDetectors = fLibrary->GetNumberOfDetectors();
+  const std::size_t nTimeBins = fLibrary->GetNumberOfTimeBins();
+  fEmitted.assign(nVoxels, 0);
+  fDetected.assign(nVoxels*nDetectors, 0);
+  fTimeCounts.assign(nVoxels*nDetectors*nTimeBins, 0);
+}
+
+// --------------------------------------------------------------------
+void G4OpticalPhotonLibraryBuilder::GeneratePrimaries(G4Event* event)
+{
+  const G4int voxel = event->GetEventID();
+  if (voxel < 0 || voxel >= fLibrary->GetNumberOfVoxels()) { return; }
+
+  const G4ThreeVector corner = fLibrary->GetVoxelLowerCorner(voxel);
+  const G4ThreeVector size = fLibrary->GetVoxelSize();
+  for (G4int i=0; i<fPhotonsPerVoxel; ++i)
+  {
+    G4ThreeVector position(corner.x() + G4UniformRand()*size.x(),
+                           corner.y() + G4UniformRand()*size.y(),
+                           corner.z() + G4UniformRand()*size.z());
+
+    // isotropic direction and random linear polarisation
+    G4double cost = 1. - 2.*G4UniformRand();
+    G4double sint = std::sqrt((1. - cost)*(1. + cost));
+    G4double phi = twopi*G4UniformRand();
+    G4ThreeVector direction(sint*std::cos(phi), sint*std::sin(phi), cost);
+    G4ThreeVector polarisation = direction.orthogonal().unit();
+    polarisation.rotate(twopi*G4UniformRand(), direction);
+
+    auto particle =
+      new G4PrimaryParticle(G4OpticalPhoton::OpticalPhotonDefinition());
+    particle->SetMomentumDirection(direction);
+    particle->SetKineticEnergy(fPhotonEnergy);
+    particle->SetPolarization(polarisation);
+
+    auto vertex = new G4PrimaryVertex(position, 0.);
+    vertex->SetPrimary(particle);
+    event->AddPrimaryVertex(vertex);
+  }
+
+  G4AutoLock l(&fMutex);
+  fEmitted[voxel] += fPhotonsPerVoxel;
+}
+
+// --------------------------------------------------------------------
+void G4OpticalPhotonLibraryBuilder::ProcessStep(const G4Step* step)
+{
+  const G4Track* track = step->GetTrack();
+  if (track->GetDefinition() != G4OpticalPhoton::OpticalPhotonDefinition())
+  {
+    return;
+  }
+
+  G4OpBoundaryProcess* boundary = GetBoundaryProcess();
+  if (boundary == nullptr || boundary->GetStatus() != Detection) { return; }
+  if (step->GetPostStepPoint()->GetStepStatus() != fGeomBoundary) { return; }
+
+  const G4int detector = GetDetectorIndex(step);
+  if (detector < 0 || detector >= fLibrary->GetNumberOfDetectors()) { return; }
+
+  const G4Event* event =
+    G4EventManager::GetEventManager()->GetConstCurrentEvent();
+  const G4int voxel = (event != nullptr) ? event->GetEventID() : -1;
+  if (voxel < 0 || voxel >= fLibrary->GetNumberOfVoxels()) { return; }
+
+  const std::size_t index =
+    std::size_t(voxel)*fLibrary->GetNumberOfDetectors() + detector;
+  const G4int nTimeBins = fLibrary->GetNumberOfTimeBins();
+  G4int bin = -1;
+  if (nTimeBins > 0)
+  {
+    bin = G4int(step->GetPostStepPoint()->GetGlobalTime()
+                / fLibrary->GetMaxTime()*nTimeBins);
+    bin = std::min(std::max(bin, 0), nTimeBins-1);
+  }
+
+  G4AutoLock l(&fMutex);
+  ++fDetected[index];
+  if (bin >= 0) { ++fTimeCounts[index*nTimeBins + bin]; }
+}
+
+// --------------------------------------------------------------------
+G4int G4OpticalPhotonLibraryBuilder::GetDetectorIndex(const G4Step* step) const
+{
+  return step->GetPostStepPoint()->GetTouchable()->GetCopyNumber();
+}
+
+// --------------------------------------------------------------------
+G4OpBoundaryProcess* G4OpticalPhotonLibraryBuilder::GetBoundaryProcess() const
+{
+  if (fBoundary == nullptr)
+  {
+    G4ProcessManager* pm =
+      G4OpticalPhoton::OpticalPhotonDefinition()->GetProcessManager();
+    if (pm == nullptr) { return nullptr; }
+    G4ProcessVector* pv = pm->GetProcessList();
+    for (std::size_t i=0; i<pv->size(); ++i)
+    {
+      fBoundary = dynamic_cast<G4OpBoundaryProcess*>((*pv)[i]);
+      if (fBoundary != nullptr) { break; }
+    }
+  }
+  return fBoundary;
+}
+
+// --------------------------------------------------------------------
+void G4OpticalPhotonLibraryBuilder::FillLibrary()
+{
+  G4AutoLock l(&fMutex);
+
+  const G4int nVoxels = fLibrary->GetNumberOfVoxels();
+  const G4int nDetectors = fLibrary->GetNumberOfDetectors();
+  const G4int nTimeBins = fLibrary->GetNumberOfTimeBins();
+  std::vector<G4double> times(nTimeBins);
+  for (G4int v=0; v<nVoxels; ++v)
+  {
+    if (fEmitted[v] == 0) { continue; }
+    for (G4int d=0; d<nDetectors; ++d)
+    {
+      const std::size_t index = std::size_t(v)*nDetectors + d;
+      fLibrary->SetVisibility(v, d, G4double(fDetected[index])/fEmitted[v]);
+      if (nTimeBins > 0)
+      {
+        for (G4int b=0; b<nTimeBins; ++b)
+        {
+          times[b] = (G4double)fTimeCounts[index*nTimeBins + b];
+        }
+        fLibrary->SetTimeDistribution(v, d, times);
+      }
+    }
+  }
+}
@@ -0,0 +1,170 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// G4OpticalPhotonLibraryModel implementation
+//
+// --------------------------------------------------------------------
+
+#include "G4OpticalPhotonLibraryModel.hh"
+#include "G4OpticalPhotonLibrary.hh"
+#include "G4VOpticalPhotonLibraryHitHandler.hh"
+
+#include "G4FastStep.hh"
+#include "G4FastTrack.hh"
+#include "G4Log.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4OpticalPhotonGenStep.hh"
+#include "G4Poisson.hh"
+#include "G4Track.hh"
+#include "Randomize.hh"
+
+#include <algorithm>
+
+// --------------------------------------------------------------------
+G4OpticalPhotonLibraryModel::
+G4OpticalPhotonLibraryModel(const G4String& name, G4Envelope* envelope,
+                            const G4OpticalPhotonLibrary* library,
+                            G4VOpticalPhotonLibraryHitHandler* handler)
+  : G4VFastSimulationModel(name, envelope),
+    fLibrary(library), fHandler(handler)
+{
+}
+
+// --------------------------------------------------------------------
+G4OpticalPhotonLibraryModel::
+G4OpticalPhotonLibraryModel(const G4String& name,
+                            const G4OpticalPhotonLibrary* library,
+                            G4VOpticalPhotonLibraryHitHandler* handler)
+  : G4VFastSimulationModel(name),
+    fLibrary(library), fHandler(handler)
+{
+}
+
+// --------------------------------------------------------------------
+G4bool
+G4OpticalPhotonLibraryModel::IsApplicable(const G4ParticleDefinition& part)
+{
+  return &part == G4OpticalPhoton::OpticalPhotonDefinition();
+}
+
+// --------------------------------------------------------------------
+G4bool G4OpticalPhotonLibraryModel::ModelTrigger(const G4FastTrack& fastTrack)
+{
+  return fLibrary != nullptr
+    && fLibrary->GetVoxelIndex(fastTrack.GetPrimaryTrack()->GetPosition()) >= 0;
+}
+
+// --------------------------------------------------------------------
+void G4OpticalPhotonLibraryModel::DoIt(const G4FastTrack& fastTrack,
+                                       G4FastStep& fastStep)
+{
+  const G4Track* track = fastTrack.GetPrimaryTrack();
+  fastStep.KillPrimaryTrack();
+  fastStep.ProposePrimaryTrackPathLength(0.0);
+
+  G4int voxel = fLibrary->GetVoxelIndex(track->GetPosition());
+  if (voxel < 0 || fHandler == nullptr) { return; }
+
+  G4int detector = fLibrary->SampleDetector(voxel);
+  if (detector < 0) { return; }
+
+  fHandler->ProcessHit(detector, track->GetGlobalTime()
+                       + fLibrary->SampleArrivalTime(voxel, detector), track);
+}
+
+// --------------------------------------------------------------------
+G4int
+G4OpticalPhotonLibraryModel::ProcessGenStep(const G4OpticalPhotonGenStep& gs)
+{
+  if (fLibrary == nullptr || fHandler == nullptr || gs.numPhotons <= 0)
+  {
+    return 0;
+  }
+
+  // Photons from neutral particles are emitted at the post-step point,
+  // as done in G4Scintillation
+  G4int nSegments = 1;
+  if (gs.charge != 0.)
+  {
+    G4ThreeVector size = fLibrary->GetVoxelSize();
+    G4double minSize = std::min(std::min(size.x(), size.y()), size.z());
+    nSegments = G4int(gs.deltaPosition.mag()/minSize) + 1;
+    nSegments = std::min(nSegments, gs.numPhotons);
+  }
+
+  const G4int nDetectors = fLibrary->GetNumberOfDetectors();
+  G4int nHits = 0;
+  for (G4int s=0; s<nSegments; ++s)
+  {
+    G4int nPhotons = gs.numPhotons/nSegments
+                   + ((s < gs.numPhotons%nSegments) ? 1 : 0);
+    G4double frac = (gs.charge != 0.) ? (s + 0.5)/nSegments : 1.;
+
+    G4int voxel = fLibrary->GetVoxelIndex(gs.position
+                                          + frac*gs.deltaPosition);
+    if (voxel < 0 || fLibrary->GetTotalVisibility(voxel) <= 0.) { continue; }
+
+    G4double emissionTime = gs.time;
+    if (gs.stepLength > 0.)
+    {
+      emissionTime += frac*gs.stepLength
+        / (gs.preVelocity + frac*(gs.postVelocity - gs.preVelocity)*0.5);
+    }
+
+    for (G4int d=0; d<nDetectors; ++d)
+    {
+      G4double mean = nPhotons*fLibrary->GetVisibility(voxel, d);
+      if (mean <= 0.) { continue; }
+      G4long nDetected = G4Poisson(mean);
+      for (G4long i=0; i<nDetected; ++i)
+      {
+        fHandler->ProcessHit(d, emissionTime + SampleEmissionDelay(gs)
+                             + fLibrary->SampleArrivalTime(voxel, d), nullptr);
+      }
+      nHits += (G4int)nDetected;
+    }
+  }
+  return nHits;
+}
+
+// --------------------------------------------------------------------
+G4double G4OpticalPhotonLibraryModel::
+SampleEmissionDelay(const G4OpticalPhotonGenStep& gs) const
+{
+  if (gs.processIndex != kScintillation || gs.scintTime <= 0.) { return 0.; }
+
+  G4double delay = -gs.scintTime*G4Log(G4UniformRand());
+  if (gs.riseTime > 0.)
+  {
+    // The bi-exponential emission profile of G4Scintillation is the sum
+    // of two exponential times of constants tau2 and tau1*tau2/(tau1+tau2)
+    delay -= gs.riseTime*gs.scintTime/(gs.riseTime + gs.scintTime)
+           * G4Log(G4UniformRand());
+  }
+  return delay;
+}
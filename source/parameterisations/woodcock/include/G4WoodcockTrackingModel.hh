@@ -0,0 +1,190 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// G4WoodcockTrackingModel
+//
+// Class description:
+//
+// Fast simulation model transporting gammas through a voxelised phantom
+// (G4PhantomParameterisation, navigated by G4RegularNavigation) with
+// Woodcock (delta) tracking: flight distances are sampled with a majorant
+// cross section, the maximum over all phantom materials of the total
+// cross section of the gamma processes, and the interaction at the end of
+// a flight is real with probability mu(material)/majorant, fictitious
+// otherwise. Voxel boundaries are thus never stepped on.
+//
+// The envelope must be the phantom container, i.e. the region root
+// logical volume whose single daughter is the voxel parameterisation.
+// Real interactions are performed by the gamma processes themselves,
+// which must derive from G4VEmProcess; G4GammaGeneralProcess is not
+// supported, and other discrete processes (e.g. photo-nuclear) are ignored
+// inside the envelope with a warning.
+//
+// The gamma is transported until it leaves the envelope or is absorbed.
+// The primary track is then killed and, if the gamma survives, a new
+// track is created at its exit point, so it is relocated by the
+// navigator. Secondaries are created at their real interaction points.
+// Local energy deposits at interaction points are passed to
+// DepositEnergy(), which by default hands them to the sensitive detector
+// of the voxels, located at the interaction point.
+//
+// The processes are invoked on a work track and step set up at each real
+// interaction point; the state left in the processes by these calls is
+// restored for the primary track at the end of DoIt().
+//
+// The majorant of a bin is the maximum of the cross sections at the bin
+// edges and at the nodes of the lambda tables of the processes inside the
+// bin. If a larger cross section is nevertheless met, the majorant of the
+// bin is raised and the flight is sampled again.
+//
+// The majorant table is built at the first trigger; Reset() must be called
+// if geometry, materials or physics change between runs.
+// --------------------------------------------------------------------
+#ifndef G4WoodcockTrackingModel_hh
+#define G4WoodcockTrackingModel_hh 1
+
+#include "G4VFastSimulationModel.hh"
+#include "G4TouchableHandle.hh"
+
+#include <vector>
+
+class G4DynamicParticle;
+class G4LogicalVolume;
+class G4MaterialCutsCouple;
+class G4Navigator;
+class G4ParticleChangeForGamma;
+class G4PhantomParameterisation;
+class G4Step;
+class G4Track;
+class G4VEmProcess;
+
+class G4WoodcockTrackingModel : public G4VFastSimulationModel
+{
+  public:
+
+    G4WoodcockTrackingModel(const G4String& name, G4Envelope* envelope);
+    G4WoodcockTrackingModel(const G4String& name);
+    ~G4WoodcockTrackingModel() override;
+
+    G4bool IsApplicable(const G4ParticleDefinition&) override;
+      // True for gammas only
+
+    G4bool ModelTrigger(const G4FastTrack&) override;
+      // True for gammas inside the envelope with an energy within the
+      // range of the majorant table
+
+    void DoIt(const G4FastTrack&, G4FastStep&) override;
+
+    void SetMajorantBinning(G4double emin, G4double emax,
+                            G4int binsPerDecade);
+      // Energy range and binning of the majorant table. By default the
+      // range is that of G4EmParameters with 20 bins per decade
+    void SetMajorantMargin(G4double margin);
+      // Relative margin added to the majorant, 5% by default, which covers
+      // the cross sections of processes without lambda tables
+
+    void Reset();
+      // Clears the tables; they are rebuilt at the next trigger
+
+    inline G4long GetNumberOfRealInteractions() const
+      { return fNReal; }
+    inline G4long GetNumberOfFictitiousInteractions() const
+      { return fNFictitious; }
+
+  protected:
+
+    virtual void DepositEnergy(G4double edep,
+                               const G4ThreeVector& globalPosition,
+                               G4int copyNo);
+      // Called for the local energy deposit of a real interaction in
+      // voxel copyNo. The default implementation locates the interaction
+      // point and passes the deposit to the sensitive detector of the
+      // voxels, if any, as a step in that voxel; otherwise it is added to
+      // the total energy deposit of the fast step
+
+  private:
+
+    struct Secondary
+    {
+      G4DynamicParticle* fParticle;
+      G4ThreeVector fPosition;
+      G4double fTime;
+      G4double fWeight;
+      G4int fCreatorModelID;
+    };
+
+    void Initialise(const G4FastTrack&);
+    void BuildMajorant();
+    G4int GetMajorantBin(G4double ekin) const;
+    G4double CrossSection(std::size_t materialIndex, G4double ekin);
+      // Total cross section per volume, partial sums in fPartialXS
+    G4int GetCopyNo(const G4ThreeVector& localPoint) const;
+    G4bool Interact(std::size_t processIndex, std::size_t materialIndex,
+                    const G4ThreeVector& globalPosition, G4int copyNo,
+                    G4double& ekin, G4ThreeVector& dir, G4ThreeVector& pol,
+                    G4double time, G4double weight);
+      // Performs a real interaction, appending its secondaries to
+      // fSecondaries; returns false if the gamma is absorbed
+
+  private:
+
+    G4bool fInitialised = false;
+
+    G4PhantomParameterisation* fPhantom = nullptr;
+    G4LogicalVolume* fVoxelVolume = nullptr;
+    G4double fHalfX = 0., fHalfY = 0., fHalfZ = 0.;
+    G4int fNx = 0, fNy = 0, fNz = 0;
+
+    std::vector<G4VEmProcess*> fProcesses;
+    std::vector<G4ParticleChangeForGamma*> fChanges;
+      // particle change of each process invoked in the current DoIt()
+    std::vector<const G4MaterialCutsCouple*> fCouples;
+      // couple of each phantom material in the envelope region
+    std::vector<G4double> fPartialXS;
+
+    G4double fEmin = 0., fEmax = 0.;
+    G4int fBinsPerDecade = 20;
+    G4double fMargin = 0.05;
+    G4double fLogEmin = 0., fInvLogBin = 0.;
+    std::vector<G4double> fMajorant;
+
+    G4Track* fWorkTrack = nullptr;
+    G4Step* fWorkStep = nullptr;
+      // used to invoke the processes at real interaction points
+    G4Navigator* fNavigator = nullptr;
+    G4TouchableHandle fTouchable;
+      // locate energy deposits in the voxels
+    std::vector<Secondary> fSecondaries;
+    G4double fEnergyDeposit = 0.;
+
+    G4long fNReal = 0;
+    G4long fNFictitious = 0;
+    G4bool fMajorantWarned = false;
+};
+
+#endif
@@ -0,0 +1,28 @@
+# - G4woodcock module build definition
+
+# Define the Geant4 Module.
+geant4_add_module(G4woodcock
+  PUBLIC_HEADERS
+    G4WoodcockTrackingModel.hh
+  SOURCES
+    G4WoodcockTrackingModel.cc)
+
+geant4_module_link_libraries(G4woodcock
+  PUBLIC
+    G4parameterisation
+    G4geometrymng
+    G4globman
+    G4hepgeometry
+  PRIVATE
+    G4bosons
+    G4cuts
+    G4detector
+    G4emutils
+    G4heprandom
+    G4materials
+    G4navigation
+    G4partman
+    G4procman
+    G4track
+    G4volumes
+  )
@@ -0,0 +1,588 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// G4WoodcockTrackingModel implementation
+//
+// --------------------------------------------------------------------
+
+#include "G4WoodcockTrackingModel.hh"
+
+#include "G4AffineTransform.hh"
+#include "G4DynamicParticle.hh"
+#include "G4EmParameters.hh"
+#include "G4EmProcessSubType.hh"
+#include "G4Exp.hh"
+#include "G4FastStep.hh"
+#include "G4FastTrack.hh"
+#include "G4Gamma.hh"
+#include "G4Log.hh"
+#include "G4LogicalVolume.hh"
+#include "G4Navigator.hh"
+#include "G4ParticleChangeForGamma.hh"
+#include "G4PhantomParameterisation.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4PhysicsTable.hh"
+#include "G4ProcessManager.hh"
+#include "G4ProcessVector.hh"
+#include "G4ProductionCutsTable.hh"
+#include "G4Region.hh"
+#include "G4Step.hh"
+#include "G4TouchableHistory.hh"
+#include "G4Track.hh"
+#include "G4TransportationManager.hh"
+#include "G4VEmProcess.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VSensitiveDetector.hh"
+#include "G4VSolid.hh"
+#include "Randomize.hh"
+
+#include <algorithm>
+#include <cmath>
+
+// --------------------------------------------------------------------
+G4WoodcockTrackingModel::
+G4WoodcockTrackingModel(const G4String& name, G4Envelope* envelope)
+  : G4VFastSimulationModel(name, envelope)
+{
+}
+
+// --------------------------------------------------------------------
+G4WoodcockTrackingModel::G4WoodcockTrackingModel(const G4String& name)
+  : G4VFastSimulationModel(name)
+{
+}
+
+// --------------------------------------------------------------------
+G4WoodcockTrackingModel::~G4WoodcockTrackingModel()
+{
+  Reset();
+}
+
+// --------------------------------------------------------------------
+G4bool
+G4WoodcockTrackingModel::IsApplicable(const G4ParticleDefinition& particle)
+{
+  return &particle == G4Gamma::Gamma();
+}
+
+// --------------------------------------------------------------------
+G4bool G4WoodcockTrackingModel::ModelTrigger(const G4FastTrack& fastTrack)
+{
+  if(!fInitialised) { Initialise(fastTrack); }
+
+  const G4double ekin = fastTrack.GetPrimaryTrack()->GetKineticEnergy();
+  return ekin >= fEmin && ekin < fEmax &&
+         !fastTrack.OnTheBoundaryButExiting();
+}
+
+// --------------------------------------------------------------------
+void G4WoodcockTrackingModel::SetMajorantBinning(G4double emin,
+                                                 G4double emax,
+                                                 G4int binsPerDecade)
+{
+  if(emin <= 0. || emax <= emin || binsPerDecade < 1)
+  {
+    G4ExceptionDescription ed;
+    ed << "Invalid majorant binning: emin= " << emin << " emax= " << emax
+       << " bins per decade= " << binsPerDecade;
+    G4Exception("G4WoodcockTrackingModel::SetMajorantBinning()",
+                "Woodcock001", JustWarning, ed);
+    return;
+  }
+  fEmin = emin;
+  fEmax = emax;
+  fBinsPerDecade = binsPerDecade;
+  if(fInitialised) { BuildMajorant(); }
+}
+
+// --------------------------------------------------------------------
+void G4WoodcockTrackingModel::SetMajorantMargin(G4double margin)
+{
+  fMargin = std::max(margin, G4double(0.));
+  if(fInitialised) { BuildMajorant(); }
+}
+
+// --------------------------------------------------------------------
+void G4WoodcockTrackingModel::Reset()
+{
+  fInitialised = false;
+  fPhantom = nullptr;
+  fVoxelVolume = nullptr;
+  fProcesses.clear();
+  fChanges.clear();
+  fCouples.clear();
+  fMajorant.clear();
+  delete fWorkTrack;
+  fWorkTrack = nullptr;
+  delete fWorkStep;
+  fWorkStep = nullptr;
+  delete fNavigator;
+  fNavigator = nullptr;
+  fTouchable = nullptr;
+}
+
+// --------------------------------------------------------------------
+void G4WoodcockTrackingModel::Initialise(const G4FastTrack& fastTrack)
+{
+  // -- The envelope must contain the voxel parameterisation only
+  G4LogicalVolume* envelope =
+    fastTrack.GetEnvelopePhysicalVolume()->GetLogicalVolume();
+  if(envelope->GetNoDaughters() == 1)
+  {
+    fPhantom = dynamic_cast<G4PhantomParameterisation*>(
+      envelope->GetDaughter(0)->GetParameterisation());
+  }
+  if(fPhantom == nullptr)
+  {
+    G4ExceptionDescription ed;
+    ed << "Envelope " << envelope->GetName() << " of model " << GetName()
+       << " is not the container of a G4PhantomParameterisation.";
+    G4Exception("G4WoodcockTrackingModel::Initialise()", "Woodcock002",
+                FatalException, ed);
+    return;
+  }
+  fVoxelVolume = envelope->GetDaughter(0)->GetLogicalVolume();
+  fHalfX = fPhantom->GetVoxelHalfX();
+  fHalfY = fPhantom->GetVoxelHalfY();
+  fHalfZ = fPhantom->GetVoxelHalfZ();
+  fNx = G4int(fPhantom->GetNoVoxelsX());
+  fNy = G4int(fPhantom->GetNoVoxelsY());
+  fNz = G4int(fPhantom->GetNoVoxelsZ());
+
+  // -- Gamma processes performing the real interactions
+  fProcesses.clear();
+  G4String ignored;
+  G4ProcessManager* manager = G4Gamma::Gamma()->GetProcessManager();
+  G4ProcessVector* processes = manager->GetProcessList();
+  for(G4int i = 0; i < G4int(processes->size()); ++i)
+  {
+    G4VProcess* process = (*processes)[i];
+    const G4ProcessType type = process->GetProcessType();
+    if(!manager->GetProcessActivation(process) || type == fTransportation ||
+       type == fGeneral || type == fParameterisation || type == fParallel)
+    {
+      continue;
+    }
+    auto emProcess = dynamic_cast<G4VEmProcess*>(process);
+    if(emProcess != nullptr &&
+       emProcess->GetProcessSubType() == fGammaGeneralProcess)
+    {
+      G4ExceptionDescription ed;
+      ed << "G4GammaGeneralProcess is not supported by model " << GetName()
+         << "; use separate gamma processes.";
+      G4Exception("G4WoodcockTrackingModel::Initialise()", "Woodcock003",
+                  FatalException, ed);
+      return;
+    }
+    if(emProcess != nullptr)
+    {
+      fProcesses.push_back(emProcess);
+    }
+    else
+    {
+      ignored += " " + process->GetProcessName();
+    }
+  }
+  if(fProcesses.empty())
+  {
+    G4Exception("G4WoodcockTrackingModel::Initialise()", "Woodcock004",
+                FatalException, "No electromagnetic gamma process found.");
+    return;
+  }
+  if(!ignored.empty())
+  {
+    G4ExceptionDescription ed;
+    ed << "Processes ignored by model " << GetName()
+       << " inside its envelope:" << ignored;
+    G4Exception("G4WoodcockTrackingModel::Initialise()", "Woodcock005",
+                JustWarning, ed);
+  }
+  fPartialXS.resize(fProcesses.size());
+  fChanges.assign(fProcesses.size(), nullptr);
+
+  // -- Couples of the phantom materials in the envelope region
+  fCouples.clear();
+  G4ProductionCuts* cuts = fastTrack.GetEnvelope()->GetProductionCuts();
+  const G4ProductionCutsTable* cutsTable =
+    G4ProductionCutsTable::GetProductionCutsTable();
+  for(auto material : fPhantom->GetMaterials())
+  {
+    const G4MaterialCutsCouple* couple =
+      cutsTable->GetMaterialCutsCouple(material, cuts);
+    if(couple == nullptr)
+    {
+      G4ExceptionDescription ed;
+      ed << "No couple for material " << material->GetName()
+         << " in region " << fastTrack.GetEnvelope()->GetName();
+      G4Exception("G4WoodcockTrackingModel::Initialise()", "Woodcock006",
+                  FatalException, ed);
+      return;
+    }
+    fCouples.push_back(couple);
+  }
+
+  if(fEmax <= 0.)
+  {
+    const G4EmParameters* param = G4EmParameters::Instance();
+    fEmin = param->MinKinEnergy();
+    fEmax = param->MaxKinEnergy();
+  }
+  BuildMajorant();
+
+  // -- Work track used to invoke the processes
+  if(fWorkTrack == nullptr)
+  {
+    fWorkStep = new G4Step();
+    fWorkTrack = new G4Track(
+      new G4DynamicParticle(G4Gamma::Gamma(), G4ThreeVector(0., 0., 1.), 0.),
+      0., G4ThreeVector());
+    fWorkTrack->SetStep(fWorkStep);
+    fWorkStep->SetTrack(fWorkTrack);
+  }
+
+  // -- Navigator locating the energy deposits in the voxels
+  if(fNavigator == nullptr)
+  {
+    fNavigator = new G4Navigator();
+    fNavigator->SetWorldVolume(G4TransportationManager::
+      GetTransportationManager()->GetNavigatorForTracking()->GetWorldVolume());
+    fTouchable = new G4TouchableHistory();
+    fNavigator->LocateGlobalPointAndUpdateTouchable(
+      fastTrack.GetPrimaryTrack()->GetPosition(), fTouchable(), false);
+  }
+  fInitialised = true;
+}
+
+// --------------------------------------------------------------------
+void G4WoodcockTrackingModel::BuildMajorant()
+{
+  // The cross sections are interpolated in the lambda tables of the
+  // processes, so their maximum over a bin is reached at a node of the
+  // tables inside the bin or at a bin edge. The maximum over the
+  // materials is taken at these energies, and at intermediate points of
+  // each bin for processes without tables, then increased by the margin
+  const G4int nSub = 4;
+  fLogEmin = G4Log(fEmin);
+  const G4double nDecades = (G4Log(fEmax) - fLogEmin) / G4Log(10.);
+  const G4int nBins =
+    std::max(G4int(nDecades * G4double(fBinsPerDecade) + 0.999), 1);
+  fInvLogBin = G4double(nBins) / (G4Log(fEmax) - fLogEmin);
+  fMajorant.assign(nBins, 0.);
+
+  std::vector<G4double> energies;
+  for(G4int bin = 0; bin < nBins; ++bin)
+  {
+    for(G4int k = 0; k <= nSub; ++k)
+    {
+      energies.push_back(
+        G4Exp(fLogEmin + (G4double(bin) + G4double(k) / G4double(nSub)) /
+                         fInvLogBin));
+    }
+  }
+  for(auto process : fProcesses)
+  {
+    for(auto table : { process->LambdaTable(), process->LambdaTablePrim() })
+    {
+      if(table == nullptr) { continue; }
+      for(std::size_t j = 0; j < table->size(); ++j)
+      {
+        const G4PhysicsVector* vec = (*table)[j];
+        if(vec == nullptr) { continue; }
+        for(std::size_t k = 0; k < vec->GetVectorLength(); ++k)
+        {
+          const G4double ekin = vec->Energy(k);
+          if(ekin > fEmin && ekin < fEmax) { energies.push_back(ekin); }
+        }
+      }
+    }
+  }
+  std::sort(energies.begin(), energies.end());
+  energies.erase(std::unique(energies.begin(), energies.end()),
+                 energies.end());
+
+  for(auto ekin : energies)
+  {
+    // A node on a bin edge bounds both bins
+    G4double maxXS = 0.;
+    for(std::size_t m = 0; m < fCouples.size(); ++m)
+    {
+      maxXS = std::max(maxXS, CrossSection(m, ekin));
+    }
+    const G4double x = (G4Log(ekin) - fLogEmin) * fInvLogBin;
+    const G4int bin = std::min(std::max(G4int(x), 0), nBins - 1);
+    fMajorant[bin] = std::max(fMajorant[bin], maxXS);
+    if(bin > 0 && x - G4double(bin) < 1.e-6)
+    {
+      fMajorant[bin - 1] = std::max(fMajorant[bin - 1], maxXS);
+    }
+  }
+  for(auto& majorant : fMajorant) { majorant *= 1. + fMargin; }
+}
+
+// --------------------------------------------------------------------
+G4int G4WoodcockTrackingModel::GetMajorantBin(G4double ekin) const
+{
+  const G4int bin = G4int((G4Log(ekin) - fLogEmin) * fInvLogBin);
+  return std::min(std::max(bin, 0), G4int(fMajorant.size()) - 1);
+}
+
+// --------------------------------------------------------------------
+G4double G4WoodcockTrackingModel::CrossSection(std::size_t materialIndex,
+                                               G4double ekin)
+{
+  const G4MaterialCutsCouple* couple = fCouples[materialIndex];
+  const G4double logEkin = G4Log(ekin);
+  G4double sum = 0.;
+  for(std::size_t i = 0; i < fProcesses.size(); ++i)
+  {
+    sum += std::max(fProcesses[i]->GetLambda(ekin, couple, logEkin),
+                    G4double(0.));
+    fPartialXS[i] = sum;
+  }
+  return sum;
+}
+
+// --------------------------------------------------------------------
+G4int G4WoodcockTrackingModel::GetCopyNo(const G4ThreeVector& p) const
+{
+  // Same voxel numbering as G4PhantomParameterisation; the voxels fill
+  // the container, centred on its origin
+  G4int ix = G4int((p.x() + G4double(fNx) * fHalfX) / (2. * fHalfX));
+  G4int iy = G4int((p.y() + G4double(fNy) * fHalfY) / (2. * fHalfY));
+  G4int iz = G4int((p.z() + G4double(fNz) * fHalfZ) / (2. * fHalfZ));
+  ix = std::min(std::max(ix, 0), fNx - 1);
+  iy = std::min(std::max(iy, 0), fNy - 1);
+  iz = std::min(std::max(iz, 0), fNz - 1);
+  return ix + fNx * (iy + fNy * iz);
+}
+
+// --------------------------------------------------------------------
+void G4WoodcockTrackingModel::DoIt(const G4FastTrack& fastTrack,
+                                   G4FastStep& fastStep)
+{
+  const G4Track* track = fastTrack.GetPrimaryTrack();
+  const G4AffineTransform* toLocal = fastTrack.GetAffineTransformation();
+  const G4VSolid* envelope = fastTrack.GetEnvelopeSolid();
+
+  G4ThreeVector position = track->GetPosition();
+  G4ThreeVector direction = track->GetMomentumDirection();
+  G4ThreeVector polarization = track->GetPolarization();
+  G4ThreeVector localPosition = fastTrack.GetPrimaryTrackLocalPosition();
+  G4ThreeVector localDirection = fastTrack.GetPrimaryTrackLocalDirection();
+  G4double ekin = track->GetKineticEnergy();
+  G4double time = track->GetGlobalTime();
+  const G4double weight = track->GetWeight();
+
+  fSecondaries.clear();
+  fEnergyDeposit = 0.;
+  fWorkTrack->SetTrackID(track->GetTrackID());
+  fWorkTrack->SetParentID(track->GetParentID());
+
+  G4bool alive = true;
+  while(alive && ekin >= fEmin && ekin < fEmax)
+  {
+    // -- Flight with the majorant cross section
+    const G4int bin = GetMajorantBin(ekin);
+    const G4double majorant = fMajorant[bin];
+    const G4double distOut = envelope->DistanceToOut(localPosition,
+                                                     localDirection);
+    const G4double step = (majorant > 0.)
+                        ? -G4Log(G4UniformRand()) / majorant : DBL_MAX;
+    if(step >= distOut)
+    {
+      position += distOut * direction;
+      time += distOut / CLHEP::c_light;
+      break;
+    }
+    const G4ThreeVector interactionPosition = position + step * direction;
+    const G4ThreeVector interactionLocalPosition =
+      localPosition + step * localDirection;
+
+    // -- Real or fictitious interaction
+    const G4int copyNo = GetCopyNo(interactionLocalPosition);
+    const std::size_t materialIndex = fPhantom->GetMaterialIndex(copyNo);
+    const G4double xs = CrossSection(materialIndex, ekin);
+    if(xs > majorant)
+    {
+      // The flight was sampled with a wrong majorant: the majorant of the
+      // bin is raised and the flight is sampled again from its start
+      if(!fMajorantWarned)
+      {
+        G4ExceptionDescription ed;
+        ed << "Cross section " << xs << " exceeds the majorant " << majorant
+           << " at E= " << ekin << "; the majorant is raised. Increase the"
+           << " majorant margin or binning to avoid resampling.";
+        G4Exception("G4WoodcockTrackingModel::DoIt()", "Woodcock007",
+                    JustWarning, ed);
+        fMajorantWarned = true;
+      }
+      fMajorant[bin] = xs * (1. + fMargin);
+      continue;
+    }
+    position = interactionPosition;
+    localPosition = interactionLocalPosition;
+    time += step / CLHEP::c_light;
+
+    if(xs <= majorant * G4UniformRand())
+    {
+      ++fNFictitious;
+      continue;
+    }
+    ++fNReal;
+
+    const G4double r = xs * G4UniformRand();
+    std::size_t i = 0;
+    while(i + 1 < fPartialXS.size() && fPartialXS[i] <= r) { ++i; }
+
+    alive = Interact(i, materialIndex, position, copyNo, ekin, direction,
+                     polarization, time, weight);
+    if(alive) { localDirection = toLocal->TransformAxis(direction); }
+  }
+
+  // -- The processes invoked on the work track are left with its couple
+  //    and final state: select again the couple of the primary and
+  //    re-initialise their particle change for it
+  for(std::size_t i = 0; i < fProcesses.size(); ++i)
+  {
+    if(fChanges[i] == nullptr) { continue; }
+    fProcesses[i]->MeanFreePath(*track);
+    fChanges[i]->InitializeForPostStep(*track);
+    fChanges[i] = nullptr;
+  }
+
+  // -- The primary is replaced by a new track at its final position, so
+  //    that the navigator locates it
+  fastStep.KillPrimaryTrack();
+  fastStep.SetNumberOfSecondaryTracks(G4int(fSecondaries.size()) +
+                                      (alive ? 1 : 0));
+  for(const auto& secondary : fSecondaries)
+  {
+    G4Track* newTrack = fastStep.CreateSecondaryTrack(
+      *secondary.fParticle, secondary.fPosition, secondary.fTime, false);
+    newTrack->SetWeight(secondary.fWeight);
+    newTrack->SetCreatorModelID(secondary.fCreatorModelID);
+    delete secondary.fParticle;
+  }
+  fSecondaries.clear();
+  if(alive)
+  {
+    G4DynamicParticle gamma(G4Gamma::Gamma(), direction, ekin);
+    gamma.SetPolarization(polarization.x(), polarization.y(),
+                          polarization.z());
+    G4Track* newTrack =
+      fastStep.CreateSecondaryTrack(gamma, position, time, false);
+    newTrack->SetWeight(weight);
+  }
+  fastStep.ProposeTotalEnergyDeposited(fEnergyDeposit);
+}
+
+// --------------------------------------------------------------------
+G4bool G4WoodcockTrackingModel::Interact(std::size_t processIndex,
+                                         std::size_t materialIndex,
+                                         const G4ThreeVector& position,
+                                         G4int copyNo, G4double& ekin,
+                                         G4ThreeVector& direction,
+                                         G4ThreeVector& polarization,
+                                         G4double time, G4double weight)
+{
+  fWorkTrack->SetPosition(position);
+  fWorkTrack->SetGlobalTime(time);
+  fWorkTrack->SetKineticEnergy(ekin);
+  fWorkTrack->SetMomentumDirection(direction);
+  fWorkTrack->SetPolarization(polarization);
+  fWorkTrack->SetWeight(weight);
+  fWorkTrack->SetTrackStatus(fAlive);
+
+  // The work step is a null-length step at the interaction point
+  G4StepPoint* point = fWorkStep->GetPreStepPoint();
+  point->SetPosition(position);
+  point->SetGlobalTime(time);
+  point->SetKineticEnergy(ekin);
+  point->SetMomentumDirection(direction);
+  point->SetPolarization(polarization);
+  point->SetWeight(weight);
+  point->SetMaterial(fPhantom->GetMaterials()[materialIndex]);
+  point->SetMaterialCutsCouple(fCouples[materialIndex]);
+  point->SetSafety(0.);
+  point->SetStepStatus(fPostStepDoItProc);
+  *fWorkStep->GetPostStepPoint() = *point;
+  fWorkStep->SetStepLength(0.);
+  fWorkStep->SetTotalEnergyDeposit(0.);
+
+  // MeanFreePath() selects the couple in the process before the final
+  // state is sampled
+  G4VEmProcess* process = fProcesses[processIndex];
+  process->MeanFreePath(*fWorkTrack);
+  G4VParticleChange* change = process->PostStepDoIt(*fWorkTrack, *fWorkStep);
+  auto gammaChange = static_cast<G4ParticleChangeForGamma*>(change);
+  fChanges[processIndex] = gammaChange;
+
+  for(G4int i = 0; i < change->GetNumberOfSecondaries(); ++i)
+  {
+    G4Track* secondary = change->GetSecondary(i);
+    fSecondaries.push_back(
+      { new G4DynamicParticle(*secondary->GetDynamicParticle()), position,
+        time, secondary->GetWeight(), secondary->GetCreatorModelID() });
+    delete secondary;
+  }
+  change->Clear();
+
+  const G4double edep = gammaChange->GetLocalEnergyDeposit();
+  if(edep > 0.) { DepositEnergy(edep, position, copyNo); }
+
+  ekin = gammaChange->GetProposedKineticEnergy();
+  if(gammaChange->GetTrackStatus() != fAlive || ekin <= 0.)
+  {
+    return false;
+  }
+  direction = gammaChange->GetProposedMomentumDirection();
+  polarization = gammaChange->GetProposedPolarization();
+  return true;
+}
+
+// --------------------------------------------------------------------
+void G4WoodcockTrackingModel::DepositEnergy(G4double edep,
+                                            const G4ThreeVector& position,
+                                            G4int)
+{
+  G4VSensitiveDetector* sensitive = fVoxelVolume->GetSensitiveDetector();
+  if(sensitive == nullptr)
+  {
+    fEnergyDeposit += edep;
+    return;
+  }
+
+  // The work step of the interaction is handed to the detector, located
+  // in the voxel of the interaction point
+  fNavigator->LocateGlobalPointAndUpdateTouchable(position, fTouchable());
+  fWorkStep->GetPreStepPoint()->SetTouchableHandle(fTouchable);
+  fWorkStep->GetPostStepPoint()->SetTouchableHandle(fTouchable);
+  fWorkTrack->SetTouchableHandle(fTouchable);
+  fWorkStep->SetTotalEnergyDeposit(edep);
+  sensitive->Hit(fWorkStep);
+}
@@ -127,6 +127,8 @@ class G4GDMLParser
     inline void SetEnergyCutsExport(G4bool);
     inline void SetSDExport(G4bool);
     inline void SetReverseSearch(G4bool);
+    inline void SetTessellatedMesh(G4bool);  // Read tessellated solids
+                                             // as G4TessellatedMesh
 
     inline G4int GetMaxExportLevel() const;  // Manage max number of levels
     inline void SetMaxExportLevel(G4int);    // to export
@@ -45,6 +45,7 @@
 class G4VSolid;
 class G4QuadrangularFacet;
 class G4TriangularFacet;
+class G4TessellatedMesh;
 class G4SurfaceProperty;
 class G4OpticalSurface;
 
@@ -70,6 +71,10 @@ class G4GDMLReadSolids : public G4GDMLReadMaterials
 
     virtual void SolidsRead(const xercesc::DOMElement* const);
 
+    inline void SetTessellatedMesh(G4bool flag) { useTessellatedMesh = flag; }
+      // Build tessellated solids as G4TessellatedMesh instead of
+      // G4TessellatedSolid (default is off).
+
   protected:
 
     typedef struct
@@ -105,6 +110,11 @@ class G4GDMLReadSolids : public G4GDMLReadMaterials
                                           G4double);
     void SphereRead(const xercesc::DOMElement* const);
     void TessellatedRead(const xercesc::DOMElement* const);
+    void TessellatedMeshRead(const xercesc::DOMElement* const,
+                             const G4String&);
+    void MeshFacetRead(const xercesc::DOMElement* const, G4TessellatedMesh*,
+                       std::map<std::pair<G4String, G4double>, G4int>&,
+                       G4int);
     void TetRead(const xercesc::DOMElement* const);
     void TorusRead(const xercesc::DOMElement* const);
     void GenTrapRead(const xercesc::DOMElement* const);
@@ -126,6 +136,7 @@ class G4GDMLReadSolids : public G4GDMLReadMaterials
   private:
 
     std::map<G4String, G4MaterialPropertyVector*> mapOfMatPropVects;
+    G4bool useTessellatedMesh = false;
 };
 
 #endif
@@ -58,6 +58,7 @@ class G4GenericPolycone;
 class G4Polyhedra;
 class G4Sphere;
 class G4TessellatedSolid;
+class G4TessellatedMesh;
 class G4Tet;
 class G4Torus;
 class G4GenericTrap;
@@ -124,6 +125,8 @@ class G4GDMLWriteSolids : public G4GDMLWriteMaterials
     void SphereWrite(xercesc::DOMElement*, const G4Sphere* const);
     void TessellatedWrite(xercesc::DOMElement*,
                           const G4TessellatedSolid* const);
+    void TessellatedMeshWrite(xercesc::DOMElement*,
+                              const G4TessellatedMesh* const);
     void TetWrite(xercesc::DOMElement*, const G4Tet* const);
     void TorusWrite(xercesc::DOMElement*, const G4Torus* const);
     void GenTrapWrite(xercesc::DOMElement*, const G4GenericTrap* const);
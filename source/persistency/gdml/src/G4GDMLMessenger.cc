@@ -87,6 +87,14 @@ G4GDMLMessenger::G4GDMLMessenger(G4GDMLParser* myPars)
   AppendCmd->AvailableForStates(G4State_Idle);
   AppendCmd->SetToBeBroadcasted(false);
 
+  MeshCmd = new G4UIcmdWithABool("/persistency/gdml/tessellated_mesh", this);
+  MeshCmd->SetGuidance("Enable/disable reading of tessellated solids");
+  MeshCmd->SetGuidance("as G4TessellatedMesh when reading a GDML file.");
+  MeshCmd->SetParameterName("tessellated_mesh", true);
+  MeshCmd->SetDefaultValue(true);
+  MeshCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  MeshCmd->SetToBeBroadcasted(false);
+
   RegionCmd = new G4UIcmdWithABool("/persistency/gdml/export_regions", this);
   RegionCmd->SetGuidance("Enable export of geometrical regions");
   RegionCmd->SetGuidance("for storing production cuts.");
@@ -134,6 +142,7 @@ G4GDMLMessenger::~G4GDMLMessenger()
   delete gdmlDir;
   delete StripCmd;
   delete AppendCmd;
+  delete MeshCmd;
 }
 
 // --------------------------------------------------------------------
@@ -151,6 +160,12 @@ void G4GDMLMessenger::SetNewValue(G4UIcommand* command, G4String newValue)
     myParser->SetAddPointerToName(pFlag);
   }
 
+  if(command == MeshCmd)
+  {
+    G4bool mode = MeshCmd->GetNewBoolValue(newValue);
+    myParser->SetTessellatedMesh(mode);
+  }
+
   if(command == ReaderCmd)
   {
     G4GeometryManager::GetInstance()->OpenGeometry();
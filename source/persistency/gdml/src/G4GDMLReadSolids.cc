@@ -52,6 +52,7 @@
 #include "G4SubtractionSolid.hh"
 #include "G4GenericTrap.hh"
 #include "G4TessellatedSolid.hh"
+#include "G4TessellatedMesh.hh"
 #include "G4Tet.hh"
 #include "G4Torus.hh"
 #include "G4Transform3D.hh"
@@ -2090,6 +2091,12 @@ void G4GDMLReadSolids::TessellatedRead(
     }
   }
 
+  if(useTessellatedMesh)
+  {
+    TessellatedMeshRead(tessellatedElement, name);
+    return;
+  }
+
   G4TessellatedSolid* tessellated = new G4TessellatedSolid(name);
 
   for(xercesc::DOMNode* iter = tessellatedElement->getFirstChild();
@@ -2123,6 +2130,160 @@ void G4GDMLReadSolids::TessellatedRead(
   tessellated->SetSolidClosed(true);
 }
 
+// --------------------------------------------------------------------
+void G4GDMLReadSolids::TessellatedMeshRead(
+  const xercesc::DOMElement* const tessellatedElement, const G4String& name)
+{
+  G4int nfacets = 0;
+  for(xercesc::DOMNode* iter = tessellatedElement->getFirstChild();
+                        iter != nullptr; iter = iter->getNextSibling())
+  {
+    if(iter->getNodeType() == xercesc::DOMNode::ELEMENT_NODE)
+    {
+      ++nfacets;
+    }
+  }
+
+  G4TessellatedMesh* mesh = new G4TessellatedMesh(name);
+  mesh->Reserve(nfacets, 2 * nfacets);
+
+  // Vertices referenced by the same position and unit are shared
+  //
+  std::map<std::pair<G4String, G4double>, G4int> vertexMap;
+
+  for(xercesc::DOMNode* iter = tessellatedElement->getFirstChild();
+                        iter != nullptr; iter = iter->getNextSibling())
+  {
+    if(iter->getNodeType() != xercesc::DOMNode::ELEMENT_NODE)
+    {
+      continue;
+    }
+
+    const xercesc::DOMElement* const child =
+      dynamic_cast<xercesc::DOMElement*>(iter);
+    if(child == nullptr)
+    {
+      G4Exception("G4GDMLReadSolids::TessellatedMeshRead()", "InvalidRead",
+                  FatalException, "No child found!");
+      return;
+    }
+    const G4String tag = Transcode(child->getTagName());
+
+    if(tag == "triangular")
+    {
+      MeshFacetRead(child, mesh, vertexMap, 3);
+    }
+    else if(tag == "quadrangular")
+    {
+      MeshFacetRead(child, mesh, vertexMap, 4);
+    }
+  }
+
+  mesh->SetSolidClosed(true);
+}
+
+// --------------------------------------------------------------------
+void G4GDMLReadSolids::MeshFacetRead(
+  const xercesc::DOMElement* const facetElement, G4TessellatedMesh* mesh,
+  std::map<std::pair<G4String, G4double>, G4int>& vertexMap, G4int nvertices)
+{
+  G4String vertex[4];
+  G4bool relative = false;
+  G4double lunit  = 1.0;
+
+  const xercesc::DOMNamedNodeMap* const attributes =
+    facetElement->getAttributes();
+  XMLSize_t attributeCount = attributes->getLength();
+
+  for(XMLSize_t attribute_index = 0; attribute_index < attributeCount;
+      ++attribute_index)
+  {
+    xercesc::DOMNode* attribute_node = attributes->item(attribute_index);
+
+    if(attribute_node->getNodeType() != xercesc::DOMNode::ATTRIBUTE_NODE)
+    {
+      continue;
+    }
+
+    const xercesc::DOMAttr* const attribute =
+      dynamic_cast<xercesc::DOMAttr*>(attribute_node);
+    if(attribute == nullptr)
+    {
+      G4Exception("G4GDMLReadSolids::MeshFacetRead()", "InvalidRead",
+                  FatalException, "No attribute found!");
+      return;
+    }
+    const G4String attName  = Transcode(attribute->getName());
+    const G4String attValue = Transcode(attribute->getValue());
+
+    if(attName == "vertex1")
+    {
+      vertex[0] = GenerateName(attValue);
+    }
+    else if(attName == "vertex2")
+    {
+      vertex[1] = GenerateName(attValue);
+    }
+    else if(attName == "vertex3")
+    {
+      vertex[2] = GenerateName(attValue);
+    }
+    else if(attName == "vertex4")
+    {
+      vertex[3] = GenerateName(attValue);
+    }
+    else if(attName == "lunit")
+    {
+      lunit = G4UnitDefinition::GetValueOf(attValue);
+      if(G4UnitDefinition::GetCategory(attValue) != "Length")
+      {
+        G4Exception("G4GDMLReadSolids::MeshFacetRead()", "InvalidRead",
+                    FatalException, "Invalid unit for length!");
+      }
+    }
+    else if(attName == "type")
+    {
+      relative = (attValue == "RELATIVE");
+    }
+  }
+
+  G4int index[4] = { 0, 0, 0, 0 };
+  if(relative)
+  {
+    // Vertices after the first one are given relative to it,
+    // hence they are not shared with other facets
+    G4ThreeVector first = GetPosition(vertex[0]) * lunit;
+    index[0] = mesh->AddVertex(first);
+    for(G4int i = 1; i < nvertices; ++i)
+    {
+      index[i] = mesh->AddVertex(first + GetPosition(vertex[i]) * lunit);
+    }
+  }
+  else
+  {
+    for(G4int i = 0; i < nvertices; ++i)
+    {
+      auto key = std::make_pair(vertex[i], lunit);
+      auto pos = vertexMap.find(key);
+      if(pos == vertexMap.cend())
+      {
+        G4int k = mesh->AddVertex(GetPosition(vertex[i]) * lunit);
+        pos = vertexMap.insert(std::make_pair(key, k)).first;
+      }
+      index[i] = pos->second;
+    }
+  }
+
+  if(nvertices == 3)
+  {
+    mesh->AddTriangle(index[0], index[1], index[2]);
+  }
+  else
+  {
+    mesh->AddQuadrangle(index[0], index[1], index[2], index[3]);
+  }
+}
+
 // --------------------------------------------------------------------
 void G4GDMLReadSolids::TetRead(const xercesc::DOMElement* const tetElement)
 {
@@ -1027,6 +1027,11 @@ void G4GDMLReadStructure::StructureRead(
 #ifdef G4VERBOSE
   G4cout << "G4GDML: Reading structure..." << G4endl;
 #endif
+  // Volumes are registered in bulk; names are mapped at the next search
+  //
+  G4LogicalVolumeStore::BeginBulkRegistration();
+  G4PhysicalVolumeStore::BeginBulkRegistration();
+
   for(xercesc::DOMNode* iter = structureElement->getFirstChild();
                         iter != nullptr; iter = iter->getNextSibling())
   {
@@ -1041,6 +1046,8 @@ void G4GDMLReadStructure::StructureRead(
     {
       G4Exception("G4GDMLReadStructure::StructureRead()", "InvalidRead",
                   FatalException, "No child found!");
+      G4PhysicalVolumeStore::EndBulkRegistration();
+      G4LogicalVolumeStore::EndBulkRegistration();
       return;
     }
     const G4String tag = Transcode(child->getTagName());
@@ -1072,6 +1079,9 @@ void G4GDMLReadStructure::StructureRead(
                   FatalException, error_msg);
     }
   }
+
+  G4PhysicalVolumeStore::EndBulkRegistration();
+  G4LogicalVolumeStore::EndBulkRegistration();
 }
 
 // --------------------------------------------------------------------
@@ -54,6 +54,7 @@
 #include "G4SubtractionSolid.hh"
 #include "G4GenericTrap.hh"
 #include "G4TessellatedSolid.hh"
+#include "G4TessellatedMesh.hh"
 #include "G4Tet.hh"
 #include "G4Torus.hh"
 #include "G4Trap.hh"
@@ -734,6 +735,50 @@ void G4GDMLWriteSolids::TessellatedWrite(
   }
 }
 
+// --------------------------------------------------------------------
+void G4GDMLWriteSolids::TessellatedMeshWrite(
+  xercesc::DOMElement* solElement, const G4TessellatedMesh* const mesh)
+{
+  const G4String& solid_name = mesh->GetName();
+  const G4String& name       = GenerateName(solid_name, mesh);
+
+  xercesc::DOMElement* tessellatedElement = NewElement("tessellated");
+  tessellatedElement->setAttributeNode(NewAttribute("name", name));
+  tessellatedElement->setAttributeNode(NewAttribute("aunit", "deg"));
+  tessellatedElement->setAttributeNode(NewAttribute("lunit", "mm"));
+  solElement->appendChild(tessellatedElement);
+
+  // Vertices are already shared by the mesh, write each of them once
+  //
+  const G4int NumVertex = mesh->GetNumberOfVertices();
+  for(G4int i = 0; i < NumVertex; ++i)
+  {
+    std::stringstream ref_stream;
+    ref_stream << solid_name << "_v" << i;
+    AddPosition(ref_stream.str(), mesh->GetVertex(i));
+  }
+
+  const G4int NumTriangles = mesh->GetNumberOfTriangles();
+  for(G4int i = 0; i < NumTriangles; ++i)
+  {
+    G4int index[3];
+    mesh->GetTriangle(i, index[0], index[1], index[2]);
+
+    xercesc::DOMElement* facetElement = NewElement("triangular");
+    tessellatedElement->appendChild(facetElement);
+
+    for(G4int j = 0; j < 3; ++j)
+    {
+      std::stringstream name_stream;
+      std::stringstream ref_stream;
+      name_stream << "vertex" << (j + 1);
+      ref_stream << solid_name << "_v" << index[j];
+      facetElement->setAttributeNode(
+        NewAttribute(name_stream.str(), ref_stream.str()));
+    }
+  }
+}
+
 // --------------------------------------------------------------------
 void G4GDMLWriteSolids::TetWrite(xercesc::DOMElement* solElement,
                                  const G4Tet* const tet)
@@ -1248,6 +1293,12 @@ void G4GDMLWriteSolids::AddSolid(const G4VSolid* const solidPtr)
       static_cast<const G4TessellatedSolid*>(solidPtr);
     TessellatedWrite(solidsElement, tessellatedPtr);
   }
+  else if(solidPtr->GetEntityType() == "G4TessellatedMesh")
+  {
+    const G4TessellatedMesh* const meshPtr =
+      static_cast<const G4TessellatedMesh*>(solidPtr);
+    TessellatedMeshWrite(solidsElement, meshPtr);
+  }
   else if(solidPtr->GetEntityType() == "G4Tet")
   {
     const G4Tet* const tetPtr = static_cast<const G4Tet*>(solidPtr);
@@ -0,0 +1,69 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4ITTrackPartition
+//
+// Helpers for the parallel evaluation of per-track quantities during
+// the chemistry stage of G4Scheduler.
+//
+// Build() groups the tracks of a list in spatially compact chunks by
+// recursively splitting, octant by octant, the G4DNABoundingBox of the
+// most populated chunk. Each chunk keeps the indices of its tracks in
+// increasing order so that results can be merged back in list order.
+//
+// Execute() runs a function for each chunk, on the tasks of the PTL
+// thread pool of the task-based run manager when there is one, or
+// sequentially on the calling thread otherwise.
+
+#ifndef G4ITTRACKPARTITION_HH
+#define G4ITTRACKPARTITION_HH
+
+#include "globals.hh"
+#include <functional>
+#include <vector>
+
+class G4Track;
+
+class G4ITTrackPartition
+{
+public:
+  using Chunk = std::vector<std::size_t>;
+
+  // Fills "chunks" with about nChunks groups of track indices
+  static void Build(const std::vector<G4Track*>& tracks,
+                    std::size_t nChunks,
+                    std::vector<Chunk>& chunks);
+
+  // Calls function(i) for every i in [0, n) and returns once all
+  // the calls are done
+  static void Execute(std::size_t n,
+                      const std::function<void(std::size_t)>& function);
+
+  static G4bool IsThreadPoolAvailable();
+};
+
+#endif // G4ITTRACKPARTITION_HH
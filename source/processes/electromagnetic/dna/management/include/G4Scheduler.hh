@@ -158,6 +158,12 @@ public:
 
   inline G4ITStepStatus GetStatus() const;
 
+  // Number of chunks in which the tracks are spatially partitioned for
+  // the parallel computation of the time steps (1 = sequential).
+  // The chunks run on the tasks of the PTL thread pool when available.
+  inline void SetNumberOfChemistryTasks(G4int);
+  inline G4int GetNumberOfChemistryTasks() const;
+
   /* 1 : Reaction information
    * 2 : (1) + time step information
    * 3 : (2) + step info for individual tracks
@@ -245,6 +251,7 @@ private:
   G4double fPreviousTimeStep;
   G4int fZeroTimeCount;
   G4int fMaxNZeroTimeStepsAllowed;
+  G4int fNChemistryTasks;
 
   G4double fTimeStep; // The selected minimum time step
   G4double fMaxTimeStep;
@@ -455,6 +462,16 @@ inline G4bool G4Scheduler::AreDefaultTimeStepsUsed()
   return (fUseDefaultTimeSteps == false && fUsePreDefinedTimeSteps == false);
 }
 
+inline void G4Scheduler::SetNumberOfChemistryTasks(G4int nTasks)
+{
+  fNChemistryTasks = (nTasks > 1) ? nTasks : 1;
+}
+
+inline G4int G4Scheduler::GetNumberOfChemistryTasks() const
+{
+  return fNChemistryTasks;
+}
+
 inline void G4Scheduler::ResetScavenger(bool value)
 {
     fResetScavenger = value;
@@ -89,6 +89,7 @@ class G4SchedulerMessenger: public G4UImessenger
     G4UIcmdWithAnInteger*       fMaxNULLTimeSteps;
     G4UIcmdWithoutParameter*    fWhyDoYouStop;
     G4UIcmdWithABool*           fUseDefaultTimeSteps;
+    G4UIcmdWithAnInteger*       fChemistryTasks;
 };
 
 #endif // G4ITSTEPPINGMESSENGER_H
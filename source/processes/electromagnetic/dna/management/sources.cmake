@@ -32,6 +32,7 @@ geant4_add_module(G4emdna-man
     G4ITStepStatus.hh
     G4ITSteppingVerbose.hh
     G4ITTrackHolder.hh
+    G4ITTrackPartition.hh
     G4ITTrackingInteractivity.hh
     G4ITTrackingManager.hh
     G4ITTransportation.hh
@@ -101,6 +102,7 @@ geant4_add_module(G4emdna-man
     G4ITStepProcessor.cc
     G4ITSteppingVerbose.cc
     G4ITTrackHolder.cc
+    G4ITTrackPartition.cc
     G4ITTrackingInteractivity.cc
     G4ITTrackingManager.cc
     G4ITTransportation.cc
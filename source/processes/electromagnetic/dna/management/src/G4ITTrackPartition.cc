@@ -0,0 +1,163 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+// G4ITTrackPartition implementation
+// --------------------------------------------------------------------
+
+#include "G4ITTrackPartition.hh"
+#include "G4DNABoundingBox.hh"
+#include "G4Track.hh"
+
+#include "PTL/TaskGroup.hh"
+
+#include <array>
+
+namespace
+{
+  struct Leaf
+  {
+    G4DNABoundingBox fBox;
+    G4ITTrackPartition::Chunk fIndices;
+    G4bool fSplittable;
+  };
+}
+
+void G4ITTrackPartition::Build(const std::vector<G4Track*>& tracks,
+                               std::size_t nChunks,
+                               std::vector<Chunk>& chunks)
+{
+  chunks.clear();
+  if (tracks.empty())
+  {
+    return;
+  }
+
+  std::vector<G4ThreeVector> positions;
+  positions.reserve(tracks.size());
+  for (auto pTrack : tracks)
+  {
+    positions.push_back(pTrack->GetPosition());
+  }
+
+  std::vector<Leaf> leaves(1);
+  leaves[0].fBox = G4DNABoundingBox(positions.begin(), positions.end());
+  leaves[0].fIndices.resize(tracks.size());
+  for (std::size_t i = 0; i < tracks.size(); ++i)
+  {
+    leaves[0].fIndices[i] = i;
+  }
+  leaves[0].fSplittable = tracks.size() > 1;
+
+  while (leaves.size() < nChunks)
+  {
+    // Split the most populated leaf that can still be split
+    std::size_t selected = leaves.size();
+    std::size_t largest = 1;
+    for (std::size_t l = 0; l < leaves.size(); ++l)
+    {
+      if (leaves[l].fSplittable && leaves[l].fIndices.size() > largest)
+      {
+        largest = leaves[l].fIndices.size();
+        selected = l;
+      }
+    }
+    if (selected == leaves.size())
+    {
+      break;
+    }
+
+    Leaf& parent = leaves[selected];
+    const G4ThreeVector mid = parent.fBox.middlePoint();
+    const std::array<G4DNABoundingBox, 8> boxes = parent.fBox.partition();
+    std::array<Chunk, 8> octants;
+
+    for (auto index : parent.fIndices)
+    {
+      const G4ThreeVector& pos = positions[index];
+      // Same octant numbering as G4DNABoundingBox::partition()
+      std::size_t octant = (pos.x() >= mid.x() ? 1 : 0)
+                           + (pos.y() >= mid.y() ? 2 : 0)
+                           + (pos.z() >= mid.z() ? 4 : 0);
+      octants[octant].push_back(index);
+    }
+
+    std::vector<Leaf> children;
+    for (std::size_t o = 0; o < 8; ++o)
+    {
+      if (octants[o].empty())
+      {
+        continue;
+      }
+      G4bool splittable = octants[o].size() > 1;
+      children.push_back(Leaf{boxes[o], std::move(octants[o]), splittable});
+    }
+
+    if (children.size() == 1)
+    {
+      // All the tracks sit at the same point
+      parent.fSplittable = false;
+      continue;
+    }
+
+    leaves.erase(leaves.begin() + selected);
+    leaves.insert(leaves.begin() + selected,
+                  std::make_move_iterator(children.begin()),
+                  std::make_move_iterator(children.end()));
+  }
+
+  chunks.reserve(leaves.size());
+  for (auto& leaf : leaves)
+  {
+    chunks.push_back(std::move(leaf.fIndices));
+  }
+}
+
+G4bool G4ITTrackPartition::IsThreadPoolAvailable()
+{
+  return PTL::internal::get_default_threadpool() != nullptr;
+}
+
+void G4ITTrackPartition::Execute(std::size_t n,
+                                 const std::function<void(std::size_t)>& function)
+{
+  PTL::ThreadPool* pPool = PTL::internal::get_default_threadpool();
+
+  if (n < 2 || pPool == nullptr)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      function(i);
+    }
+    return;
+  }
+
+  PTL::TaskGroup<void> taskGroup(pPool);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    taskGroup.exec([&function, i]() { function(i); });
+  }
+  taskGroup.join();
+}
@@ -159,6 +159,7 @@ void G4Scheduler::Create()
 
   fZeroTimeCount = 0;
   fMaxNZeroTimeStepsAllowed = 10000;
+  fNChemistryTasks = 1;
 
   fStartTime = 0;
   fTimeTolerance = 1 * picosecond;
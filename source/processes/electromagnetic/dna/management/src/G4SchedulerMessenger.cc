@@ -118,6 +118,18 @@ G4SchedulerMessenger::G4SchedulerMessenger(G4Scheduler * stepMgr) :
       "time step interval. This command would be interesting if no reaction has "
       "been set and if one will want to track down Brownian objects. "
       "NB: This command gets in conflicts with the declaration of time steps.");
+
+  fChemistryTasks = new G4UIcmdWithAnInteger("/scheduler/chemistryTasks",
+                                             this);
+  fChemistryTasks->SetGuidance("Set the number of spatial chunks in which the "
+      "molecules are split to compute the time steps in parallel. The chunks "
+      "are processed on the tasks of the thread pool when the task-based run "
+      "manager is used, sequentially otherwise. Reactions are resolved "
+      "sequentially, so results do not depend on this number.");
+  fChemistryTasks->SetParameterName("numberOfTasks", true);
+  fChemistryTasks->SetDefaultValue(1);
+  fChemistryTasks->SetRange("numberOfTasks >= 1");
+  fChemistryTasks->AvailableForStates(G4State_PreInit, G4State_Idle);
 }
 
 G4SchedulerMessenger::~G4SchedulerMessenger()
@@ -132,6 +144,7 @@ G4SchedulerMessenger::~G4SchedulerMessenger()
   delete fVerboseCmd;
   delete fWhyDoYouStop;
   delete fUseDefaultTimeSteps;
+  delete fChemistryTasks;
 }
 
 void G4SchedulerMessenger::SetNewValue(G4UIcommand * command,
@@ -175,6 +188,11 @@ void G4SchedulerMessenger::SetNewValue(G4UIcommand * command,
   {
     fScheduler->UseDefaultTimeSteps(fUseDefaultTimeSteps->GetNewBoolValue(newValue));
   }
+  else if (command == fChemistryTasks)
+  {
+    fScheduler->SetNumberOfChemistryTasks(
+        fChemistryTasks->GetNewIntValue(newValue));
+  }
 }
 
 G4String G4SchedulerMessenger::GetCurrentValue(G4UIcommand * command)
@@ -210,6 +228,11 @@ G4String G4SchedulerMessenger::GetCurrentValue(G4UIcommand * command)
   {
     cv = fUseDefaultTimeSteps->ConvertToString(fScheduler->AreDefaultTimeStepsUsed());
   }
+  else if (command == fChemistryTasks)
+  {
+    cv = fChemistryTasks->ConvertToString(
+        fScheduler->GetNumberOfChemistryTasks());
+  }
 
   return cv;
 }
@@ -42,6 +42,7 @@
 #include "G4LogLogInterpolation.hh"
 
 #include "G4DNAWaterIonisationStructure.hh"
+#include "G4DNAEnergyTransferSampler.hh"
 #include "G4VAtomDeexcitation.hh"
 #include "G4NistManager.hh"
 
@@ -86,6 +87,16 @@ public:
 
   inline void SelectSPScaling(G4bool input); 
 
+  // Sampling of the secondary electron energy from alias tables built
+  // at initialisation from the differential cross sections; implies
+  // the non-cumulated dcs data (SelectFasterComputation(false)); a
+  // warning is issued at initialisation if the faster computation was set
+  inline void SelectAliasSampling(G4bool input);
+
+  // Prints, per shell, the largest difference between the cumulative
+  // distributions of the alias tables and of the interpolated dcs
+  inline void SelectAliasValidation(G4bool input);
+
 protected:
 
   G4ParticleChangeForGamma* fParticleChangeForGamma;
@@ -95,6 +106,8 @@ private:
   G4bool fasterCode;
   G4bool statCode;
   G4bool spScaling;
+  G4bool aliasCode;
+  G4bool aliasValidation;
 
   // Water density table
   const std::vector<G4double>* fpMolWaterDensity;
@@ -161,6 +174,13 @@ private:
   
   VecMap eProbaShellMap[6]; // for cumulated dcs
   VecMap pProbaShellMap[6]; // for cumulated dcs
+
+  G4DNAEnergyTransferSampler eAliasSampler[5]; // for alias sampling
+  G4DNAEnergyTransferSampler pAliasSampler[5]; // for alias sampling
+
+  void BuildAliasTables(const G4ParticleDefinition* particle);
+
+  G4double MaximumEnergyTransfer(G4ParticleDefinition * aParticleDefinition, G4double k, G4int shell);
   
   // Partial cross section
   
@@ -194,4 +214,18 @@ inline void G4DNABornIonisationModel1::SelectSPScaling (G4bool input)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+inline void G4DNABornIonisationModel1::SelectAliasSampling (G4bool input)
+{ 
+    aliasCode = input; 
+}		 
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline void G4DNABornIonisationModel1::SelectAliasValidation (G4bool input)
+{ 
+    aliasValidation = input; 
+}		 
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 #endif
@@ -55,6 +55,7 @@
 //#include "G4DNACPA100LogLogInterpolation.hh"
 
 #include "G4DNACPA100WaterIonisationStructure.hh"
+#include "G4DNAEnergyTransferSampler.hh"
 #include "G4VAtomDeexcitation.hh"
 #include "G4NistManager.hh"
 
@@ -91,6 +92,16 @@ public:
 
   inline void SelectStationary(G4bool input); 
 
+  // Sampling of the secondary electron energy from alias tables built
+  // at initialisation from the non-cumulated dcs; implies
+  // SelectUseDcs(true) and SelectFasterComputation(false); a warning is
+  // issued at initialisation if they were set otherwise
+  inline void SelectAliasSampling(G4bool input);
+
+  // Prints, per shell, the largest difference between the cumulative
+  // distributions of the alias tables and of the interpolated dcs
+  inline void SelectAliasValidation(G4bool input);
+
 protected:
 
   G4ParticleChangeForGamma* fParticleChangeForGamma;
@@ -102,6 +113,9 @@ private:
   G4bool fasterCode;
   G4bool useDcs;
 
+  G4bool aliasCode;
+  G4bool aliasValidation;
+
   // Water density table
   const std::vector<G4double>* fpMolWaterDensity;
 
@@ -164,6 +178,12 @@ private:
   VecMap eVecm;
   
   VecMap eProbaShellMap[6]; // for cumulated dcs
+
+  G4DNAEnergyTransferSampler eAliasSampler[5]; // for alias sampling
+
+  void BuildAliasTables();
+
+  G4double MaximumEnergyTransfer(G4double k, G4int shell);
   
   // Partial cross section
   
@@ -201,4 +221,18 @@ inline void G4DNACPA100IonisationModel::SelectStationary (G4bool input)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+inline void G4DNACPA100IonisationModel::SelectAliasSampling (G4bool input)
+{ 
+    aliasCode = input; 
+}  
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline void G4DNACPA100IonisationModel::SelectAliasValidation (G4bool input)
+{ 
+    aliasValidation = input; 
+}  
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 #endif
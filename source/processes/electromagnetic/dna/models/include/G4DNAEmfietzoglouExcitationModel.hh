@@ -47,6 +47,7 @@
 #include "G4Electron.hh"
 #include "G4Proton.hh"
 #include "G4DNAEmfietzoglouWaterExcitationStructure.hh"
+#include "G4DNAAliasTable.hh"
 #include "G4NistManager.hh"
 
 class G4DNAEmfietzoglouExcitationModel : public G4VEmModel
@@ -77,6 +78,14 @@ public:
 
   inline void SelectStationary(G4bool input); 
 
+  // Selection of the excitation level from alias tables built at
+  // initialisation on the energy grid of the partial cross sections
+  inline void SelectAliasSampling(G4bool input);
+
+  // Prints the largest difference between the level probabilities of
+  // the alias tables and of the interpolated partial cross sections
+  inline void SelectAliasValidation(G4bool input);
+
 protected:
 
   G4ParticleChangeForGamma* fParticleChangeForGamma;
@@ -84,6 +93,8 @@ protected:
 private:
 
   G4bool statCode;
+  G4bool aliasCode;
+  G4bool aliasValidation;
 
   // Water density table
   const std::vector<G4double>* fpMolWaterDensity;
@@ -106,6 +117,15 @@ private:
 
   G4int RandomSelect(G4double energy, const G4String& particle);
 
+  // Alias tables of the excitation levels, one per tabulated energy
+
+  std::vector<G4double> aliasEnergies;
+  std::vector<G4DNAAliasTable> aliasTables;
+
+  void BuildAliasTables(const G4String& particle);
+
+  G4int AliasSelect(G4double energy, const G4String& particle);
+
   // Final state
 
   G4DNAEmfietzoglouWaterExcitationStructure waterStructure;
@@ -126,4 +146,18 @@ inline void G4DNAEmfietzoglouExcitationModel::SelectStationary (G4bool input)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+inline void G4DNAEmfietzoglouExcitationModel::SelectAliasSampling (G4bool input)
+{ 
+    aliasCode = input; 
+}		 
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline void G4DNAEmfietzoglouExcitationModel::SelectAliasValidation (G4bool input)
+{ 
+    aliasValidation = input; 
+}		 
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 #endif
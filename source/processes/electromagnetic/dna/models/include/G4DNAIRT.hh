@@ -54,6 +54,7 @@
 #include "G4Molecule.hh"
 #include "G4VITReactionProcess.hh"
 #include "G4ParticleChange.hh"
+#include "G4DNASpatialHash.hh"
 
 #include "AddClone_def.hh"
 #include <vector>
@@ -100,7 +101,7 @@ private:
     G4ITReactionSet* fReactionSet;
     G4ErrorFunction* erfc;
 
-    std::map<G4int,std::map<G4int,std::map<G4int,std::vector<G4Track*>>>> spaceBinned;
+    G4DNASpatialHash spaceBinned;
 
     G4double fRCutOff;
     G4double timeMin;
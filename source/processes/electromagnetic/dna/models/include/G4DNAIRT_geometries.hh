@@ -55,6 +55,7 @@
 #include "G4VITReactionProcess.hh"
 #include "G4ParticleChange.hh"
 #include "G4VDNAMolecularGeometry.hh"
+#include "G4DNASpatialHash.hh"
 
 #include "AddClone_def.hh"
 #include <vector>
@@ -101,7 +102,7 @@ private:
     G4ITReactionSet* fReactionSet;
     G4ErrorFunction* erfc;
 
-    std::map<G4int,std::map<G4int,std::map<G4int,std::vector<G4Track*>>>> spaceBinned;
+    G4DNASpatialHash spaceBinned;
     std::vector<std::pair<G4ThreeVector,G4Track*>> positionMap;
 
     G4double fRCutOff;
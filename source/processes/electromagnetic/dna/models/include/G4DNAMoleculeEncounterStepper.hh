@@ -51,6 +51,11 @@
 #include "G4KDTreeResult.hh"
 #include "G4ITTrackHolder.hh"
 #include "G4ITReaction.hh"
+#include "G4ITTrackPartition.hh"
+#include "G4MoleculeFinder.hh"
+
+#include <memory>
+#include <vector>
 
 class G4VDNAReactionModel;
 class G4DNAMolecularReactionTable;
@@ -89,6 +94,13 @@ public:
     // All details = 2
 
 private:
+    // Worker used to compute the time steps of one chunk of tracks
+    // when the scheduler runs the chemistry with several tasks
+    G4DNAMoleculeEncounterStepper(const G4DNAMoleculeEncounterStepper& master,
+                                  G4bool isWorker);
+
+    G4double CalculateMinTimeStepInParallel(G4double definedMinTimeStep,
+                                            G4int nTasks);
     void InitializeForNewTrack();
 
     class Utils;
@@ -105,6 +117,14 @@ private:
     G4ITReactionSet* fReactionSet;
     G4int fVerbose;
 
+    G4MoleculeFinder* fpMoleculeFinder;
+    G4bool fIsWorker;
+    std::vector<std::unique_ptr<G4DNAMoleculeEncounterStepper>> fWorkers;
+    std::vector<G4Track*> fTracks;
+    std::vector<G4ITTrackPartition::Chunk> fChunks;
+    std::vector<G4double> fTrackTimeSteps;
+    std::vector<G4TrackVectorHandle> fTrackReactants;
+
     class Utils
     {
     public:
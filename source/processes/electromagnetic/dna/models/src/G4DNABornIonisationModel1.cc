@@ -81,6 +81,11 @@ G4VEmModel(nam), isInitialised(false)
   // Selection of SP scaling
 
   spScaling = true;
+
+  // Selection of alias tables for the secondary electron energy
+
+  aliasCode = false;
+  aliasValidation = false;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -128,6 +133,19 @@ void G4DNABornIonisationModel1::Initialise(const G4ParticleDefinition* particle,
 
   char *path = getenv("G4LEDATA");
 
+  // Alias tables are built from the non-cumulated dcs
+
+  if (aliasCode && fasterCode)
+  {
+    G4ExceptionDescription ed;
+    ed << "Alias sampling is selected: the sampling of secondaries is "
+       << "switched to the non-cumulated dcs "
+       << "(SelectFasterComputation(false)).";
+    G4Exception("G4DNABornIonisationModel1::Initialise",
+                "Born_AliasSampling", JustWarning, ed);
+    fasterCode = false;
+  }
+
   // *** ELECTRON
 
   electron = electronDef->GetParticleName();
@@ -297,6 +315,8 @@ void G4DNABornIonisationModel1::Initialise(const G4ParticleDefinition* particle,
     << G4endl;
   }
 
+  if (aliasCode) BuildAliasTables(particle);
+
   // Initialize water density pointer
   
   fpMolWaterDensity = G4DNAMolecularMaterial::Instance()->
@@ -475,7 +495,19 @@ void G4DNABornIonisationModel1::SampleSecondaries(std::vector<G4DynamicParticle*
 
     G4double secondaryKinetic=-1000*eV;
 
-    if (fasterCode == false)
+    if (aliasCode)
+    {
+      G4DNAEnergyTransferSampler* sampler =
+        (particle->GetDefinition() == G4Electron::ElectronDefinition()) ?
+        &eAliasSampler[ionizationShell] : &pAliasSampler[ionizationShell];
+
+      G4double transfer = sampler->Sample(k/eV,
+        MaximumEnergyTransfer(particle->GetDefinition(),k,ionizationShell)/eV);
+
+      if (transfer > 0) secondaryKinetic = transfer*eV - bindingEnergy;
+      else secondaryKinetic = RandomizeEjectedElectronEnergy(particle->GetDefinition(),k,ionizationShell);
+    }
+    else if (fasterCode == false)
     {
       secondaryKinetic = RandomizeEjectedElectronEnergy(particle->GetDefinition(),k,ionizationShell);
     }
@@ -700,6 +732,75 @@ G4double G4DNABornIonisationModel1::RandomizeEjectedElectronEnergy(G4ParticleDef
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+G4double G4DNABornIonisationModel1::MaximumEnergyTransfer(G4ParticleDefinition* particleDefinition,
+                                                          G4double k,
+                                                          G4int shell)
+{
+  // Same kinematic limits as RandomizeEjectedElectronEnergy,
+  // expressed as energy transfer (binding + secondary kinetic energy)
+
+  G4double bindingEnergy = waterStructure.IonisationEnergy(shell);
+
+  if (particleDefinition == G4Electron::ElectronDefinition())
+  {
+    if ((k + bindingEnergy) / 2. > k) return k;
+    return (k + bindingEnergy) / 2.;
+  }
+
+  return bindingEnergy + 4. * (electron_mass_c2 / proton_mass_c2) * k;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4DNABornIonisationModel1::BuildAliasTables(const G4ParticleDefinition* particle)
+{
+  G4ParticleDefinition* electronDef = G4Electron::ElectronDefinition();
+  G4ParticleDefinition* protonDef = G4Proton::ProtonDefinition();
+
+  G4ParticleDefinition* def = 0;
+  G4DNAEnergyTransferSampler* samplers = 0;
+  TriDimensionMap* dcsData = 0;
+
+  if (particle == electronDef)
+  {
+    def = electronDef;
+    samplers = eAliasSampler;
+    dcsData = eDiffCrossSectionData;
+  }
+  else if (particle == protonDef)
+  {
+    def = protonDef;
+    samplers = pAliasSampler;
+    dcsData = pDiffCrossSectionData;
+  }
+  else return;
+
+  for (G4int j=0; j<5; j++)
+  {
+    G4double minTransfer = waterStructure.IonisationEnergy(j)/eV;
+
+    auto maxTransfer = [this, def, j](G4double t)
+    { return MaximumEnergyTransfer(def, t*eV, j)/eV; };
+
+    samplers[j].Build(dcsData[j], minTransfer, maxTransfer);
+
+    if (!aliasValidation) continue;
+
+    G4double difference = samplers[j].Validate(
+      [this, def, j](G4double t, G4double w)
+      { return DifferentialCrossSection(def, t, w, j); },
+      minTransfer, maxTransfer);
+
+    G4cout << "G4DNABornIonisationModel1 alias tables for "
+           << def->GetParticleName() << " - shell " << j
+           << " : " << samplers[j].GetNumberOfNodes() << " nodes"
+           << ", max CDF difference = " << difference
+           << G4endl;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 // The following section is not used anymore but is kept for memory
 // GetAngularDistribution()->SampleDirectionForShell is used instead
 
@@ -93,6 +93,12 @@ G4DNACPA100IonisationModel::G4DNACPA100IonisationModel(const G4ParticleDefinitio
 
     fasterCode = true;
 
+    // aliasCode = true for sampling from alias tables built from the
+    // non-cumulated dcs at initialisation
+
+    aliasCode = false;
+    aliasValidation = false;
+
     // Selection of stationary mode
 
     statCode = false;
@@ -162,6 +168,20 @@ void G4DNACPA100IonisationModel::Initialise(const G4ParticleDefinition* particle
 
     // ******************************
 
+    // Alias tables are built from the non-cumulated dcs
+
+    if (aliasCode && (!useDcs || fasterCode))
+    {
+      G4ExceptionDescription ed;
+      ed << "Alias sampling is selected: the sampling of secondaries is "
+         << "switched to the non-cumulated dcs (SelectUseDcs(true), "
+         << "SelectFasterComputation(false)).";
+      G4Exception("G4DNACPA100IonisationModel::Initialise",
+                  "CPA100_AliasSampling", JustWarning, ed);
+      useDcs = true;
+      fasterCode = false;
+    }
+
     if (useDcs)
     {
 
@@ -221,6 +241,8 @@ void G4DNACPA100IonisationModel::Initialise(const G4ParticleDefinition* particle
 
     //
 
+    if (aliasCode) BuildAliasTables();
+
     } // end of if (useDcs)
 
     // ******************************
@@ -335,7 +357,15 @@ void G4DNACPA100IonisationModel::SampleSecondaries(std::vector<G4DynamicParticle
 
         G4double secondaryKinetic=-1000*eV;
 
-        if (useDcs && !fasterCode)
+        if (aliasCode)
+        {
+          G4double transfer = eAliasSampler[ionizationShell].Sample(k/eV,
+            MaximumEnergyTransfer(k,ionizationShell)/eV);
+
+          if (transfer > 0) secondaryKinetic = transfer*eV - bindingEnergy;
+          else secondaryKinetic = RandomizeEjectedElectronEnergy(particle->GetDefinition(),k,ionizationShell);
+        }
+        else if (useDcs && !fasterCode)
           secondaryKinetic = RandomizeEjectedElectronEnergy(particle->GetDefinition(),k,ionizationShell);
 
         if (useDcs && fasterCode)
@@ -554,6 +584,48 @@ G4double G4DNACPA100IonisationModel::RandomizeEjectedElectronEnergy(G4ParticleDe
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+G4double G4DNACPA100IonisationModel::MaximumEnergyTransfer(G4double k, G4int shell)
+{
+    // Same kinematic limit as RandomizeEjectedElectronEnergy,
+    // expressed as energy transfer (binding + secondary kinetic energy)
+
+    G4double bindingEnergy = waterStructure.IonisationEnergy(shell);
+
+    if ((k+bindingEnergy)/2. > k) return k;
+    return (k+bindingEnergy)/2.;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4DNACPA100IonisationModel::BuildAliasTables()
+{
+    G4ParticleDefinition* electronDef = G4Electron::ElectronDefinition();
+
+    for (G4int j=0; j<5; j++)
+    {
+        G4double minTransfer = waterStructure.IonisationEnergy(j)/eV;
+
+        auto maxTransfer = [this, j](G4double t)
+        { return MaximumEnergyTransfer(t*eV, j)/eV; };
+
+        eAliasSampler[j].Build(eDiffCrossSectionData[j], minTransfer, maxTransfer);
+
+        if (!aliasValidation) continue;
+
+        G4double difference = eAliasSampler[j].Validate(
+          [this, electronDef, j](G4double t, G4double w)
+          { return DifferentialCrossSection(electronDef, t, w, j); },
+          minTransfer, maxTransfer);
+
+        G4cout << "G4DNACPA100IonisationModel alias tables - shell " << j
+               << " : " << eAliasSampler[j].GetNumberOfNodes() << " nodes"
+               << ", max CDF difference = " << difference
+               << G4endl;
+    }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 void G4DNACPA100IonisationModel::RandomizeEjectedElectronDirection(G4ParticleDefinition*,
                                                                  G4double k,
                                                                  G4double secKinetic,
@@ -39,6 +39,9 @@
 #include "G4SystemOfUnits.hh"
 #include "G4DNAChemistryManager.hh"
 #include "G4DNAMolecularMaterial.hh"
+#include "G4Log.hh"
+
+#include <algorithm>
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
@@ -71,6 +74,10 @@ G4DNAEmfietzoglouExcitationModel::G4DNAEmfietzoglouExcitationModel(const G4Parti
 
     // Selection of stationary mode
     statCode = false;
+
+    // Selection of alias tables for the excitation level
+    aliasCode = false;
+    aliasValidation = false;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -118,6 +125,8 @@ void G4DNAEmfietzoglouExcitationModel::Initialise(const G4ParticleDefinition* pa
 
     tableData[electron] = tableE;
 
+    if (aliasCode) BuildAliasTables(electron);
+
     //
 
     if( verboseLevel>0 )
@@ -207,7 +216,7 @@ void G4DNAEmfietzoglouExcitationModel::SampleSecondaries(std::vector<G4DynamicPa
 
     const G4String& particleName = aDynamicParticle->GetDefinition()->GetParticleName();
 
-    G4int level = RandomSelect(k,particleName);
+    G4int level = aliasCode ? AliasSelect(k,particleName) : RandomSelect(k,particleName);
     G4double excitationEnergy = waterStructure.ExcitationEnergy(level);
     G4double newEnergy = k - excitationEnergy;
 
@@ -292,3 +301,93 @@ G4int G4DNAEmfietzoglouExcitationModel::RandomSelect(G4double k, const G4String&
     }
     return level;
 }
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4DNAEmfietzoglouExcitationModel::BuildAliasTables(const G4String& particle)
+{
+    aliasEnergies.clear();
+    aliasTables.clear();
+
+    G4DNACrossSectionDataSet* table = tableData[particle];
+    if (table == 0 || table->NumberOfComponents() == 0) return;
+
+    const size_t n(table->NumberOfComponents());
+    const G4DataVector& energies = table->GetEnergies(0);
+
+    std::vector<G4double> values(n);
+
+    for (size_t e=0; e<energies.size(); e++)
+    {
+        for (size_t i=0; i<n; i++)
+        {
+            values[i] = table->GetComponent(i)->FindValue(energies[e]);
+        }
+
+        G4DNAAliasTable aliasTable;
+        if (!aliasTable.Build(values)) continue;
+
+        aliasEnergies.push_back(energies[e]);
+        aliasTables.push_back(aliasTable);
+    }
+
+    if (!aliasValidation) return;
+
+    // Level probabilities at the geometric mean of consecutive energies
+
+    G4double maxDifference = 0.;
+
+    for (size_t e=0; e+1<aliasEnergies.size(); e++)
+    {
+        G4double k = std::sqrt(aliasEnergies[e]*aliasEnergies[e+1]);
+        G4double weight = G4Log(k/aliasEnergies[e])
+                        / G4Log(aliasEnergies[e+1]/aliasEnergies[e]);
+
+        G4double total = 0.;
+        for (size_t i=0; i<n; i++)
+        {
+            values[i] = table->GetComponent(i)->FindValue(k);
+            total += values[i];
+        }
+        if (total <= 0) continue;
+
+        for (size_t i=0; i<n; i++)
+        {
+            G4double difference = values[i]/total
+                                - (1.-weight)*aliasTables[e].GetProbability(i)
+                                - weight*aliasTables[e+1].GetProbability(i);
+            if (difference < 0) difference = -difference;
+            if (difference > maxDifference) maxDifference = difference;
+        }
+    }
+
+    G4cout << "G4DNAEmfietzoglouExcitationModel alias tables for " << particle
+           << " : " << aliasTables.size() << " energies"
+           << ", max level probability difference = " << maxDifference
+           << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int G4DNAEmfietzoglouExcitationModel::AliasSelect(G4double k, const G4String& particle)
+{
+    // Below the first tabulated energy the partial cross sections are used
+
+    if (aliasTables.empty() || k < aliasEnergies.front()) return RandomSelect(k,particle);
+
+    size_t e = aliasEnergies.size()-1;
+
+    if (k < aliasEnergies.back())
+    {
+        e = std::upper_bound(aliasEnergies.begin(), aliasEnergies.end(), k)
+          - aliasEnergies.begin() - 1;
+
+        // Statistical interpolation in log(energy) between the two tables
+
+        G4double weight = G4Log(k/aliasEnergies[e])
+                        / G4Log(aliasEnergies[e+1]/aliasEnergies[e]);
+        if (G4UniformRand() < weight) e++;
+    }
+
+    return aliasTables[e].Sample(G4UniformRand());
+}
@@ -36,7 +36,7 @@
 #include "G4Timer.hh"
 #include "G4Scheduler.hh"
 #include "G4UserMeshAction.hh"
-#include "G4MoleculeCounter.hh"
+#include "G4VMoleculeCounter.hh"
 #include "G4DNAScavengerMaterial.hh"
 
 G4DNAEventScheduler::G4DNAEventScheduler(const G4DNABoundingBox& boundingBox,
@@ -84,15 +84,15 @@ void G4DNAEventScheduler::ClearAndReChargeCounter()
 
   if(G4VMoleculeCounter::Instance()->InUse())  // copy from MoleculeCounter
   {
-    G4MoleculeCounter::RecordedMolecules species;
-    species = G4MoleculeCounter::Instance()->GetRecordedMolecules();
+    G4VMoleculeCounter::RecordedMolecules species;
+    species = G4VMoleculeCounter::Instance()->GetRecordedMolecules();
     if(species.get() == nullptr)
     {
       return;
     }
     else if(species->empty())
     {
-      G4MoleculeCounter::Instance()->ResetCounter();
+      G4VMoleculeCounter::Instance()->ResetCounter();
       return;
     }
     for(auto time_mol : fTimeToRecord)
@@ -104,7 +104,7 @@ void G4DNAEventScheduler::ClearAndReChargeCounter()
 
       for(auto molecule : *species)
       {
-        G4int n_mol = G4MoleculeCounter::Instance()->GetNMoleculesAtTime(
+        G4int n_mol = G4VMoleculeCounter::Instance()->GetNMoleculesAtTime(
           molecule, time_mol);
 
         if(n_mol < 0)
@@ -119,8 +119,8 @@ void G4DNAEventScheduler::ClearAndReChargeCounter()
 
       fLastRecoredTime++;
     }
-    G4MoleculeCounter::Instance()->ResetCounter();  // reset
-    G4MoleculeCounter::Instance()->Use(false);      // no more used
+    G4VMoleculeCounter::Instance()->ResetCounter();  // reset
+    G4VMoleculeCounter::Instance()->Use(false);      // no more used
   }
 }
 
@@ -610,10 +610,10 @@ void G4DNAEventScheduler::RecordTime()
              << conf->GetName()
              << "  number : " << fCounterMap[recordTime][conf]
              << "  MoleculeCounter : "
-             << G4MoleculeCounter::Instance()->GetCurrentNumberOf(conf)
+             << G4VMoleculeCounter::Instance()->GetCurrentNumberOf(conf)
              << G4endl;
 
-      assert(G4MoleculeCounter::Instance()->GetCurrentNumberOf(conf) ==
+      assert(G4VMoleculeCounter::Instance()->GetCurrentNumberOf(conf) ==
              fCounterMap[recordTime][conf]);
     }
 #endif
@@ -100,8 +100,6 @@ void G4DNAIRT::Initialize(){
   fReactionSet->CleanAllReaction();
   fReactionSet->SortByTime();
 
-  spaceBinned.clear();
-
   timeMin = G4Scheduler::Instance()->GetStartTime();
   timeMax = G4Scheduler::Instance()->GetEndTime();
 
@@ -154,13 +152,15 @@ void G4DNAIRT::SpaceBinning(){
 
 void G4DNAIRT::IRTSampling(){
 
+  spaceBinned.Reset(fNx, fNy);
+
   auto it_begin = fTrackHolder->GetMainList()->begin();
   while(it_begin != fTrackHolder->GetMainList()->end()){
     G4int I = FindBin(fNx, fXMin, fXMax, it_begin->GetPosition().x());
     G4int J = FindBin(fNy, fYMin, fYMax, it_begin->GetPosition().y());
     G4int K = FindBin(fNz, fZMin, fZMax, it_begin->GetPosition().z());
 
-    spaceBinned[I][J][K].push_back(*it_begin);
+    spaceBinned.Insert(I, J, K, *it_begin);
 
     Sampling(*it_begin);
     ++it_begin;
@@ -191,8 +191,11 @@ void G4DNAIRT::Sampling(G4Track* track){
     for ( int jj = yiniIndex; jj <= yendIndex; jj++ ) {
       for ( int kk = ziniIndex; kk <= zendIndex; kk++ ) {
 
-        std::vector<G4Track*> spaceBin = spaceBinned[ii][jj][kk];
-        for ( int n = 0; n < (int)spaceBinned[ii][jj][kk].size(); n++ ) {
+        const G4DNASpatialHash::Cell* cell = spaceBinned.Find(ii, jj, kk);
+        if(cell == nullptr) continue;
+
+        const G4DNASpatialHash::Cell& spaceBin = *cell;
+        for ( int n = 0; n < (int)spaceBin.size(); n++ ) {
           if(!spaceBin[n] || track == spaceBin[n]) continue;
           if(spaceBin[n]->GetTrackStatus() == fStopButAlive) continue;
 
@@ -236,7 +239,6 @@ void G4DNAIRT::Sampling(G4Track* track){
             fReactionSet->AddReaction(irt,track,spaceBin[n]);
           }
         }
-        spaceBin.clear();
       }
     }
   }
@@ -483,7 +485,7 @@ std::unique_ptr<G4ITReactionChange> G4DNAIRT::MakeReaction(const G4Track& trackA
       G4int J = FindBin(fNy, fYMin, fYMax, position[u].y());
       G4int K = FindBin(fNz, fZMin, fZMax, position[u].z());
 
-      spaceBinned[I][J][K].push_back(productTrack);
+      spaceBinned.Insert(I, J, K, productTrack);
 
       Sampling(productTrack);
     }
@@ -111,7 +111,6 @@ void G4DNAIRT_geometries::Initialize(){
   fReactionSet->CleanAllReaction();
   fReactionSet->SortByTime();
 
-  spaceBinned.clear();
   positionMap.clear();
 
   fRCutOff =
@@ -181,13 +180,15 @@ void G4DNAIRT_geometries::SpaceBinning(){
 
 void G4DNAIRT_geometries::IRTSampling(){
 
+  spaceBinned.Reset(fNx, fNy);
+
   auto it_begin = fTrackHolder->GetMainList()->begin();
   while(it_begin != fTrackHolder->GetMainList()->end()){
     G4int I = FindBin(fNx, fXMin, fXMax, it_begin->GetPosition().x());
     G4int J = FindBin(fNy, fYMin, fYMax, it_begin->GetPosition().y());
     G4int K = FindBin(fNz, fZMin, fZMax, it_begin->GetPosition().z());
 
-    spaceBinned[I][J][K].push_back(*it_begin);
+    spaceBinned.Insert(I, J, K, *it_begin);
 
     Sampling(*it_begin);
     ++it_begin;
@@ -218,8 +219,11 @@ void G4DNAIRT_geometries::Sampling(G4Track* track){
     for ( G4int jj = yiniIndex; jj <= yendIndex; ++jj ) {
       for ( G4int kk = ziniIndex; kk <= zendIndex; ++kk ) {
 
-        std::vector<G4Track*> spaceBin = spaceBinned[ii][jj][kk];
-        for ( G4int n = 0; n < (G4int)spaceBinned[ii][jj][kk].size(); ++n ) {
+        const G4DNASpatialHash::Cell* cell = spaceBinned.Find(ii, jj, kk);
+        if(cell == nullptr) continue;
+
+        const G4DNASpatialHash::Cell& spaceBin = *cell;
+        for ( G4int n = 0; n < (G4int)spaceBin.size(); ++n ) {
           if(!spaceBin[n] || track == spaceBin[n]) continue;
           if(spaceBin[n]->GetTrackStatus() == fStopButAlive) continue;
 
@@ -263,7 +267,6 @@ void G4DNAIRT_geometries::Sampling(G4Track* track){
             fReactionSet->AddReaction(irt,track,spaceBin[n]);
           }
         }
-        spaceBin.clear();
       }
     }
   }
@@ -577,7 +580,7 @@ std::unique_ptr<G4ITReactionChange> G4DNAIRT_geometries::MakeReaction(const G4Tr
       G4int J = FindBin(fNy, fYMin, fYMax, position[u].y());
       G4int K = FindBin(fNz, fZMin, fZMax, position[u].z());
 
-      spaceBinned[I][J][K].push_back(productTrack);
+      spaceBinned.Insert(I, J, K, productTrack);
 
       Sampling(productTrack);
     }
@@ -45,6 +45,7 @@
 #include "G4UnitsTable.hh"
 #include "G4MoleculeFinder.hh"
 #include "G4MolecularConfiguration.hh"
+#include "G4Scheduler.hh"
 
 using namespace std;
 using namespace CLHEP;
@@ -73,11 +74,28 @@ G4DNAMoleculeEncounterStepper::G4DNAMoleculeEncounterStepper()
     , fMolecularReactionTable(reference_cast<const G4DNAMolecularReactionTable*>(fpReactionTable))
     , fReactionModel(nullptr)
     , fVerbose(0)
+    , fpMoleculeFinder(nullptr)
+    , fIsWorker(false)
 {
     fpTrackContainer = G4ITTrackHolder::Instance();
     fReactionSet = G4ITReactionSet::Instance();
 }
 
+G4DNAMoleculeEncounterStepper::
+G4DNAMoleculeEncounterStepper(const G4DNAMoleculeEncounterStepper& master,
+                              G4bool isWorker)
+    : G4VITTimeStepComputer(master)
+    , fHasAlreadyReachedNullTime(false)
+    , fMolecularReactionTable(reference_cast<const G4DNAMolecularReactionTable*>(fpReactionTable))
+    , fReactionModel(master.fReactionModel)
+    , fpTrackContainer(nullptr)
+    , fReactionSet(nullptr)
+    , fVerbose(0)
+    , fpMoleculeFinder(master.fpMoleculeFinder)
+    , fIsWorker(isWorker)
+{
+}
+
 G4DNAMoleculeEncounterStepper::~G4DNAMoleculeEncounterStepper() = default;
 
 void G4DNAMoleculeEncounterStepper::Prepare()
@@ -91,7 +109,10 @@ void G4DNAMoleculeEncounterStepper::Prepare()
 #if defined (DEBUG_MEM)
     mem_first = MemoryUsage();
 #endif
-    G4MoleculeFinder::Instance()->UpdatePositionMap();
+    // The finder is thread local: keep the instance of the scheduler thread
+    // for the workers computing time steps on other threads
+    fpMoleculeFinder = G4MoleculeFinder::Instance();
+    fpMoleculeFinder->UpdatePositionMap();
 
 #if defined (DEBUG_MEM)
     mem_second = MemoryUsage();
@@ -189,7 +210,10 @@ G4DNAMoleculeEncounterStepper::CalculateStep(const G4Track& trackA,
     }
 
     fReactants.reset(new vector<G4Track*>());
-    fReactionModel->Initialise(pMolConfA, trackA);
+    if (!fIsWorker)
+    {
+        fReactionModel->Initialise(pMolConfA, trackA);
+    }
 
     //__________________________________________________________________
     // Start looping on possible reactants
@@ -199,12 +223,15 @@ G4DNAMoleculeEncounterStepper::CalculateStep(const G4Track& trackA,
 
         //______________________________________________________________
         // Retrieve reaction range
-        const G4double R = fReactionModel->GetReactionRadius(i);
+        // (workers share the reaction model and must not change its state)
+        const G4double R = fIsWorker
+            ? fReactionModel->GetReactionRadius(pMolConfA, pMoleculeB)
+            : fReactionModel->GetReactionRadius(i);
 
         //______________________________________________________________
         // Use KdTree algorithm to find closest reactants
         G4KDTreeResultHandle resultsNearest(
-            G4MoleculeFinder::Instance()->FindNearest(pMoleculeA,
+            fpMoleculeFinder->FindNearest(pMoleculeA,
                                                       pMoleculeB->GetMoleculeID()));
 
         if (resultsNearest == 0) continue;
@@ -227,7 +254,7 @@ G4DNAMoleculeEncounterStepper::CalculateStep(const G4Track& trackA,
 
             fSampledMinTimeStep = 0.;
             G4KDTreeResultHandle resultsInRange(
-                G4MoleculeFinder::Instance()->FindNearestInRange(pMoleculeA,
+                fpMoleculeFinder->FindNearestInRange(pMoleculeA,
                                                                  pMoleculeB->GetMoleculeID(),
                                                                  R));
             CheckAndRecordResults(utils,
@@ -257,7 +284,7 @@ G4DNAMoleculeEncounterStepper::CalculateStep(const G4Track& trackA,
                     G4double range = R + sqrt(fUserMinTimeStep*utils.fConstant);
 
                     G4KDTreeResultHandle resultsInRange(
-                        G4MoleculeFinder::Instance()->
+                        fpMoleculeFinder->
                         FindNearestInRange(pMoleculeA,
                                            pMoleculeB->GetMoleculeID(),
                                            range));
@@ -442,6 +469,12 @@ void G4DNAMoleculeEncounterStepper::SetVerbose(int flag)
 
 G4double G4DNAMoleculeEncounterStepper::CalculateMinTimeStep(G4double /*currentGlobalTime*/, G4double definedMinTimeStep){
 
+    G4int nTasks = G4Scheduler::Instance()->GetNumberOfChemistryTasks();
+    if (nTasks > 1)
+    {
+        return CalculateMinTimeStepInParallel(definedMinTimeStep, nTasks);
+    }
+
     G4double fTSTimeStep = DBL_MAX;
 
     for (auto pTrack : *fpTrackContainer->GetMainList())
@@ -491,3 +524,85 @@ G4double G4DNAMoleculeEncounterStepper::CalculateMinTimeStep(G4double /*currentG
 
     return fTSTimeStep;
 }
+
+G4double
+G4DNAMoleculeEncounterStepper::CalculateMinTimeStepInParallel(G4double definedMinTimeStep,
+                                                              G4int nTasks)
+{
+    fTracks.clear();
+    for (auto pTrack : *fpTrackContainer->GetMainList())
+    {
+        if (pTrack == nullptr)
+        {
+            G4ExceptionDescription exceptionDescription;
+            exceptionDescription << "No track found.";
+            G4Exception("G4Scheduler::CalculateMinStep", "ITScheduler006",
+                        FatalErrorInArgument, exceptionDescription);
+            continue;
+        }
+
+        G4TrackStatus trackStatus = pTrack->GetTrackStatus();
+        if (trackStatus == fStopAndKill || trackStatus == fStopButAlive)
+        {
+            continue;
+        }
+        fTracks.push_back(pTrack);
+    }
+
+    G4ITTrackPartition::Build(fTracks, nTasks, fChunks);
+
+    while (fWorkers.size() < fChunks.size())
+    {
+        fWorkers.emplace_back(new G4DNAMoleculeEncounterStepper(*this, true));
+    }
+    for (auto& pWorker : fWorkers)
+    {
+        pWorker->SetReactionTable(fpReactionTable);
+        pWorker->fReactionModel = fReactionModel;
+        pWorker->fpMoleculeFinder = fpMoleculeFinder;
+    }
+
+    fTrackTimeSteps.assign(fTracks.size(), DBL_MAX);
+    fTrackReactants.assign(fTracks.size(), G4TrackVectorHandle());
+
+    // Each chunk writes only the entries of its own tracks
+    G4ITTrackPartition::Execute(fChunks.size(),
+                                [this, definedMinTimeStep](std::size_t iChunk)
+    {
+        G4DNAMoleculeEncounterStepper* pWorker = fWorkers[iChunk].get();
+        for (auto index : fChunks[iChunk])
+        {
+            fTrackTimeSteps[index] =
+                pWorker->CalculateStep(*fTracks[index], definedMinTimeStep);
+            fTrackReactants[index] = pWorker->GetReactants();
+            pWorker->ResetReactants();
+        }
+    });
+
+    // Merge in the order of the main list, as done by the sequential loop,
+    // so that the reaction set does not depend on the partition
+    G4double fTSTimeStep = DBL_MAX;
+
+    for (std::size_t i = 0; i < fTracks.size(); ++i)
+    {
+        G4double sampledMinTimeStep = fTrackTimeSteps[i];
+        G4TrackVectorHandle& reactants = fTrackReactants[i];
+
+        if (sampledMinTimeStep < fTSTimeStep)
+        {
+            fTSTimeStep = sampledMinTimeStep;
+            fReactionSet->CleanAllReaction();
+            if (reactants)
+            {
+                fReactionSet->AddReactions(fTSTimeStep, fTracks[i], reactants);
+            }
+        }
+        else if (fTSTimeStep == sampledMinTimeStep && bool(reactants))
+        {
+            fReactionSet->AddReactions(fTSTimeStep, fTracks[i], reactants);
+        }
+        reactants.reset();
+    }
+
+    return fTSTimeStep;
+}
@@ -30,7 +30,7 @@
 #include "G4Molecule.hh"
 #include "G4DNAMolecularReactionTable.hh"
 #include "G4UnitsTable.hh"
-#include "G4MoleculeCounter.hh"
+#include "G4VMoleculeCounter.hh"
 #include "G4DNAScavengerMaterial.hh"
 #include "G4Scheduler.hh"
 G4DNAUpdateSystemModel::G4DNAUpdateSystemModel()
@@ -183,21 +183,21 @@ void G4DNAUpdateSystemModel::UpdateSystem(const Index& index,
       //#define DEBUG 1
 
 #ifdef DEBUG
-      if(G4MoleculeCounter::Instance()->InUse())
+      if(G4VMoleculeCounter::Instance()->InUse())
         if(fpMesh->GetNumberOfType(data.GetProduct(j)) !=
-           G4MoleculeCounter::Instance()->GetCurrentNumberOf(
+           G4VMoleculeCounter::Instance()->GetCurrentNumberOf(
              data.GetProduct(j)))
         {
           G4cout << "*********G4DNAUpdateSystemModel::DEBUG::GetNumberOfType("
                  << data.GetProduct(j)->GetName()
                  << ") : " << fpMesh->GetNumberOfType(data.GetProduct(j))
                  << G4endl;
-          G4cout << "G4MoleculeCounter::GetCurrentNumberOf ("
+          G4cout << "G4VMoleculeCounter::GetCurrentNumberOf ("
                  << data.GetProduct(j)->GetName() << ") : "
-                 << G4MoleculeCounter::Instance()->GetCurrentNumberOf(
+                 << G4VMoleculeCounter::Instance()->GetCurrentNumberOf(
                       data.GetProduct(j))
                  << G4endl;
-          G4MoleculeCounter::Instance()->Dump();
+          G4VMoleculeCounter::Instance()->Dump();
           throw;
         }
 
@@ -224,36 +224,36 @@ void G4DNAUpdateSystemModel::UpdateSystem(const Index& index,
 #endif
   KillMolecule(index, reactant1);
 #ifdef DEBUG
-  if(G4MoleculeCounter::Instance()->InUse())
+  if(G4VMoleculeCounter::Instance()->InUse())
     if(fpMesh->GetNumberOfType(reactant1) !=
-       G4MoleculeCounter::Instance()->GetCurrentNumberOf(reactant1))
+       G4VMoleculeCounter::Instance()->GetCurrentNumberOf(reactant1))
     {
       G4cout << "*********G4DNAUpdateSystemModel::DEBUG::GetNumberOfType("
              << reactant1->GetName()
              << ") : " << fpMesh->GetNumberOfType(reactant1) << G4endl;
-      G4cout << "G4MoleculeCounter::GetCurrentNumberOf ("
+      G4cout << "G4VMoleculeCounter::GetCurrentNumberOf ("
              << reactant1->GetName() << ") : "
-             << G4MoleculeCounter::Instance()->GetCurrentNumberOf(reactant1)
+             << G4VMoleculeCounter::Instance()->GetCurrentNumberOf(reactant1)
              << G4endl;
-      G4MoleculeCounter::Instance()->Dump();
+      G4VMoleculeCounter::Instance()->Dump();
       throw;
     }
 #endif
   KillMolecule(index, reactant2);
 #ifdef DEBUG
 
-  if(G4MoleculeCounter::Instance()->InUse())
+  if(G4VMoleculeCounter::Instance()->InUse())
     if(fpMesh->GetNumberOfType(reactant2) !=
-       G4MoleculeCounter::Instance()->GetCurrentNumberOf(reactant2))
+       G4VMoleculeCounter::Instance()->GetCurrentNumberOf(reactant2))
     {
       G4cout << "*********G4DNAUpdateSystemModel::DEBUG::GetNumberOfType("
              << reactant2->GetName()
              << ") : " << fpMesh->GetNumberOfType(reactant2) << G4endl;
-      G4cout << "G4MoleculeCounter::GetCurrentNumberOf ("
+      G4cout << "G4VMoleculeCounter::GetCurrentNumberOf ("
              << reactant2->GetName() << ") : "
-             << G4MoleculeCounter::Instance()->GetCurrentNumberOf(reactant2)
+             << G4VMoleculeCounter::Instance()->GetCurrentNumberOf(reactant2)
              << G4endl;
-      G4MoleculeCounter::Instance()->Dump();
+      G4VMoleculeCounter::Instance()->Dump();
       throw;
     }
 #endif
@@ -72,9 +72,7 @@ class G4MoleculeCounter : public G4VMoleculeCounter
 {
     //----------------------------------------------------------------------------
 public:
-    using ReactantList = std::vector<Reactant*>;
     using CounterMapType = std::map<Reactant*, NbMoleculeAgainstTime>;
-    using RecordedMolecules = std::unique_ptr<ReactantList>;
 
     static G4MoleculeCounter* Instance();
 
@@ -88,11 +86,12 @@ public:
 
     //----------------------------------------------------------------------------
 
-    int GetNMoleculesAtTime(Reactant* molecule, G4double time);
+    int GetNMoleculesAtTime(Reactant* molecule, G4double time) override;
+    int GetCurrentNumberOf(Reactant* molecule) override;
     const NbMoleculeAgainstTime& GetNbMoleculeAgainstTime(Reactant* molecule);
 
-    RecordedMolecules GetRecordedMolecules();
-    RecordedTimes GetRecordedTimes();
+    RecordedMolecules GetRecordedMolecules() override;
+    RecordedTimes GetRecordedTimes() override;
 
     void SetVerbose(G4int);
     G4int GetVerbose();
@@ -100,7 +99,7 @@ public:
     /* It sets the min time difference in between two time slices. */
     static void SetTimeSlice(G4double);
 
-    void Dump();
+    void Dump() override;
 
     G4bool IsTimeCheckedForConsistency() const;
     void CheckTimeForConsistency(G4bool flag);
@@ -0,0 +1,155 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4MoleculeTimeSeriesCounter
+//
+// Molecule counter with a compact storage of the number of molecules
+// against time, meant for long chemistry runs where G4MoleculeCounter
+// builds one std::map node per reaction time.
+//
+// Two storage modes are available:
+//  - by default, one append-only pair of sorted vectors (times, numbers)
+//    per species. Records closer in time than the time slice (see
+//    G4MoleculeCounter::SetTimeSlice) are folded into the last entry,
+//    and Compact() removes entries which do not change the number;
+//  - after SetLogTimeBinning(), a fixed set of logarithmic time bins per
+//    species. Each bin keeps the number of molecules at the end of the
+//    bin, so the memory does not depend on the number of reactions.
+//    Times below the first edge and above the last edge fall in an
+//    underflow and an overflow bin.
+//
+// The query API of G4VMoleculeCounter (GetNMoleculesAtTime(),
+// GetCurrentNumberOf(), GetRecordedTimes(), GetRecordedMolecules())
+// behaves as in G4MoleculeCounter. Merge() adds the time series of another
+// counter, e.g. to sum the counters of the worker threads at the end of
+// the run; it is protected by a mutex so that several workers can merge
+// into the same counter.
+//
+// Usage: G4VMoleculeCounter::SetInstance(new G4MoleculeTimeSeriesCounter())
+// in the action initialization, before the molecule counter is used.
+
+#ifndef G4MoleculeTimeSeriesCounter_hh
+#define G4MoleculeTimeSeriesCounter_hh 1
+
+#include "G4VMoleculeCounter.hh"
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+class G4MoleculeTimeSeriesCounter : public G4VMoleculeCounter
+{
+public:
+    G4MoleculeTimeSeriesCounter();
+    ~G4MoleculeTimeSeriesCounter() override;
+
+    // Returns the counter of this thread, nullptr if another
+    // type of counter is in use
+    static G4MoleculeTimeSeriesCounter* Instance();
+
+    void Initialize() override;
+    void ResetCounter() override;
+
+    void DontRegister(const G4MoleculeDefinition*) override;
+    bool IsRegistered(const G4MoleculeDefinition*) override;
+    void RegisterAll() override;
+
+    // Switches to logarithmic time bins between minTime and maxTime;
+    // must be called before anything is recorded
+    void SetLogTimeBinning(G4double minTime, G4double maxTime,
+                           G4int nBinsPerDecade);
+    G4bool IsBinned() const { return fNBins > 0; }
+
+    int GetNMoleculesAtTime(Reactant* molecule, G4double time) override;
+    int GetCurrentNumberOf(Reactant* molecule) override;
+    RecordedMolecules GetRecordedMolecules() override;
+    RecordedTimes GetRecordedTimes() override;
+
+    // Removes, in vector mode, the records which leave the number of
+    // molecules unchanged
+    void Compact();
+
+    // Adds the time series recorded by another counter
+    void Merge(const G4MoleculeTimeSeriesCounter& other);
+
+    // Number of stored (time, number) entries, for all species
+    std::size_t GetNumberOfEntries() const;
+
+    void SetVerbose(G4int level) { fVerbose = level; }
+    G4int GetVerbose() const { return fVerbose; }
+
+    void CheckTimeForConsistency(G4bool flag)
+    {
+        fCheckTimeIsConsistentWithScheduler = flag;
+    }
+
+    void Dump() override;
+
+    void AddAMoleculeAtTime(Reactant*,
+                            G4double time,
+                            const G4ThreeVector* position = nullptr,
+                            int number = 1) override;
+    void RemoveAMoleculeAtTime(Reactant*,
+                               G4double time,
+                               const G4ThreeVector* position = nullptr,
+                               int number = 1) override;
+
+private:
+    struct TimeSeries
+    {
+        // Vector mode: record times; empty in binned mode
+        std::vector<G4double> fTimes;
+        // Number after each record, or at the end of each bin
+        std::vector<G4int> fNumbers;
+        // Binned mode: last bin written (-1 if none)
+        G4int fLastBin = -1;
+        G4int fCurrent = 0;
+    };
+
+    void Record(Reactant*, G4double time, G4int number,
+                const char* method);
+    G4int GetBin(G4double time) const;
+    G4double GetBinLowEdge(G4int bin) const;
+    G4int GetNumberInBin(const TimeSeries&, G4int bin) const;
+    G4int GetNumberAtTime(const TimeSeries&, G4double time) const;
+
+    std::map<Reactant*, TimeSeries> fSeries;
+    std::map<const G4MoleculeDefinition*, G4bool> fDontRegister;
+
+    // Logarithmic binning: fNBins regular bins plus underflow (0)
+    // and overflow (fNBins + 1)
+    G4int fNBins;
+    G4double fMinTime;
+    G4double fMaxTime;
+    G4double fLogMinTime;
+    G4double fInvLogBinWidth;
+
+    G4int fVerbose;
+    G4bool fCheckTimeIsConsistentWithScheduler;
+};
+
+#endif
@@ -37,6 +37,9 @@
 #include <G4Types.hh>
 #include <G4ios.hh>
 #include "G4ThreeVector.hh"
+#include <memory>
+#include <set>
+#include <vector>
 
 class G4MolecularConfiguration;
 
@@ -58,6 +61,9 @@ public:
     static void DeleteInstance();
 
     using Reactant = const G4MolecularConfiguration;
+    using ReactantList = std::vector<Reactant*>;
+    using RecordedMolecules = std::unique_ptr<ReactantList>;
+    using RecordedTimes = std::unique_ptr<std::set<G4double>>;
 
     /*
      * If no instance of G4VMoleculeCounter is provided
@@ -105,4 +111,33 @@ public:
     virtual void RegisterAll()
     {
     }
+
+    //----------------------------------------------------
+    // Query of the recorded numbers of molecules; counters which do not
+    // record them against time keep the default implementations.
+
+    virtual int GetNMoleculesAtTime(Reactant*, G4double /*time*/)
+    {
+        return 0;
+    }
+
+    /* Number of molecules after the last record. */
+    virtual int GetCurrentNumberOf(Reactant*)
+    {
+        return 0;
+    }
+
+    virtual RecordedMolecules GetRecordedMolecules()
+    {
+        return nullptr;
+    }
+
+    virtual RecordedTimes GetRecordedTimes()
+    {
+        return nullptr;
+    }
+
+    virtual void Dump()
+    {
+    }
 };
\ No newline at end of file
@@ -8,6 +8,7 @@ geant4_add_module(G4emdna-molman
     G4MolecularDissociationChannel.hh
     G4MolecularDissociationTable.hh
     G4MoleculeCounter.hh
+    G4MoleculeTimeSeriesCounter.hh
     G4MoleculeDefinition.hh
     G4MoleculeFinder.hh
     G4MoleculeHandleManager.hh
@@ -22,6 +23,7 @@ geant4_add_module(G4emdna-molman
     G4MolecularDissociationChannel.cc
     G4MolecularDissociationTable.cc
     G4MoleculeCounter.cc
+    G4MoleculeTimeSeriesCounter.cc
     G4Molecule.cc
     G4MoleculeDefinition.cc
     G4MoleculeHandleManager.cc
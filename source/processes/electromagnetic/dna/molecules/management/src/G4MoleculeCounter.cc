@@ -207,6 +207,18 @@ int G4MoleculeCounter::GetNMoleculesAtTime(Reactant* molecule,
 
 //------------------------------------------------------------------------------
 
+int G4MoleculeCounter::GetCurrentNumberOf(Reactant* molecule)
+{
+    auto it = fCounterMap.find(molecule);
+    if (it == fCounterMap.end() || it->second.empty())
+    {
+        return 0;
+    }
+    return it->second.rbegin()->second;
+}
+
+//------------------------------------------------------------------------------
+
 void G4MoleculeCounter::AddAMoleculeAtTime(Reactant* molecule,
                                            G4double time,
                                            const G4ThreeVector* /*position*/,
@@ -0,0 +1,579 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+// G4MoleculeTimeSeriesCounter implementation
+// --------------------------------------------------------------------
+
+#include "G4MoleculeTimeSeriesCounter.hh"
+#include "G4MoleculeCounter.hh"
+#include "G4MoleculeTable.hh"
+#include "G4MolecularConfiguration.hh"
+#include "G4MoleculeDefinition.hh"
+#include "G4UnitsTable.hh"
+#include "G4AutoLock.hh"
+#include "G4Exp.hh"
+#include "G4Log.hh"
+#include "G4Scheduler.hh"
+
+#include <algorithm>
+
+namespace
+{
+    G4Mutex mergeMutex = G4MUTEX_INITIALIZER;
+}
+
+//------------------------------------------------------------------------------
+
+G4MoleculeTimeSeriesCounter::G4MoleculeTimeSeriesCounter()
+    : fNBins(0)
+    , fMinTime(0.)
+    , fMaxTime(0.)
+    , fLogMinTime(0.)
+    , fInvLogBinWidth(0.)
+    , fVerbose(0)
+    , fCheckTimeIsConsistentWithScheduler(true)
+{
+}
+
+//------------------------------------------------------------------------------
+
+G4MoleculeTimeSeriesCounter::~G4MoleculeTimeSeriesCounter() = default;
+
+//------------------------------------------------------------------------------
+
+G4MoleculeTimeSeriesCounter* G4MoleculeTimeSeriesCounter::Instance()
+{
+    return dynamic_cast<G4MoleculeTimeSeriesCounter*>(fpInstance);
+}
+
+//------------------------------------------------------------------------------
+
+void G4MoleculeTimeSeriesCounter::Initialize()
+{
+    auto mol_iterator = G4MoleculeTable::Instance()->GetConfigurationIterator();
+    while ((mol_iterator)())
+    {
+        if (IsRegistered(mol_iterator.value()->GetDefinition()) == false)
+        {
+            continue;
+        }
+
+        fSeries[mol_iterator.value()];
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void G4MoleculeTimeSeriesCounter::ResetCounter()
+{
+    if (fVerbose)
+    {
+        G4cout << " ---> G4MoleculeTimeSeriesCounter::ResetCounter" << G4endl;
+    }
+    fSeries.clear();
+}
+
+//------------------------------------------------------------------------------
+
+void G4MoleculeTimeSeriesCounter::DontRegister(const G4MoleculeDefinition* molDef)
+{
+    fDontRegister[molDef] = true;
+}
+
+//------------------------------------------------------------------------------
+
+bool G4MoleculeTimeSeriesCounter::IsRegistered(const G4MoleculeDefinition* molDef)
+{
+    return fDontRegister.find(molDef) == fDontRegister.end();
+}
+
+//------------------------------------------------------------------------------
+
+void G4MoleculeTimeSeriesCounter::RegisterAll()
+{
+    fDontRegister.clear();
+}
+
+//------------------------------------------------------------------------------
+
+void G4MoleculeTimeSeriesCounter::SetLogTimeBinning(G4double minTime,
+                                                    G4double maxTime,
+                                                    G4int nBinsPerDecade)
+{
+    if (minTime <= 0. || maxTime <= minTime || nBinsPerDecade < 1)
+    {
+        G4ExceptionDescription errMsg;
+        errMsg << "Invalid time binning: min time "
+               << G4BestUnit(minTime, "Time") << ", max time "
+               << G4BestUnit(maxTime, "Time") << ", " << nBinsPerDecade
+               << " bins per decade.";
+        G4Exception("G4MoleculeTimeSeriesCounter::SetLogTimeBinning",
+                    "TimeSeriesCounter001", FatalErrorInArgument, errMsg);
+        return;
+    }
+
+    if (GetNumberOfEntries() > 0)
+    {
+        G4Exception("G4MoleculeTimeSeriesCounter::SetLogTimeBinning",
+                    "TimeSeriesCounter002", FatalException,
+                    "The time binning must be set before recording molecules.");
+        return;
+    }
+
+    const G4double decades = G4Log(maxTime / minTime) / G4Log(10.);
+    G4int nBins = G4int(decades * nBinsPerDecade);
+    if (G4double(nBins) < decades * nBinsPerDecade)
+    {
+        ++nBins;
+    }
+
+    fNBins = nBins;
+    fMinTime = minTime;
+    fMaxTime = maxTime;
+    fLogMinTime = G4Log(minTime);
+    fInvLogBinWidth = nBinsPerDecade / G4Log(10.);
+    fSeries.clear();
+}
+
+//------------------------------------------------------------------------------
+
+G4double G4MoleculeTimeSeriesCounter::GetBinLowEdge(G4int bin) const
+{
+    if (bin <= 0)
+    {
+        return 0.;
+    }
+    if (bin > fNBins)
+    {
+        return fMaxTime;
+    }
+    return fMinTime * G4Exp(G4double(bin - 1) / fInvLogBinWidth);
+}
+
+//------------------------------------------------------------------------------
+
+G4int G4MoleculeTimeSeriesCounter::GetBin(G4double time) const
+{
+    if (time < fMinTime)
+    {
+        return 0;
+    }
+    if (time >= fMaxTime)
+    {
+        return fNBins + 1;
+    }
+
+    G4int bin = 1 + G4int((G4Log(time) - fLogMinTime) * fInvLogBinWidth);
+    bin = std::min(std::max(bin, 1), fNBins);
+
+    // Correct the rounding of the logarithm so that GetBin(GetBinLowEdge(b))
+    // returns b
+    if (bin > 1 && time < GetBinLowEdge(bin))
+    {
+        --bin;
+    }
+    else if (bin < fNBins && time >= GetBinLowEdge(bin + 1))
+    {
+        ++bin;
+    }
+    return bin;
+}
+
+//------------------------------------------------------------------------------
+
+G4int G4MoleculeTimeSeriesCounter::GetNumberInBin(const TimeSeries& series,
+                                                  G4int bin) const
+{
+    if (series.fLastBin < 0)
+    {
+        return 0;
+    }
+    if (bin > series.fLastBin)
+    {
+        return series.fCurrent;
+    }
+    return series.fNumbers[bin];
+}
+
+//------------------------------------------------------------------------------
+
+G4int G4MoleculeTimeSeriesCounter::GetNumberAtTime(const TimeSeries& series,
+                                                   G4double time) const
+{
+    if (IsBinned())
+    {
+        return GetNumberInBin(series, GetBin(time));
+    }
+
+    // Same rule as std::map::upper_bound with the time precision of
+    // G4MoleculeCounter
+    auto it = std::upper_bound(series.fTimes.begin(), series.fTimes.end(),
+                               time, G4::MoleculeCounter::TimePrecision());
+    if (it == series.fTimes.begin())
+    {
+        return 0;
+    }
+    return series.fNumbers[(it - series.fTimes.begin()) - 1];
+}
+
+//------------------------------------------------------------------------------
+
+int G4MoleculeTimeSeriesCounter::GetNMoleculesAtTime(Reactant* molecule,
+                                                     G4double time)
+{
+    auto it = fSeries.find(molecule);
+    if (it == fSeries.end())
+    {
+        return 0;
+    }
+    return GetNumberAtTime(it->second, time);
+}
+
+//------------------------------------------------------------------------------
+
+int G4MoleculeTimeSeriesCounter::GetCurrentNumberOf(Reactant* molecule)
+{
+    auto it = fSeries.find(molecule);
+    if (it == fSeries.end())
+    {
+        return 0;
+    }
+    return it->second.fCurrent;
+}
+
+//------------------------------------------------------------------------------
+
+void G4MoleculeTimeSeriesCounter::Record(Reactant* molecule,
+                                         G4double time,
+                                         G4int number,
+                                         const char* method)
+{
+    if (fDontRegister.find(molecule->GetDefinition()) != fDontRegister.end())
+    {
+        return;
+    }
+
+    if (fVerbose)
+    {
+        G4cout << method << " : " << molecule->GetName()
+               << " at time : " << G4BestUnit(time, "Time") << G4endl;
+    }
+
+    TimeSeries& series = fSeries[molecule];
+    G4int newNumber = series.fCurrent + number;
+
+    if (number < 0 && series.fLastBin < 0 && series.fTimes.empty())
+    {
+        G4String errMsg =
+            "You are trying to remove molecule " + molecule->GetName() +
+            " from the counter while this kind of molecules has not been registered yet";
+        G4Exception(method, "", FatalErrorInArgument, errMsg);
+        return;
+    }
+
+    if (newNumber < 0)
+    {
+        G4ExceptionDescription errMsg;
+        errMsg << "After removal of " << -number << " species of "
+               << molecule->GetName() << " the final number at time "
+               << G4BestUnit(time, "Time") << " is less than zero and so not valid.";
+        G4Exception(method, "N_INF_0", FatalException, errMsg);
+        return;
+    }
+
+    G4bool timeGoesBack = false;
+
+    if (IsBinned())
+    {
+        G4int bin = GetBin(time);
+        if (bin < series.fLastBin)
+        {
+            timeGoesBack = true;
+        }
+        else
+        {
+            if (series.fNumbers.empty())
+            {
+                series.fNumbers.assign(fNBins + 2, 0);
+            }
+            for (G4int b = series.fLastBin + 1; b < bin; ++b)
+            {
+                series.fNumbers[b] = series.fCurrent;
+            }
+            series.fNumbers[bin] = newNumber;
+            series.fLastBin = bin;
+        }
+    }
+    else if (series.fTimes.empty())
+    {
+        series.fTimes.push_back(time);
+        series.fNumbers.push_back(newNumber);
+    }
+    else
+    {
+        G4double lastTime = series.fTimes.back();
+        const G4double precision = G4::MoleculeCounter::TimePrecision::fPrecision;
+
+        if (time - lastTime < -precision)
+        {
+            timeGoesBack = true;
+        }
+        else if (std::fabs(time - lastTime) < precision)
+        {
+            // same time slice as the last record
+            series.fNumbers.back() = newNumber;
+        }
+        else
+        {
+            series.fTimes.push_back(time);
+            series.fNumbers.push_back(newNumber);
+        }
+    }
+
+    if (timeGoesBack)
+    {
+        G4ExceptionDescription errMsg;
+        errMsg << "Time of species " << molecule->GetName() << " is "
+               << G4BestUnit(time, "Time")
+               << " while molecules were already recorded at a later time.";
+        G4Exception(method, "TIME_DONT_MATCH", FatalException, errMsg);
+        return;
+    }
+
+    series.fCurrent = newNumber;
+}
+
+//------------------------------------------------------------------------------
+
+void G4MoleculeTimeSeriesCounter::AddAMoleculeAtTime(Reactant* molecule,
+                                                     G4double time,
+                                                     const G4ThreeVector* /*position*/,
+                                                     int number)
+{
+    Record(molecule, time, number,
+           "G4MoleculeTimeSeriesCounter::AddAMoleculeAtTime");
+}
+
+//------------------------------------------------------------------------------
+
+void G4MoleculeTimeSeriesCounter::RemoveAMoleculeAtTime(Reactant* molecule,
+                                                        G4double time,
+                                                        const G4ThreeVector* /*position*/,
+                                                        int number)
+{
+    if (fCheckTimeIsConsistentWithScheduler)
+    {
+        if (std::fabs(time - G4Scheduler::Instance()->GetGlobalTime()) >
+            G4Scheduler::Instance()->GetTimeTolerance())
+        {
+            G4ExceptionDescription errMsg;
+            errMsg << "Time of species "
+                   << molecule->GetName() << " is "
+                   << G4BestUnit(time, "Time") << " while "
+                   << " global time is "
+                   << G4BestUnit(G4Scheduler::Instance()->GetGlobalTime(), "Time")
+                   << G4endl;
+            G4Exception("G4MoleculeTimeSeriesCounter::RemoveAMoleculeAtTime",
+                        "TIME_DONT_MATCH",
+                        FatalException, errMsg);
+        }
+    }
+
+    Record(molecule, time, -number,
+           "G4MoleculeTimeSeriesCounter::RemoveAMoleculeAtTime");
+}
+
+//------------------------------------------------------------------------------
+
+G4MoleculeTimeSeriesCounter::RecordedMolecules
+G4MoleculeTimeSeriesCounter::GetRecordedMolecules()
+{
+    RecordedMolecules output(new ReactantList());
+    for (const auto& it : fSeries)
+    {
+        output->push_back(it.first);
+    }
+    return output;
+}
+
+//------------------------------------------------------------------------------
+
+G4MoleculeTimeSeriesCounter::RecordedTimes
+G4MoleculeTimeSeriesCounter::GetRecordedTimes()
+{
+    RecordedTimes output(new std::set<G4double>);
+
+    for (const auto& it : fSeries)
+    {
+        const TimeSeries& series = it.second;
+        if (IsBinned())
+        {
+            for (G4int b = 0; b <= series.fLastBin; ++b)
+            {
+                output->insert(GetBinLowEdge(b));
+            }
+        }
+        else
+        {
+            output->insert(series.fTimes.begin(), series.fTimes.end());
+        }
+    }
+    return output;
+}
+
+//------------------------------------------------------------------------------
+
+void G4MoleculeTimeSeriesCounter::Compact()
+{
+    if (IsBinned())
+    {
+        return;
+    }
+
+    for (auto& it : fSeries)
+    {
+        TimeSeries& series = it.second;
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < series.fTimes.size(); ++i)
+        {
+            if (kept > 0 && series.fNumbers[i] == series.fNumbers[kept - 1])
+            {
+                continue;
+            }
+            series.fTimes[kept] = series.fTimes[i];
+            series.fNumbers[kept] = series.fNumbers[i];
+            ++kept;
+        }
+        series.fTimes.resize(kept);
+        series.fNumbers.resize(kept);
+        series.fTimes.shrink_to_fit();
+        series.fNumbers.shrink_to_fit();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void G4MoleculeTimeSeriesCounter::Merge(const G4MoleculeTimeSeriesCounter& other)
+{
+    if (&other == this)
+    {
+        return;
+    }
+
+    G4AutoLock l(&mergeMutex);
+
+    if (fNBins != other.fNBins
+        || (IsBinned() && (fMinTime != other.fMinTime
+                           || fMaxTime != other.fMaxTime
+                           || fInvLogBinWidth != other.fInvLogBinWidth)))
+    {
+        G4Exception("G4MoleculeTimeSeriesCounter::Merge",
+                    "TimeSeriesCounter003", FatalErrorInArgument,
+                    "Only counters with the same time binning can be merged.");
+        return;
+    }
+
+    for (const auto& it : other.fSeries)
+    {
+        const TimeSeries& otherSeries = it.second;
+        TimeSeries& series = fSeries[it.first];
+
+        if (IsBinned())
+        {
+            G4int lastBin = std::max(series.fLastBin, otherSeries.fLastBin);
+            if (lastBin >= 0 && series.fNumbers.empty())
+            {
+                series.fNumbers.assign(fNBins + 2, 0);
+            }
+            for (G4int b = 0; b <= lastBin; ++b)
+            {
+                series.fNumbers[b] = GetNumberInBin(series, b)
+                                     + GetNumberInBin(otherSeries, b);
+            }
+            series.fLastBin = lastBin;
+        }
+        else
+        {
+            std::vector<G4double> times;
+            times.reserve(series.fTimes.size() + otherSeries.fTimes.size());
+            std::set_union(series.fTimes.begin(), series.fTimes.end(),
+                           otherSeries.fTimes.begin(), otherSeries.fTimes.end(),
+                           std::back_inserter(times),
+                           G4::MoleculeCounter::TimePrecision());
+
+            std::vector<G4int> numbers(times.size());
+            for (std::size_t i = 0; i < times.size(); ++i)
+            {
+                numbers[i] = GetNumberAtTime(series, times[i])
+                             + GetNumberAtTime(otherSeries, times[i]);
+            }
+            series.fTimes.swap(times);
+            series.fNumbers.swap(numbers);
+        }
+        series.fCurrent += otherSeries.fCurrent;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t G4MoleculeTimeSeriesCounter::GetNumberOfEntries() const
+{
+    std::size_t n = 0;
+    for (const auto& it : fSeries)
+    {
+        n += IsBinned() ? std::size_t(it.second.fLastBin + 1)
+                        : it.second.fTimes.size();
+    }
+    return n;
+}
+
+//------------------------------------------------------------------------------
+
+void G4MoleculeTimeSeriesCounter::Dump()
+{
+    for (const auto& it : fSeries)
+    {
+        G4cout << " --- > For " << it.first->GetName() << G4endl;
+
+        const TimeSeries& series = it.second;
+        if (IsBinned())
+        {
+            for (G4int b = 0; b <= series.fLastBin; ++b)
+            {
+                G4cout << " " << G4BestUnit(GetBinLowEdge(b), "Time")
+                       << "    " << series.fNumbers[b] << G4endl;
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < series.fTimes.size(); ++i)
+            {
+                G4cout << " " << G4BestUnit(series.fTimes[i], "Time")
+                       << "    " << series.fNumbers[i] << G4endl;
+            }
+        }
+    }
+}
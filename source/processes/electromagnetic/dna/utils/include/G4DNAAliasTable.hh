@@ -0,0 +1,84 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4DNAAliasTable
+//
+// Walker alias table for the sampling of a discrete distribution in
+// constant time. The table is built once from a set of non-negative
+// weights; Sample() then returns index i with probability
+// weight[i] / sum(weights) using a single uniform random number.
+//
+// Used by the G4DNA models to sample the ionisation shell, the
+// excitation level and the energy-transfer interval of the secondary
+// electron from tables precomputed at initialisation.
+
+#ifndef G4DNAAliasTable_hh
+#define G4DNAAliasTable_hh 1
+
+#include "globals.hh"
+#include <vector>
+
+class G4DNAAliasTable
+{
+ public:
+  G4DNAAliasTable() = default;
+  ~G4DNAAliasTable() = default;
+
+  // Builds the table from the given weights. Returns false, leaving the
+  // table empty, if there is no strictly positive weight.
+  G4bool Build(const std::vector<G4double>& weights);
+
+  void Clear();
+
+  // Returns an index in [0, GetSize()) for the uniform random number
+  // u in [0, 1). Must not be called on an empty table.
+  inline std::size_t Sample(G4double u) const;
+
+  // Probability of index i reconstructed from the alias structure,
+  // in O(GetSize()); meant for the validation of the tables
+  G4double GetProbability(std::size_t i) const;
+
+  G4bool IsEmpty() const { return fProbability.empty(); }
+  std::size_t GetSize() const { return fProbability.size(); }
+  G4double GetTotalWeight() const { return fTotalWeight; }
+
+ private:
+  std::vector<G4double> fProbability;
+  std::vector<std::size_t> fAlias;
+  G4double fTotalWeight = 0.;
+};
+
+inline std::size_t G4DNAAliasTable::Sample(G4double u) const
+{
+  const std::size_t n = fProbability.size();
+  G4double x = u * G4double(G4int(n));
+  auto i = static_cast<std::size_t>(G4int(x));
+  if(i >= n) i = n - 1;
+  return (x - G4double(G4int(i)) < fProbability[i]) ? i : fAlias[i];
+}
+
+#endif
@@ -0,0 +1,109 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4DNAEnergyTransferSampler
+//
+// Precomputed sampling tables for the energy transferred to the
+// secondary electron in one ionisation shell. For each incident energy
+// tabulated in the differential cross section data, the density of
+// energy transfers is taken as piecewise linear between the tabulated
+// transfers, truncated to [minTransfer, maxTransfer(T)]; the intervals
+// are selected with a Walker alias table and the transfer is then
+// obtained by inverting the linear density analytically. Between two
+// incident energies the node is chosen with a probability linear in
+// log(T) (statistical interpolation), so that one sampling costs a
+// binary search on the incident energy grid plus three random numbers,
+// instead of a rejection loop on the interpolated cross section.
+//
+// All energies are expressed in the units of the data tables.
+
+#ifndef G4DNAEnergyTransferSampler_hh
+#define G4DNAEnergyTransferSampler_hh 1
+
+#include "G4DNAAliasTable.hh"
+
+#include <functional>
+#include <map>
+#include <vector>
+
+class G4DNAEnergyTransferSampler
+{
+ public:
+  // Incident energy -> (energy transfer -> differential cross section)
+  using TriDimensionMap = std::map<G4double, std::map<G4double, G4double> >;
+  using MaxTransferFunction = std::function<G4double(G4double)>;
+  using DcsFunction = std::function<G4double(G4double, G4double)>;
+
+  G4DNAEnergyTransferSampler() = default;
+  ~G4DNAEnergyTransferSampler() = default;
+
+  // Builds one node per incident energy of dcs. Incident energies for
+  // which no transfer is allowed are skipped.
+  void Build(const TriDimensionMap& dcs, G4double minTransfer,
+             const MaxTransferFunction& maxTransfer);
+
+  void Clear();
+
+  // Samples an energy transfer for the incident energy k, not larger
+  // than maxTransfer. Returns a negative value if k is below the first
+  // node, in which case the caller must use its own sampling.
+  G4double Sample(G4double k, G4double maxTransfer) const;
+
+  // Cumulative distribution used by Sample() at incident energy k
+  G4double GetCDF(G4double k, G4double transfer, G4double maxTransfer) const;
+
+  // Returns the largest difference between the cumulative distribution
+  // sampled from the tables and the one integrated from dcs(k, transfer),
+  // at the geometric mean of each pair of consecutive nodes
+  G4double Validate(const DcsFunction& dcs, G4double minTransfer,
+                    const MaxTransferFunction& maxTransfer) const;
+
+  G4bool IsEmpty() const { return fNodes.empty(); }
+  std::size_t GetNumberOfNodes() const { return fNodes.size(); }
+
+ private:
+  struct Node
+  {
+    G4double fEnergy = 0.;
+    G4double fLogEnergy = 0.;
+    std::vector<G4double> fTransfers;
+    std::vector<G4double> fValues;
+    std::vector<G4double> fCumulated;
+    G4DNAAliasTable fTable;
+  };
+
+  // Index of the lower node and probability of the upper one at k
+  std::size_t Locate(G4double k, G4double& weight) const;
+
+  static G4double SampleNode(const Node& node);
+  static G4double GetNodeCDF(const Node& node, G4double transfer);
+
+  std::vector<G4double> fEnergies;
+  std::vector<Node> fNodes;
+};
+
+#endif
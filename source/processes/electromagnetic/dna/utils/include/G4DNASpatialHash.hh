@@ -0,0 +1,105 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// G4DNASpatialHash
+//
+// Flat open-addressing hash of cubic cells, each holding the tracks
+// binned into it. Cells are addressed by their integer (i, j, k) index
+// on a grid of nx * ny * nz cells chosen by the caller; empty cells are
+// never stored. Tracks are kept in insertion order within a cell so that
+// neighbour loops visit them in a reproducible sequence. The storage of
+// the cells is kept between Reset() calls to avoid re-allocations from
+// one chemistry step to the next.
+//
+// Used by G4DNAIRT and G4DNAIRT_geometries for the search of reaction partners within the
+// cut-off radius; it can be reused by any reaction model binning tracks
+// on a regular grid.
+
+#ifndef G4DNASpatialHash_hh
+#define G4DNASpatialHash_hh 1
+
+#include "globals.hh"
+#include <cstdint>
+#include <vector>
+
+class G4Track;
+
+class G4DNASpatialHash
+{
+ public:
+  using Cell = std::vector<G4Track*>;
+
+  G4DNASpatialHash() = default;
+  ~G4DNASpatialHash() = default;
+
+  // Removes all entries and sets the number of cells along x and y used
+  // to build the linear cell keys. Allocated cell storage is recycled.
+  void Reset(G4int nx, G4int ny);
+
+  // Appends the track to cell (i, j, k), creating the cell if needed
+  void Insert(G4int i, G4int j, G4int k, G4Track* track);
+
+  // Returns the content of cell (i, j, k), nullptr if it is empty.
+  // The pointer is invalidated by the next call to Insert().
+  const Cell* Find(G4int i, G4int j, G4int k) const;
+
+  std::size_t GetNumberOfCells() const { return fNCells; }
+  std::size_t GetNumberOfEntries() const { return fNEntries; }
+
+ private:
+  static constexpr std::size_t fEmpty = static_cast<std::size_t>(-1);
+
+  std::uint64_t GetKey(G4int i, G4int j, G4int k) const
+  {
+    return static_cast<std::uint64_t>(i)
+           + fNx * (static_cast<std::uint64_t>(j)
+                    + fNy * static_cast<std::uint64_t>(k));
+  }
+
+  std::size_t GetSlot(std::uint64_t key) const
+  {
+    // Fibonacci hashing on the linear cell index
+    return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> fShift);
+  }
+
+  void Grow();
+
+  std::uint64_t fNx = 1;
+  std::uint64_t fNy = 1;
+
+  // Open-addressing table: key and position of the cell in fCells
+  std::vector<std::uint64_t> fKeys;
+  std::vector<std::size_t> fSlots;
+  unsigned int fShift = 64;
+
+  std::vector<Cell> fCells;
+  std::size_t fNCells = 0;
+  std::size_t fNEntries = 0;
+};
+
+#endif
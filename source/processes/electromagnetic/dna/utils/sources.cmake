@@ -33,6 +33,9 @@ geant4_add_module(G4emdna-utils
 	G4VChemistryWorld.hh
 	G4DNAMesh.hh
 	G4DNAEventSet.hh
+	G4DNASpatialHash.hh
+	G4DNAAliasTable.hh
+	G4DNAEnergyTransferSampler.hh
   SOURCES
     G4DNAChemistryManager.cc
     G4DNACPA100LogLogInterpolation.cc
@@ -61,7 +64,10 @@ geant4_add_module(G4emdna-utils
 	G4IRTUtils.cc
 	G4DNAScavengerMaterial.cc
 	G4DNAMesh.cc
-	G4DNAEventSet.cc)
+	G4DNAEventSet.cc
+	G4DNASpatialHash.cc
+	G4DNAAliasTable.cc
+	G4DNAEnergyTransferSampler.cc)
 
 geant4_module_link_libraries(G4emdna-utils
   PUBLIC
@@ -0,0 +1,111 @@
+#include "CommonHeader.h"
+
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+// G4DNAAliasTable implementation
+// --------------------------------------------------------------------
+
+#include "G4DNAAliasTable.hh"
+
+G4bool G4DNAAliasTable::Build(const std::vector<G4double>& weights)
+{
+  Clear();
+
+  const std::size_t n = weights.size();
+  G4double total = 0.;
+  for(const auto& w : weights)
+  {
+    if(w > 0.) total += w;
+  }
+  if(n == 0 || !(total > 0.)) return false;
+
+  fProbability.resize(n);
+  fAlias.resize(n);
+  fTotalWeight = total;
+
+  // Vose's variant: scaled weights are split between the "small" (< 1)
+  // and "large" (>= 1) work lists, each small bin is topped up by a
+  // large one which becomes its alias
+  std::vector<G4double> scaled(n);
+  std::vector<std::size_t> small;
+  std::vector<std::size_t> large;
+  small.reserve(n);
+  large.reserve(n);
+
+  const G4double norm = G4double(G4int(n)) / total;
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    scaled[i] = (weights[i] > 0.) ? weights[i] * norm : G4double(0.);
+    fAlias[i] = i;
+    if(scaled[i] < 1.) small.push_back(i);
+    else large.push_back(i);
+  }
+
+  while(!small.empty() && !large.empty())
+  {
+    std::size_t s = small.back();
+    small.pop_back();
+    std::size_t l = large.back();
+
+    fProbability[s] = scaled[s];
+    fAlias[s] = l;
+
+    scaled[l] = (scaled[l] + scaled[s]) - 1.;
+    if(scaled[l] < 1.)
+    {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+
+  // Remaining bins are full up to round-off
+  for(auto l : large) fProbability[l] = 1.;
+  for(auto s : small) fProbability[s] = 1.;
+
+  return true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4DNAAliasTable::GetProbability(std::size_t i) const
+{
+  const std::size_t n = fProbability.size();
+  if(i >= n) return 0.;
+
+  G4double p = fProbability[i];
+  for(std::size_t j = 0; j < n; ++j)
+  {
+    if(j != i && fAlias[j] == i) p += 1. - fProbability[j];
+  }
+  return p / G4double(G4int(n));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4DNAAliasTable::Clear()
+{
+  fProbability.clear();
+  fAlias.clear();
+  fTotalWeight = 0.;
+}
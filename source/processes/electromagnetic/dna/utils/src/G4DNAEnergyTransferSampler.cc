@@ -0,0 +1,283 @@
+#include "CommonHeader.h"
+
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+// G4DNAEnergyTransferSampler implementation
+// --------------------------------------------------------------------
+
+#include "G4DNAEnergyTransferSampler.hh"
+
+#include "G4Log.hh"
+#include "Randomize.hh"
+
+#include <algorithm>
+
+namespace
+{
+  // Maximum number of draws above the kinematic limit before clamping
+  constexpr G4int kMaxAttempts = 100;
+
+  // Number of sub-intervals per tabulated interval in Validate()
+  constexpr G4int kValidationSubdivisions = 4;
+
+  G4double LinearValue(G4double x1, G4double x2, G4double y1, G4double y2,
+                       G4double x)
+  {
+    if(x2 == x1) return y1;
+    return y1 + (y2 - y1) * (x - x1) / (x2 - x1);
+  }
+}
+
+void G4DNAEnergyTransferSampler::Build(const TriDimensionMap& dcs,
+                                       G4double minTransfer,
+                                       const MaxTransferFunction& maxTransfer)
+{
+  Clear();
+
+  for(const auto& incident : dcs)
+  {
+    const G4double energy = incident.first;
+    const auto& transfers = incident.second;
+    if(!(energy > 0.) || transfers.size() < 2) continue;
+
+    const G4double upper = maxTransfer(energy);
+    if(!(upper > minTransfer)) continue;
+
+    Node node;
+    node.fEnergy = energy;
+    node.fLogEnergy = G4Log(energy);
+
+    // Tabulated points inside the kinematic range, with the density
+    // interpolated at both bounds
+    auto previous = transfers.cbegin();
+    for(auto it = transfers.cbegin(); it != transfers.cend(); ++it)
+    {
+      const G4double x = it->first;
+      if(x <= minTransfer)
+      {
+        previous = it;
+        continue;
+      }
+      if(node.fTransfers.empty())
+      {
+        node.fTransfers.push_back(minTransfer);
+        node.fValues.push_back(
+          (previous->first <= minTransfer)
+            ? LinearValue(previous->first, x, previous->second, it->second,
+                          minTransfer)
+            : it->second);
+      }
+      if(x >= upper)
+      {
+        node.fTransfers.push_back(upper);
+        node.fValues.push_back(
+          LinearValue(previous->first, x, previous->second, it->second, upper));
+        break;
+      }
+      node.fTransfers.push_back(x);
+      node.fValues.push_back(it->second);
+      previous = it;
+    }
+
+    const std::size_t nPoints = node.fTransfers.size();
+    if(nPoints < 2) continue;
+
+    std::vector<G4double> areas(nPoints - 1);
+    node.fCumulated.assign(nPoints, 0.);
+    for(std::size_t j = 0; j + 1 < nPoints; ++j)
+    {
+      if(node.fValues[j] < 0.) node.fValues[j] = 0.;
+      if(node.fValues[j + 1] < 0.) node.fValues[j + 1] = 0.;
+      areas[j] = 0.5 * (node.fValues[j] + node.fValues[j + 1])
+                 * (node.fTransfers[j + 1] - node.fTransfers[j]);
+      node.fCumulated[j + 1] = node.fCumulated[j] + areas[j];
+    }
+
+    if(!node.fTable.Build(areas)) continue;
+
+    fEnergies.push_back(energy);
+    fNodes.push_back(std::move(node));
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4DNAEnergyTransferSampler::Clear()
+{
+  fEnergies.clear();
+  fNodes.clear();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+std::size_t G4DNAEnergyTransferSampler::Locate(G4double k,
+                                               G4double& weight) const
+{
+  weight = 0.;
+  const std::size_t n = fEnergies.size();
+  if(n == 1 || k <= fEnergies.front()) return 0;
+  if(k >= fEnergies.back()) return n - 1;
+
+  auto up = std::upper_bound(fEnergies.cbegin(), fEnergies.cend(), k);
+  auto i = static_cast<std::size_t>(up - fEnergies.cbegin()) - 1;
+  weight = (G4Log(k) - fNodes[i].fLogEnergy)
+           / (fNodes[i + 1].fLogEnergy - fNodes[i].fLogEnergy);
+  return i;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4DNAEnergyTransferSampler::SampleNode(const Node& node)
+{
+  const std::size_t j = node.fTable.Sample(G4UniformRand());
+  const G4double a = node.fTransfers[j];
+  const G4double b = node.fTransfers[j + 1];
+  const G4double fa = node.fValues[j];
+  const G4double fb = node.fValues[j + 1];
+  const G4double u = G4UniformRand();
+
+  // Inversion of the linear density on [a, b]
+  const G4double df = fb - fa;
+  if(df == 0. || (df > 0. ? df : -df) < 1.e-9 * (fa + fb))
+  {
+    return a + u * (b - a);
+  }
+  const G4double root = std::sqrt(fa * fa + u * (fb * fb - fa * fa));
+  return a + (b - a) * (root - fa) / df;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4DNAEnergyTransferSampler::Sample(G4double k,
+                                            G4double maxTransfer) const
+{
+  if(fNodes.empty() || k < fEnergies.front()) return -1.;
+
+  G4double weight = 0.;
+  const std::size_t i = Locate(k, weight);
+
+  G4double transfer = 0.;
+  for(G4int attempt = 0; attempt < kMaxAttempts; ++attempt)
+  {
+    const std::size_t n = (weight > 0. && G4UniformRand() < weight) ? i + 1 : i;
+    transfer = SampleNode(fNodes[n]);
+    if(transfer <= maxTransfer) return transfer;
+  }
+  return maxTransfer;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4DNAEnergyTransferSampler::GetNodeCDF(const Node& node,
+                                                G4double transfer)
+{
+  const auto& x = node.fTransfers;
+  const G4double total = node.fCumulated.back();
+  if(transfer <= x.front()) return 0.;
+  if(transfer >= x.back()) return 1.;
+
+  auto up = std::upper_bound(x.cbegin(), x.cend(), transfer);
+  auto j = static_cast<std::size_t>(up - x.cbegin()) - 1;
+  const G4double f = LinearValue(x[j], x[j + 1], node.fValues[j],
+                                 node.fValues[j + 1], transfer);
+  return (node.fCumulated[j]
+          + 0.5 * (node.fValues[j] + f) * (transfer - x[j])) / total;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4DNAEnergyTransferSampler::GetCDF(G4double k, G4double transfer,
+                                            G4double maxTransfer) const
+{
+  if(fNodes.empty() || k < fEnergies.front()) return 0.;
+
+  G4double weight = 0.;
+  const std::size_t i = Locate(k, weight);
+  const std::size_t j = (weight > 0.) ? i + 1 : i;
+
+  const G4double x = std::min(transfer, maxTransfer);
+  G4double value = (1. - weight) * GetNodeCDF(fNodes[i], x)
+                   + weight * GetNodeCDF(fNodes[j], x);
+  G4double norm = (1. - weight) * GetNodeCDF(fNodes[i], maxTransfer)
+                  + weight * GetNodeCDF(fNodes[j], maxTransfer);
+  return (norm > 0.) ? value / norm : G4double(0.);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4DNAEnergyTransferSampler::Validate(
+  const DcsFunction& dcs, G4double minTransfer,
+  const MaxTransferFunction& maxTransfer) const
+{
+  G4double maxDifference = 0.;
+
+  for(std::size_t i = 0; i + 1 < fNodes.size(); ++i)
+  {
+    const G4double k = std::sqrt(fNodes[i].fEnergy * fNodes[i + 1].fEnergy);
+    const G4double upper = maxTransfer(k);
+    if(!(upper > minTransfer)) continue;
+
+    // Reference grid: tabulated transfers of both nodes, refined
+    std::vector<G4double> knots(fNodes[i].fTransfers);
+    knots.insert(knots.end(), fNodes[i + 1].fTransfers.cbegin(),
+                 fNodes[i + 1].fTransfers.cend());
+    knots.push_back(minTransfer);
+    knots.push_back(upper);
+    std::sort(knots.begin(), knots.end());
+
+    std::vector<G4double> grid;
+    for(std::size_t j = 0; j + 1 < knots.size(); ++j)
+    {
+      if(knots[j] < minTransfer || knots[j + 1] > upper
+         || !(knots[j + 1] > knots[j]))
+        continue;
+      for(G4int s = 0; s < kValidationSubdivisions; ++s)
+      {
+        grid.push_back(knots[j] + (knots[j + 1] - knots[j]) * G4double(s)
+                                    / G4double(kValidationSubdivisions));
+      }
+    }
+    grid.push_back(upper);
+
+    std::vector<G4double> cumulated(grid.size(), 0.);
+    G4double previous = dcs(k, grid[0]);
+    for(std::size_t j = 1; j < grid.size(); ++j)
+    {
+      G4double current = dcs(k, grid[j]);
+      cumulated[j] = cumulated[j - 1]
+                     + 0.5 * (previous + current) * (grid[j] - grid[j - 1]);
+      previous = current;
+    }
+    const G4double total = cumulated.back();
+    if(!(total > 0.)) continue;
+
+    for(std::size_t j = 0; j < grid.size(); ++j)
+    {
+      G4double difference = cumulated[j] / total - GetCDF(k, grid[j], upper);
+      if(difference < 0.) difference = -difference;
+      if(difference > maxDifference) maxDifference = difference;
+    }
+  }
+  return maxDifference;
+}
@@ -0,0 +1,152 @@
+#include "CommonHeader.h"
+
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// G4DNASpatialHash implementation
+// --------------------------------------------------------------------
+
+#include "G4DNASpatialHash.hh"
+
+#include <algorithm>
+
+namespace
+{
+  constexpr std::size_t kInitialSlots = 64;
+}
+
+void G4DNASpatialHash::Reset(G4int nx, G4int ny)
+{
+  fNx = static_cast<std::uint64_t>(std::max(nx, 1));
+  fNy = static_cast<std::uint64_t>(std::max(ny, 1));
+
+  if(fKeys.empty())
+  {
+    fKeys.assign(kInitialSlots, 0);
+    fSlots.assign(kInitialSlots, fEmpty);
+    fShift = 64 - 6;
+  }
+  else
+  {
+    std::fill(fSlots.begin(), fSlots.end(), fEmpty);
+  }
+
+  for(std::size_t c = 0; c < fNCells; ++c)
+  {
+    fCells[c].clear();
+  }
+  fNCells   = 0;
+  fNEntries = 0;
+}
+
+void G4DNASpatialHash::Insert(G4int i, G4int j, G4int k, G4Track* track)
+{
+  if(fKeys.empty())
+  {
+    Reset(static_cast<G4int>(fNx), static_cast<G4int>(fNy));
+  }
+
+  const std::uint64_t key = GetKey(i, j, k);
+  const std::size_t mask  = fKeys.size() - 1;
+  std::size_t slot        = GetSlot(key);
+
+  while(fSlots[slot] != fEmpty)
+  {
+    if(fKeys[slot] == key)
+    {
+      fCells[fSlots[slot]].push_back(track);
+      ++fNEntries;
+      return;
+    }
+    slot = (slot + 1) & mask;
+  }
+
+  if(fNCells == fCells.size())
+  {
+    fCells.emplace_back();
+  }
+  fKeys[slot]  = key;
+  fSlots[slot] = fNCells;
+  fCells[fNCells].push_back(track);
+  ++fNCells;
+  ++fNEntries;
+
+  // keep the load factor below one half
+  if(2 * fNCells > fKeys.size())
+  {
+    Grow();
+  }
+}
+
+const G4DNASpatialHash::Cell* G4DNASpatialHash::Find(G4int i, G4int j,
+                                                     G4int k) const
+{
+  if(fNCells == 0)
+  {
+    return nullptr;
+  }
+
+  const std::uint64_t key = GetKey(i, j, k);
+  const std::size_t mask  = fKeys.size() - 1;
+  std::size_t slot        = GetSlot(key);
+
+  while(fSlots[slot] != fEmpty)
+  {
+    if(fKeys[slot] == key)
+    {
+      return &fCells[fSlots[slot]];
+    }
+    slot = (slot + 1) & mask;
+  }
+  return nullptr;
+}
+
+void G4DNASpatialHash::Grow()
+{
+  std::vector<std::uint64_t> oldKeys;
+  std::vector<std::size_t> oldSlots;
+  oldKeys.swap(fKeys);
+  oldSlots.swap(fSlots);
+
+  const std::size_t size = 2 * oldKeys.size();
+  fKeys.assign(size, 0);
+  fSlots.assign(size, fEmpty);
+  --fShift;
+
+  const std::size_t mask = size - 1;
+  for(std::size_t s = 0; s < oldKeys.size(); ++s)
+  {
+    if(oldSlots[s] == fEmpty)
+    {
+      continue;
+    }
+    std::size_t slot = GetSlot(oldKeys[s]);
+    while(fSlots[slot] != fEmpty)
+    {
+      slot = (slot + 1) & mask;
+    }
+    fKeys[slot]  = oldKeys[s];
+    fSlots[slot] = oldSlots[s];
+  }
+}
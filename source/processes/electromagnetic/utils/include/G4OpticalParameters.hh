@@ -134,6 +134,8 @@ class G4OpticalParameters
   G4bool GetCerenkovTrackSecondariesFirst() const;
   void   SetCerenkovStackPhotons(G4bool);
   G4bool GetCerenkovStackPhotons() const;
+  void   SetCerenkovStoreGenSteps(G4bool);
+  G4bool GetCerenkovStoreGenSteps() const;
 
   // Scintillation
   void   SetScintByParticleType(G4bool);
@@ -146,6 +148,8 @@ class G4OpticalParameters
   G4bool GetScintFiniteRiseTime() const;
   void   SetScintStackPhotons(G4bool);
   G4bool GetScintStackPhotons() const;
+  void   SetScintStoreGenSteps(G4bool);
+  G4bool GetScintStoreGenSteps() const;
   void   SetScintVerboseLevel(G4int);
   G4int  GetScintVerboseLevel() const;
   void   SetScintEnhancedTimeConstants(G4bool);
@@ -199,6 +203,10 @@ class G4OpticalParameters
 
   // cerenkov/////////////////
   G4bool cerenkovStackPhotons;
+
+  /// option to record compact photon generation steps in
+  /// G4OpticalPhotonGenStepStore instead of producing the photons
+  G4bool cerenkovStoreGenSteps;
   G4bool cerenkovTrackSecondariesFirst;
   G4int cerenkovVerboseLevel;
   G4int cerenkovMaxPhotons;
@@ -223,6 +231,10 @@ class G4OpticalParameters
   /// option to allow stacking of secondary Scintillation photons
   G4bool scintStackPhotons;
 
+  /// option to record compact photon generation steps in
+  /// G4OpticalPhotonGenStepStore instead of producing the photons
+  G4bool scintStoreGenSteps;
+
   G4int scintVerboseLevel;
   G4bool scintTrackSecondariesFirst;
 
@@ -109,6 +109,9 @@ class G4OpticalParametersMessenger : public G4UImessenger
   /// setStackPhotons command
   G4UIcmdWithABool* fCerenkovStackPhotonsCmd;
 
+  /// setStoreGenSteps command
+  G4UIcmdWithABool* fCerenkovStoreGenStepsCmd;
+
   G4UIcmdWithABool* fCerenkovTrackSecondariesFirstCmd;
   G4UIcmdWithAnInteger* fCerenkovVerboseLevelCmd;
 
@@ -123,6 +126,9 @@ class G4OpticalParametersMessenger : public G4UImessenger
   /// setStackPhotons command
   G4UIcmdWithABool* fScintStackPhotonsCmd;
 
+  /// setStoreGenSteps command
+  G4UIcmdWithABool* fScintStoreGenStepsCmd;
+
   G4UIcmdWithABool* fScintTrackSecondariesFirstCmd;
 
   /// setFiniteRiseTime command
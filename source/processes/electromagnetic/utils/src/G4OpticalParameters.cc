@@ -104,6 +104,7 @@ void G4OpticalParameters::Initialise()
   verboseLevel = 0;
 
   cerenkovStackPhotons          = true;
+  cerenkovStoreGenSteps         = false;
   cerenkovTrackSecondariesFirst = true;
   cerenkovVerboseLevel          = 0;
   cerenkovMaxPhotons            = 100;
@@ -112,6 +113,7 @@ void G4OpticalParameters::Initialise()
   scintByParticleType        = false;
   scintTrackInfo             = false;
   scintStackPhotons          = true;
+  scintStoreGenSteps         = false;
   scintFiniteRiseTime        = false;
   scintTrackSecondariesFirst = true;
   scintVerboseLevel          = 0;
@@ -209,6 +211,20 @@ G4bool G4OpticalParameters::GetCerenkovStackPhotons() const
   return cerenkovStackPhotons;
 }
 
+void G4OpticalParameters::SetCerenkovStoreGenSteps(G4bool val)
+{
+  if(IsLocked())
+  {
+    return;
+  }
+  cerenkovStoreGenSteps = val;
+}
+
+G4bool G4OpticalParameters::GetCerenkovStoreGenSteps() const
+{
+  return cerenkovStoreGenSteps;
+}
+
 void G4OpticalParameters::SetCerenkovVerboseLevel(G4int val)
 {
   if(IsLocked())
@@ -332,6 +348,20 @@ G4bool G4OpticalParameters::GetScintStackPhotons() const
   return scintStackPhotons;
 }
 
+void G4OpticalParameters::SetScintStoreGenSteps(G4bool val)
+{
+  if(IsLocked())
+  {
+    return;
+  }
+  scintStoreGenSteps = val;
+}
+
+G4bool G4OpticalParameters::GetScintStoreGenSteps() const
+{
+  return scintStoreGenSteps;
+}
+
 void G4OpticalParameters::SetScintVerboseLevel(G4int val)
 {
   if(IsLocked())
@@ -500,6 +530,8 @@ void G4OpticalParameters::StreamInfo(std::ostream& os) const
      << "\n";
   os << " Cerenkov track secondaries first:      "
      << cerenkovTrackSecondariesFirst << "\n";
+  os << " Cerenkov store generation steps:       " << cerenkovStoreGenSteps
+     << "\n";
   os << " Scintillation process active:          "
      << GetProcessActivation("Scintillation") << "\n";
   os << " Scintillation finite rise time:        " << scintFiniteRiseTime
@@ -510,6 +542,8 @@ void G4OpticalParameters::StreamInfo(std::ostream& os) const
   os << " Scintillation stack photons:           " << scintStackPhotons << "\n";
   os << " Scintillation track secondaries first: " << scintTrackSecondariesFirst
      << "\n";
+  os << " Scintillation store generation steps:  " << scintStoreGenSteps
+     << "\n";
   os << " WLS process active:                    "
      << GetProcessActivation("OpWLS") << "\n";
   os << " WLS time profile name:                 " << wlsTimeProfileName
@@ -136,6 +136,16 @@ G4OpticalParametersMessenger::G4OpticalParametersMessenger(
     "Set whether or not to stack secondary Cerenkov photons");
   fCerenkovStackPhotonsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
 
+  fCerenkovStoreGenStepsCmd =
+    new G4UIcmdWithABool("/process/optical/cerenkov/setStoreGenSteps", this);
+  fCerenkovStoreGenStepsCmd->SetGuidance(
+    "Set whether to record Cerenkov photon generation steps");
+  fCerenkovStoreGenStepsCmd->SetGuidance(
+    "in G4OpticalPhotonGenStepStore instead of producing the photons.");
+  fCerenkovStoreGenStepsCmd->SetParameterName("CerenkovStoreGenSteps", true);
+  fCerenkovStoreGenStepsCmd->SetDefaultValue(true);
+  fCerenkovStoreGenStepsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
   fCerenkovTrackSecondariesFirstCmd = new G4UIcmdWithABool(
     "/process/optical/cerenkov/setTrackSecondariesFirst", this);
   fCerenkovTrackSecondariesFirstCmd->SetGuidance(
@@ -186,6 +196,16 @@ G4OpticalParametersMessenger::G4OpticalParametersMessenger(
   fScintStackPhotonsCmd->SetDefaultValue(true);
   fScintStackPhotonsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
 
+  fScintStoreGenStepsCmd = new G4UIcmdWithABool(
+    "/process/optical/scintillation/setStoreGenSteps", this);
+  fScintStoreGenStepsCmd->SetGuidance(
+    "Set whether to record scintillation photon generation steps");
+  fScintStoreGenStepsCmd->SetGuidance(
+    "in G4OpticalPhotonGenStepStore instead of producing the photons.");
+  fScintStoreGenStepsCmd->SetParameterName("ScintillationStoreGenSteps", true);
+  fScintStoreGenStepsCmd->SetDefaultValue(true);
+  fScintStoreGenStepsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
   fScintTrackSecondariesFirstCmd = new G4UIcmdWithABool(
     "/process/optical/scintillation/setTrackSecondariesFirst", this);
   fScintTrackSecondariesFirstCmd->SetGuidance(
@@ -296,11 +316,13 @@ G4OpticalParametersMessenger::~G4OpticalParametersMessenger()
   delete fCerenkovMaxPhotonsCmd;
   delete fCerenkovMaxBetaChangeCmd;
   delete fCerenkovStackPhotonsCmd;
+  delete fCerenkovStoreGenStepsCmd;
   delete fCerenkovTrackSecondariesFirstCmd;
   delete fCerenkovVerboseLevelCmd;
   delete fScintByParticleTypeCmd;
   delete fScintTrackInfoCmd;
   delete fScintStackPhotonsCmd;
+  delete fScintStoreGenStepsCmd;
   delete fScintVerboseLevelCmd;
   delete fScintFiniteRiseTimeCmd;
   delete fScintTrackSecondariesFirstCmd;
@@ -356,6 +378,11 @@ void G4OpticalParametersMessenger::SetNewValue(G4UIcommand* command,
     params->SetCerenkovStackPhotons(
       fCerenkovStackPhotonsCmd->GetNewBoolValue(newValue));
   }
+  else if(command == fCerenkovStoreGenStepsCmd)
+  {
+    params->SetCerenkovStoreGenSteps(
+      fCerenkovStoreGenStepsCmd->GetNewBoolValue(newValue));
+  }
   else if(command == fCerenkovTrackSecondariesFirstCmd)
   {
     params->SetCerenkovTrackSecondariesFirst(
@@ -385,6 +412,11 @@ void G4OpticalParametersMessenger::SetNewValue(G4UIcommand* command,
     params->SetScintStackPhotons(
       fScintStackPhotonsCmd->GetNewBoolValue(newValue));
   }
+  else if(command == fScintStoreGenStepsCmd)
+  {
+    params->SetScintStoreGenSteps(
+      fScintStoreGenStepsCmd->GetNewBoolValue(newValue));
+  }
   else if(command == fScintTrackSecondariesFirstCmd)
   {
     params->SetScintTrackSecondariesFirst(
@@ -50,8 +50,11 @@
 #include "G4ForceCondition.hh"
 #include "G4GPILSelection.hh"
 #include "G4MaterialPropertyVector.hh"
+#include "G4OpticalPhotonGenStep.hh"
 #include "G4VProcess.hh"
 
+#include <vector>
+
 class G4Material;
 class G4ParticleDefinition;
 class G4PhysicsTable;
@@ -93,6 +96,14 @@ class G4Cerenkov : public G4VProcess
                                   const G4Step& aStep) override;
   // This is the method implementing the Cerenkov process.
 
+  G4int GeneratePhotons(const G4OpticalPhotonGenStep& genStep,
+                        std::vector<G4Track*>& photons) const;
+  // Samples the photons of a Cerenkov generation step and appends the
+  // new tracks (without touchable) to the vector. Used by PostStepDoIt
+  // and to produce the photons of the generation steps recorded in
+  // G4OpticalPhotonGenStepStore at a later time.
+  // Returns the number of photons generated.
+
   //  no operation in  AtRestDoIt and  AlongStepDoIt
   virtual G4double AlongStepGetPhysicalInteractionLength(
     const G4Track&, G4double, G4double, G4double&, G4GPILSelection*) override
@@ -149,6 +160,13 @@ class G4Cerenkov : public G4VProcess
   G4bool GetStackPhotons() const;
   // Return the boolean for whether or not the scint. photons are stacked
 
+  void SetStoreGenSteps(const G4bool);
+  // Call by the user to record the photon generation steps in
+  // G4OpticalPhotonGenStepStore instead of producing the photons
+
+  G4bool GetStoreGenSteps() const;
+  // Return the boolean for whether or not the generation steps are stored
+
   G4int GetNumPhotons() const;
   // Returns the current number of scint. photons (after PostStepDoIt)
 
@@ -178,8 +196,12 @@ class G4Cerenkov : public G4VProcess
   G4int fNumPhotons;
 
   G4bool fStackingFlag;
+  G4bool fStoreGenSteps;
   G4bool fTrackSecondariesFirst;
 
+  // photons of the current step, reused to avoid reallocation
+  std::vector<G4Track*> fPhotons;
+
   G4int secID = -1;  // creator modelID
 
 };
@@ -198,6 +220,8 @@ inline G4int G4Cerenkov::GetMaxNumPhotonsPerStep() const { return fMaxPhotons; }
 
 inline G4bool G4Cerenkov::GetStackPhotons() const { return fStackingFlag; }
 
+inline G4bool G4Cerenkov::GetStoreGenSteps() const { return fStoreGenSteps; }
+
 inline G4int G4Cerenkov::GetNumPhotons() const { return fNumPhotons; }
 
 inline G4PhysicsTable* G4Cerenkov::GetPhysicsTable() const
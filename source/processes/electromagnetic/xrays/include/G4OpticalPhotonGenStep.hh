@@ -0,0 +1,78 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+////////////////////////////////////////////////////////////////////////
+// Optical Photon Generation Step Definition
+////////////////////////////////////////////////////////////////////////
+//
+// File:        G4OpticalPhotonGenStep.hh
+// Description: Compact record of the information needed by G4Cerenkov
+//              and G4Scintillation to generate the optical photons of
+//              one step of a charged particle at a later time.
+//              One record is made per step for Cerenkov light and one
+//              per time-constant component for scintillation light.
+//
+////////////////////////////////////////////////////////////////////////
+
+#ifndef G4OpticalPhotonGenStep_h
+#define G4OpticalPhotonGenStep_h 1
+
+#include "globals.hh"
+#include "G4OpticalParameters.hh"
+#include "G4ThreeVector.hh"
+
+struct G4OpticalPhotonGenStep
+{
+  // producing process: kCerenkov or kScintillation
+  G4int processIndex  = kNoProcess;
+  G4int parentID      = 0;
+  G4int materialIndex = -1;
+  G4int numPhotons    = 0;
+
+  // parent particle and step
+  G4double charge = 0.;
+  G4ThreeVector position;       // pre-step point position
+  G4ThreeVector deltaPosition;  // post-step minus pre-step position
+  G4double time         = 0.;   // pre-step point global time
+  G4double stepLength   = 0.;
+  G4double preVelocity  = 0.;
+  G4double postVelocity = 0.;
+
+  // scintillation: component index (0, 1, 2) and time constants
+  G4int scintComponent = 0;
+  G4double scintTime   = 0.;
+  G4double riseTime    = 0.;
+
+  // Cerenkov: 1/beta of the step and mean photon yields per unit
+  // length at the pre- and post-step points
+  G4double betaInverse          = 0.;
+  G4double meanNumberOfPhotons1 = 0.;
+  G4double meanNumberOfPhotons2 = 0.;
+};
+
+#endif /* G4OpticalPhotonGenStep_h */
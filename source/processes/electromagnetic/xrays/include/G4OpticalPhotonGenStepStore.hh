@@ -0,0 +1,126 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+////////////////////////////////////////////////////////////////////////
+// Optical Photon Generation Step Store Definition
+////////////////////////////////////////////////////////////////////////
+//
+// File:        G4OpticalPhotonGenStepStore.hh
+// Description: Thread-local container of G4OpticalPhotonGenStep records.
+//              When /process/optical/{cerenkov,scintillation}/
+//              setStoreGenSteps is enabled, G4Cerenkov and
+//              G4Scintillation record the generation steps here instead
+//              of creating the photon secondaries. The user is
+//              responsible for consuming the records, e.g. with
+//              G4Cerenkov::GeneratePhotons and
+//              G4Scintillation::GeneratePhotons, or by handing them to a
+//              fast detector response, and for calling Clear() at the
+//              beginning of each event.
+//
+////////////////////////////////////////////////////////////////////////
+
+#ifndef G4OpticalPhotonGenStepStore_h
+#define G4OpticalPhotonGenStepStore_h 1
+
+#include "globals.hh"
+#include "G4OpticalPhotonGenStep.hh"
+#include "G4ThreadLocalSingleton.hh"
+
+#include <vector>
+
+class G4OpticalPhotonGenStepStore
+{
+  friend class G4ThreadLocalSingleton<G4OpticalPhotonGenStepStore>;
+
+ public:
+  static G4OpticalPhotonGenStepStore* Instance();
+
+  ~G4OpticalPhotonGenStepStore();
+
+  G4OpticalPhotonGenStepStore(const G4OpticalPhotonGenStepStore&) = delete;
+  G4OpticalPhotonGenStepStore& operator=(const G4OpticalPhotonGenStepStore&) =
+    delete;
+
+  void Add(const G4OpticalPhotonGenStep& genStep);
+  // Records a generation step and updates the photon tallies
+
+  void Clear();
+  // Removes all generation steps and resets the photon tallies;
+  // the memory of the container is kept for the next event
+
+  const std::vector<G4OpticalPhotonGenStep>& GetGenSteps() const;
+  std::size_t GetNumberOfGenSteps() const;
+
+  G4int GetNumberOfPhotons() const;
+  // Returns the total number of photons of all stored generation steps
+
+  G4int GetNumberOfPhotons(G4int processIndex) const;
+  // Returns the number of photons of the stored generation steps
+  // produced by kCerenkov or kScintillation
+
+ private:
+  G4OpticalPhotonGenStepStore();
+
+  static G4ThreadLocal G4OpticalPhotonGenStepStore* instance;
+
+  std::vector<G4OpticalPhotonGenStep> fGenSteps;
+  G4int fNumCerenkovPhotons = 0;
+  G4int fNumScintPhotons    = 0;
+};
+
+////////////////////
+// Inline methods
+////////////////////
+
+inline const std::vector<G4OpticalPhotonGenStep>&
+G4OpticalPhotonGenStepStore::GetGenSteps() const
+{
+  return fGenSteps;
+}
+
+inline std::size_t G4OpticalPhotonGenStepStore::GetNumberOfGenSteps() const
+{
+  return fGenSteps.size();
+}
+
+inline G4int G4OpticalPhotonGenStepStore::GetNumberOfPhotons() const
+{
+  return fNumCerenkovPhotons + fNumScintPhotons;
+}
+
+inline G4int
+G4OpticalPhotonGenStepStore::GetNumberOfPhotons(G4int processIndex) const
+{
+  if(processIndex == kCerenkov)
+    return fNumCerenkovPhotons;
+  if(processIndex == kScintillation)
+    return fNumScintPhotons;
+  return 0;
+}
+
+#endif /* G4OpticalPhotonGenStepStore_h */
@@ -55,8 +55,12 @@
 #include "globals.hh"
 #include "G4EmSaturation.hh"
 #include "G4OpticalPhoton.hh"
+#include "G4OpticalPhotonGenStep.hh"
 #include "G4VRestDiscreteProcess.hh"
 
+#include <vector>
+
+class G4PhysicsFreeVector;
 class G4PhysicsTable;
 class G4Step;
 class G4Track;
@@ -109,6 +113,14 @@ class G4Scintillation : public G4VRestDiscreteProcess
   G4VParticleChange* AtRestDoIt(const G4Track& aTrack,
                                 const G4Step& aStep) override;
 
+  G4int GeneratePhotons(const G4OpticalPhotonGenStep& genStep,
+                        std::vector<G4Track*>& photons) const;
+  // Samples the photons of a scintillation generation step and appends
+  // the new tracks (without touchable) to the vector. Used by
+  // PostStepDoIt and to produce the photons of the generation steps
+  // recorded in G4OpticalPhotonGenStepStore at a later time.
+  // Returns the number of photons generated.
+
   G4double GetScintillationYieldByParticleType(const G4Track& aTrack,
                                                const G4Step& aStep,
                                                G4double& yield1,
@@ -175,6 +187,13 @@ class G4Scintillation : public G4VRestDiscreteProcess
   G4bool GetStackPhotons() const;
   // Return the boolean for whether or not the scint. photons are stacked
 
+  void SetStoreGenSteps(const G4bool);
+  // Call by the user to record the photon generation steps in
+  // G4OpticalPhotonGenStepStore instead of producing the photons
+
+  G4bool GetStoreGenSteps() const;
+  // Return the boolean for whether or not the generation steps are stored
+
   G4int GetNumPhotons() const;
   // Returns the current number of scint. photons (after PostStepDoIt)
 
@@ -199,18 +218,26 @@ class G4Scintillation : public G4VRestDiscreteProcess
   G4bool fScintillationByParticleType;
   G4bool fScintillationTrackInfo;
   G4bool fStackingFlag;
+  G4bool fStoreGenSteps;
   G4bool fTrackSecondariesFirst;
   G4bool fFiniteRiseTime;
 
+  // photons of the current step, reused to avoid reallocation
+  std::vector<G4Track*> fPhotons;
+
 #ifdef G4DEBUG_SCINTILLATION
   G4double ScintTrackEDep, ScintTrackYield;
 #endif
 
-  G4double single_exp(G4double t, G4double tau2);
-  G4double bi_exp(G4double t, G4double tau1, G4double tau2);
+  G4double single_exp(G4double t, G4double tau2) const;
+  G4double bi_exp(G4double t, G4double tau1, G4double tau2) const;
+
+  // scintillation integral of a time-constant component and material
+  G4PhysicsFreeVector* GetScintillationIntegral(G4int component,
+                                                G4int materialIndex) const;
 
   // emission time distribution when there is a finite rise time
-  G4double sample_time(G4double tau1, G4double tau2);
+  G4double sample_time(G4double tau1, G4double tau2) const;
 
   G4int secID = -1;  // creator modelID
 
@@ -269,15 +296,20 @@ inline G4bool G4Scintillation::GetScintillationTrackInfo() const
 
 inline G4bool G4Scintillation::GetStackPhotons() const { return fStackingFlag; }
 
+inline G4bool G4Scintillation::GetStoreGenSteps() const
+{
+  return fStoreGenSteps;
+}
+
 inline G4int G4Scintillation::GetNumPhotons() const { return fNumPhotons; }
 
-inline G4double G4Scintillation::single_exp(G4double t, G4double tau2)
+inline G4double G4Scintillation::single_exp(G4double t, G4double tau2) const
 {
   return std::exp(-1.0 * t / tau2) / tau2;
 }
 
 inline G4double G4Scintillation::bi_exp(G4double t, G4double tau1,
-                                        G4double tau2)
+                                        G4double tau2) const
 {
   return std::exp(-1.0 * t / tau2) * (1 - std::exp(-1.0 * t / tau1)) / tau2 /
          tau2 * (tau1 + tau2);
@@ -7,6 +7,8 @@ geant4_add_module(G4xrays
     G4ForwardXrayTR.hh
     G4GammaXTRadiator.hh
     G4GaussXTRadiator.hh
+    G4OpticalPhotonGenStep.hh
+    G4OpticalPhotonGenStepStore.hh
     G4RegularXTRadiator.hh
     G4Scintillation.hh
     G4ScintillationTrackInformation.hh
@@ -26,6 +28,7 @@ geant4_add_module(G4xrays
     G4ForwardXrayTR.cc
     G4GammaXTRadiator.cc
     G4GaussXTRadiator.cc
+    G4OpticalPhotonGenStepStore.cc
     G4RegularXTRadiator.cc
     G4Scintillation.cc
     G4ScintillationTrackInformation.cc
@@ -67,6 +67,7 @@
 #include "G4MaterialPropertiesTable.hh"
 #include "G4OpticalParameters.hh"
 #include "G4OpticalPhoton.hh"
+#include "G4OpticalPhotonGenStepStore.hh"
 #include "G4ParticleDefinition.hh"
 #include "G4ParticleMomentum.hh"
 #include "G4PhysicalConstants.hh"
@@ -117,6 +118,7 @@ void G4Cerenkov::ProcessDescription(std::ostream& out) const
   out << "Track secondaries first: "
       << params->GetCerenkovTrackSecondariesFirst();
   out << "Stack photons: " << params->GetCerenkovStackPhotons();
+  out << "Store generation steps: " << params->GetCerenkovStoreGenSteps();
   out << "Verbose level: " << params->GetCerenkovVerboseLevel();
 }
 
@@ -139,6 +141,7 @@ void G4Cerenkov::Initialise()
   SetMaxNumPhotonsPerStep(params->GetCerenkovMaxPhotonsPerStep());
   SetTrackSecondariesFirst(params->GetCerenkovTrackSecondariesFirst());
   SetStackPhotons(params->GetCerenkovStackPhotons());
+  SetStoreGenSteps(params->GetCerenkovStoreGenSteps());
   SetVerboseLevel(params->GetCerenkovVerboseLevel());
 }
 
@@ -233,7 +236,6 @@ G4VParticleChange* G4Cerenkov::PostStepDoIt(const G4Track& aTrack,
   G4StepPoint* pPostStepPoint = aStep.GetPostStepPoint();
 
   G4ThreeVector x0 = pPreStepPoint->GetPosition();
-  G4ThreeVector p0 = aStep.GetDeltaPosition().unit();
   G4double t0      = pPreStepPoint->GetGlobalTime();
 
   G4MaterialPropertiesTable* MPT = aMaterial->GetMaterialPropertiesTable();
@@ -261,13 +263,41 @@ G4VParticleChange* G4Cerenkov::PostStepDoIt(const G4Track& aTrack,
   MeanNumberOfPhotons  = MeanNumberOfPhotons * step_length;
   fNumPhotons          = (G4int) G4Poisson(MeanNumberOfPhotons);
 
-  if(fNumPhotons <= 0 || !fStackingFlag)
+  if(fNumPhotons <= 0 || !(fStackingFlag || fStoreGenSteps))
   {
     // return unchanged particle and no secondaries
     aParticleChange.SetNumberOfSecondaries(0);
     return pParticleChange;
   }
 
+  G4double beta1 = pPreStepPoint->GetBeta();
+  G4double beta2 = pPostStepPoint->GetBeta();
+
+  G4OpticalPhotonGenStep genStep;
+  genStep.processIndex  = kCerenkov;
+  genStep.parentID      = aTrack.GetTrackID();
+  genStep.materialIndex = aMaterial->GetIndex();
+  genStep.numPhotons    = fNumPhotons;
+  genStep.charge        = charge;
+  genStep.position      = x0;
+  genStep.deltaPosition = aStep.GetDeltaPosition();
+  genStep.time          = t0;
+  genStep.stepLength    = step_length;
+  genStep.preVelocity   = pPreStepPoint->GetVelocity();
+  genStep.postVelocity  = pPostStepPoint->GetVelocity();
+  genStep.betaInverse   = 1. / beta;
+  genStep.meanNumberOfPhotons1 =
+    GetAverageNumberOfPhotons(charge, beta1, aMaterial, Rindex);
+  genStep.meanNumberOfPhotons2 =
+    GetAverageNumberOfPhotons(charge, beta2, aMaterial, Rindex);
+
+  if(fStoreGenSteps)
+  {
+    G4OpticalPhotonGenStepStore::Instance()->Add(genStep);
+    aParticleChange.SetNumberOfSecondaries(0);
+    return pParticleChange;
+  }
+
   ////////////////////////////////////////////////////////////////
   aParticleChange.SetNumberOfSecondaries(fNumPhotons);
 
@@ -277,26 +307,62 @@ G4VParticleChange* G4Cerenkov::PostStepDoIt(const G4Track& aTrack,
       aParticleChange.ProposeTrackStatus(fSuspend);
   }
 
-  ////////////////////////////////////////////////////////////////
+  fPhotons.clear();
+  GeneratePhotons(genStep, fPhotons);
+  for(auto aSecondaryTrack : fPhotons)
+  {
+    aSecondaryTrack->SetTouchableHandle(
+      aStep.GetPreStepPoint()->GetTouchableHandle());
+    aParticleChange.AddSecondary(aSecondaryTrack);
+  }
+
+  if(verboseLevel > 1)
+  {
+    G4cout << "\n Exiting from G4Cerenkov::DoIt -- NumberOfSecondaries = "
+           << aParticleChange.GetNumberOfSecondaries() << G4endl;
+  }
+
+  return pParticleChange;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4int G4Cerenkov::GeneratePhotons(const G4OpticalPhotonGenStep& genStep,
+                                  std::vector<G4Track*>& photons) const
+// Samples the photons of a generation step: energies and Cerenkov angles
+// from the refractive index of the material, positions along the step
+// following the linear change of the photon yield between the pre- and
+// post-step points.
+{
+  const G4MaterialTable* theMaterialTable = G4Material::GetMaterialTable();
+  if(genStep.materialIndex < 0 ||
+     genStep.materialIndex >= (G4int) theMaterialTable->size())
+    return 0;
+
+  G4MaterialPropertiesTable* MPT =
+    (*theMaterialTable)[genStep.materialIndex]->GetMaterialPropertiesTable();
+  if(!MPT)
+    return 0;
+
+  G4MaterialPropertyVector* Rindex = MPT->GetProperty(kRINDEX);
+  if(!Rindex)
+    return 0;
+
   G4double Pmin = Rindex->Energy(0);
   G4double Pmax = Rindex->GetMaxEnergy();
   G4double dp   = Pmax - Pmin;
 
   G4double nMax        = Rindex->GetMaxValue();
-  G4double BetaInverse = 1. / beta;
+  G4double BetaInverse = genStep.betaInverse;
 
   G4double maxCos  = BetaInverse / nMax;
   G4double maxSin2 = (1.0 - maxCos) * (1.0 + maxCos);
 
-  G4double beta1 = pPreStepPoint->GetBeta();
-  G4double beta2 = pPostStepPoint->GetBeta();
+  G4double MeanNumberOfPhotons1 = genStep.meanNumberOfPhotons1;
+  G4double MeanNumberOfPhotons2 = genStep.meanNumberOfPhotons2;
 
-  G4double MeanNumberOfPhotons1 =
-    GetAverageNumberOfPhotons(charge, beta1, aMaterial, Rindex);
-  G4double MeanNumberOfPhotons2 =
-    GetAverageNumberOfPhotons(charge, beta2, aMaterial, Rindex);
+  G4ThreeVector p0 = genStep.deltaPosition.unit();
 
-  for(G4int i = 0; i < fNumPhotons; ++i)
+  for(G4int i = 0; i < genStep.numPhotons; ++i)
   {
     // Determine photon energy
     G4double rand;
@@ -357,34 +423,24 @@ G4VParticleChange* G4Cerenkov::PostStepDoIt(const G4Track& aTrack,
       // Loop checking, 07-Aug-2015, Vladimir Ivanchenko
     } while(N > NumberOfPhotons);
 
-    G4double delta = rand * aStep.GetStepLength();
+    G4double delta = rand * genStep.stepLength;
     G4double deltaTime =
-      delta /
-      (pPreStepPoint->GetVelocity() +
-       rand * (pPostStepPoint->GetVelocity() - pPreStepPoint->GetVelocity()) *
-         0.5);
+      delta / (genStep.preVelocity +
+               rand * (genStep.postVelocity - genStep.preVelocity) * 0.5);
 
-    G4double aSecondaryTime          = t0 + deltaTime;
-    G4ThreeVector aSecondaryPosition = x0 + rand * aStep.GetDeltaPosition();
+    G4double aSecondaryTime = genStep.time + deltaTime;
+    G4ThreeVector aSecondaryPosition =
+      genStep.position + rand * genStep.deltaPosition;
 
     // Generate new G4Track object:
     G4Track* aSecondaryTrack =
       new G4Track(aCerenkovPhoton, aSecondaryTime, aSecondaryPosition);
 
-    aSecondaryTrack->SetTouchableHandle(
-      aStep.GetPreStepPoint()->GetTouchableHandle());
-    aSecondaryTrack->SetParentID(aTrack.GetTrackID());
+    aSecondaryTrack->SetParentID(genStep.parentID);
     aSecondaryTrack->SetCreatorModelID(secID);
-    aParticleChange.AddSecondary(aSecondaryTrack);
-  }
-
-  if(verboseLevel > 1)
-  {
-    G4cout << "\n Exiting from G4Cerenkov::DoIt -- NumberOfSecondaries = "
-           << aParticleChange.GetNumberOfSecondaries() << G4endl;
+    photons.push_back(aSecondaryTrack);
   }
-
-  return pParticleChange;
+  return genStep.numPhotons;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -602,6 +658,13 @@ void G4Cerenkov::SetStackPhotons(const G4bool stackingFlag)
   G4OpticalParameters::Instance()->SetCerenkovStackPhotons(fStackingFlag);
 }
 
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4Cerenkov::SetStoreGenSteps(const G4bool val)
+{
+  fStoreGenSteps = val;
+  G4OpticalParameters::Instance()->SetCerenkovStoreGenSteps(fStoreGenSteps);
+}
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 void G4Cerenkov::DumpPhysicsTable() const
 {
@@ -0,0 +1,80 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+////////////////////////////////////////////////////////////////////////
+// Optical Photon Generation Step Store Class Implementation
+////////////////////////////////////////////////////////////////////////
+//
+// File:        G4OpticalPhotonGenStepStore.cc
+// Description: Thread-local container of optical photon generation steps
+//
+////////////////////////////////////////////////////////////////////////
+
+#include "G4OpticalPhotonGenStepStore.hh"
+
+G4ThreadLocal G4OpticalPhotonGenStepStore*
+  G4OpticalPhotonGenStepStore::instance = nullptr;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4OpticalPhotonGenStepStore* G4OpticalPhotonGenStepStore::Instance()
+{
+  if(instance == nullptr)
+  {
+    static G4ThreadLocalSingleton<G4OpticalPhotonGenStepStore> inst;
+    instance = inst.Instance();
+  }
+  return instance;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4OpticalPhotonGenStepStore::G4OpticalPhotonGenStepStore() {}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4OpticalPhotonGenStepStore::~G4OpticalPhotonGenStepStore() {}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpticalPhotonGenStepStore::Add(const G4OpticalPhotonGenStep& genStep)
+{
+  fGenSteps.push_back(genStep);
+  if(genStep.processIndex == kCerenkov)
+  {
+    fNumCerenkovPhotons += genStep.numPhotons;
+  }
+  else if(genStep.processIndex == kScintillation)
+  {
+    fNumScintPhotons += genStep.numPhotons;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpticalPhotonGenStepStore::Clear()
+{
+  fGenSteps.clear();
+  fNumCerenkovPhotons = 0;
+  fNumScintPhotons    = 0;
+}
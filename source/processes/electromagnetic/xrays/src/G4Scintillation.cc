@@ -73,6 +73,7 @@
 #include "G4MaterialPropertiesTable.hh"
 #include "G4MaterialPropertyVector.hh"
 #include "G4OpticalParameters.hh"
+#include "G4OpticalPhotonGenStepStore.hh"
 #include "G4ParticleMomentum.hh"
 #include "G4ParticleTypes.hh"
 #include "G4PhysicalConstants.hh"
@@ -145,6 +146,7 @@ void G4Scintillation::ProcessDescription(std::ostream& out) const
   out << "Scintillation by particle type: " << params->GetScintByParticleType();
   out << "Save track information: " << params->GetScintTrackInfo();
   out << "Stack photons: " << params->GetScintStackPhotons();
+  out << "Store generation steps: " << params->GetScintStoreGenSteps();
   out << "Verbose level: " << params->GetScintVerboseLevel();
 }
 
@@ -173,6 +175,7 @@ void G4Scintillation::Initialise()
   SetScintillationByParticleType(params->GetScintByParticleType());
   SetScintillationTrackInfo(params->GetScintTrackInfo());
   SetStackPhotons(params->GetScintStackPhotons());
+  SetStoreGenSteps(params->GetScintStoreGenSteps());
   SetVerboseLevel(params->GetScintVerboseLevel());
 }
 
@@ -431,30 +434,42 @@ G4VParticleChange* G4Scintillation::PostStepDoIt(const G4Track& aTrack,
     fNumPhotons = G4int(G4Poisson(MeanNumberOfPhotons));
   }
 
-  if(fNumPhotons <= 0 || !fStackingFlag)
+  if(fNumPhotons <= 0 || !(fStackingFlag || fStoreGenSteps))
   {
     // return unchanged particle and no secondaries
     aParticleChange.SetNumberOfSecondaries(0);
     return G4VRestDiscreteProcess::PostStepDoIt(aTrack, aStep);
   }
 
-  aParticleChange.SetNumberOfSecondaries(fNumPhotons);
-
-  if(fTrackSecondariesFirst)
+  if(!fStoreGenSteps)
   {
-    if(aTrack.GetTrackStatus() == fAlive)
-      aParticleChange.ProposeTrackStatus(fSuspend);
+    aParticleChange.SetNumberOfSecondaries(fNumPhotons);
+
+    if(fTrackSecondariesFirst)
+    {
+      if(aTrack.GetTrackStatus() == fAlive)
+        aParticleChange.ProposeTrackStatus(fSuspend);
+    }
   }
 
   G4int materialIndex = aMaterial->GetIndex();
 
-  // Retrieve the Scintillation Integral for this material
-  // new G4PhysicsFreeVector allocated to hold CII's
-  size_t numPhot                     = fNumPhotons;
-  G4double scintTime                 = 0.;
-  G4double riseTime                  = 0.;
-  G4PhysicsFreeVector* scintIntegral = nullptr;
-  G4ScintillationType scintType      = Slow;
+  // Fill the generation step, common to all time constants
+  G4OpticalPhotonGenStep genStep;
+  genStep.processIndex  = kScintillation;
+  genStep.parentID      = aTrack.GetTrackID();
+  genStep.materialIndex = materialIndex;
+  genStep.charge        = aParticle->GetDefinition()->GetPDGCharge();
+  genStep.position      = x0;
+  genStep.deltaPosition = aStep.GetDeltaPosition();
+  genStep.time          = t0;
+  genStep.stepLength    = aStep.GetStepLength();
+  genStep.preVelocity   = pPreStepPoint->GetVelocity();
+  genStep.postVelocity  = pPostStepPoint->GetVelocity();
+
+  size_t numPhot     = fNumPhotons;
+  G4double scintTime = 0.;
+  G4double riseTime  = 0.;
 
   for(G4int scnt = 0; scnt < N_timeconstants; ++scnt)
   {
@@ -474,9 +489,6 @@ G4VParticleChange* G4Scintillation::PostStepDoIt(const G4Track& aTrack,
       {
         riseTime = MPT->GetConstProperty(kSCINTILLATIONRISETIME1);
       }
-      scintType = Fast;
-      scintIntegral =
-        (G4PhysicsFreeVector*) ((*fIntegralTable1)(materialIndex));
     }
     else if(scnt == 1)
     {
@@ -494,9 +506,6 @@ G4VParticleChange* G4Scintillation::PostStepDoIt(const G4Track& aTrack,
       {
         riseTime = MPT->GetConstProperty(kSCINTILLATIONRISETIME2);
       }
-      scintType = Medium;
-      scintIntegral =
-        (G4PhysicsFreeVector*) ((*fIntegralTable2)(materialIndex));
     }
     else if(scnt == 2)
     {
@@ -506,83 +515,26 @@ G4VParticleChange* G4Scintillation::PostStepDoIt(const G4Track& aTrack,
       {
         riseTime = MPT->GetConstProperty(kSCINTILLATIONRISETIME3);
       }
-      scintType = Slow;
-      scintIntegral =
-        (G4PhysicsFreeVector*) ((*fIntegralTable3)(materialIndex));
     }
 
-    if(!scintIntegral)
-      continue;
+    genStep.numPhotons     = (G4int) numPhot;
+    genStep.scintComponent = scnt;
+    genStep.scintTime      = scintTime;
+    genStep.riseTime       = riseTime;
 
-    G4double CIImax = scintIntegral->GetMaxValue();
-    for(size_t i = 0; i < numPhot; ++i)
+    if(fStoreGenSteps)
     {
-      // Determine photon energy
-      G4double CIIvalue      = G4UniformRand() * CIImax;
-      G4double sampledEnergy = scintIntegral->GetEnergy(CIIvalue);
-
-      if(verboseLevel > 1)
-      {
-        G4cout << "sampledEnergy = " << sampledEnergy << G4endl;
-        G4cout << "CIIvalue =        " << CIIvalue << G4endl;
-      }
-
-      // Generate random photon direction
-      G4double cost = 1. - 2. * G4UniformRand();
-      G4double sint = std::sqrt((1. - cost) * (1. + cost));
-      G4double phi  = twopi * G4UniformRand();
-      G4double sinp = std::sin(phi);
-      G4double cosp = std::cos(phi);
-      G4ParticleMomentum photonMomentum(sint * cosp, sint * sinp, cost);
-
-      // Determine polarization of new photon
-      G4ThreeVector photonPolarization(cost * cosp, cost * sinp, -sint);
-      G4ThreeVector perp = photonMomentum.cross(photonPolarization);
-      phi                = twopi * G4UniformRand();
-      sinp               = std::sin(phi);
-      cosp               = std::cos(phi);
-      photonPolarization = (cosp * photonPolarization + sinp * perp).unit();
-
-      // Generate a new photon:
-      G4DynamicParticle* scintPhoton =
-        new G4DynamicParticle(opticalphoton, photonMomentum);
-      scintPhoton->SetPolarization(photonPolarization);
-      scintPhoton->SetKineticEnergy(sampledEnergy);
-
-      // Generate new G4Track object:
-      G4double rand = G4UniformRand();
-      if(aParticle->GetDefinition()->GetPDGCharge() == 0)
-      {
-        rand = 1.0;
-      }
-
-      // emission time distribution
-      G4double delta = rand * aStep.GetStepLength();
-      G4double deltaTime =
-        delta /
-        (pPreStepPoint->GetVelocity() +
-         rand * (pPostStepPoint->GetVelocity() - pPreStepPoint->GetVelocity()) /
-           2.);
-      if(riseTime == 0.0)
-      {
-        deltaTime -= scintTime * std::log(G4UniformRand());
-      }
-      else
-      {
-        deltaTime += sample_time(riseTime, scintTime);
-      }
-
-      G4double secTime          = t0 + deltaTime;
-      G4ThreeVector secPosition = x0 + rand * aStep.GetDeltaPosition();
+      if(numPhot > 0 && GetScintillationIntegral(scnt, materialIndex))
+        G4OpticalPhotonGenStepStore::Instance()->Add(genStep);
+      continue;
+    }
 
-      G4Track* secTrack = new G4Track(scintPhoton, secTime, secPosition);
+    fPhotons.clear();
+    GeneratePhotons(genStep, fPhotons);
+    for(auto secTrack : fPhotons)
+    {
       secTrack->SetTouchableHandle(
         aStep.GetPreStepPoint()->GetTouchableHandle());
-      secTrack->SetParentID(aTrack.GetTrackID());
-      secTrack->SetCreatorModelID(secID);
-      if(fScintillationTrackInfo)
-        secTrack->SetUserInformation(
-          new G4ScintillationTrackInformation(scintType));
       aParticleChange.AddSecondary(secTrack);
     }
   }
@@ -596,6 +548,112 @@ G4VParticleChange* G4Scintillation::PostStepDoIt(const G4Track& aTrack,
   return G4VRestDiscreteProcess::PostStepDoIt(aTrack, aStep);
 }
 
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4PhysicsFreeVector* G4Scintillation::GetScintillationIntegral(
+  G4int component, G4int materialIndex) const
+{
+  G4PhysicsTable* integralTable = fIntegralTable1;
+  if(component == 1)
+    integralTable = fIntegralTable2;
+  else if(component == 2)
+    integralTable = fIntegralTable3;
+
+  if(!integralTable || materialIndex < 0 ||
+     materialIndex >= (G4int) integralTable->entries())
+    return nullptr;
+  return (G4PhysicsFreeVector*) ((*integralTable)(materialIndex));
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4int G4Scintillation::GeneratePhotons(const G4OpticalPhotonGenStep& genStep,
+                                       std::vector<G4Track*>& photons) const
+// Samples the photons of one time-constant component of a generation
+// step: energies from the scintillation integral of the material,
+// directions uniformly into 4pi, positions evenly along the step and
+// times from the emission time distribution.
+{
+  // Retrieve the Scintillation Integral for this material
+  G4PhysicsFreeVector* scintIntegral =
+    GetScintillationIntegral(genStep.scintComponent, genStep.materialIndex);
+  if(!scintIntegral)
+    return 0;
+
+  G4ScintillationType scintType = Fast;
+  if(genStep.scintComponent == 1)
+    scintType = Medium;
+  else if(genStep.scintComponent == 2)
+    scintType = Slow;
+
+  G4double CIImax = scintIntegral->GetMaxValue();
+  for(G4int i = 0; i < genStep.numPhotons; ++i)
+  {
+    // Determine photon energy
+    G4double CIIvalue      = G4UniformRand() * CIImax;
+    G4double sampledEnergy = scintIntegral->GetEnergy(CIIvalue);
+
+    if(verboseLevel > 1)
+    {
+      G4cout << "sampledEnergy = " << sampledEnergy << G4endl;
+      G4cout << "CIIvalue =        " << CIIvalue << G4endl;
+    }
+
+    // Generate random photon direction
+    G4double cost = 1. - 2. * G4UniformRand();
+    G4double sint = std::sqrt((1. - cost) * (1. + cost));
+    G4double phi  = twopi * G4UniformRand();
+    G4double sinp = std::sin(phi);
+    G4double cosp = std::cos(phi);
+    G4ParticleMomentum photonMomentum(sint * cosp, sint * sinp, cost);
+
+    // Determine polarization of new photon
+    G4ThreeVector photonPolarization(cost * cosp, cost * sinp, -sint);
+    G4ThreeVector perp = photonMomentum.cross(photonPolarization);
+    phi                = twopi * G4UniformRand();
+    sinp               = std::sin(phi);
+    cosp               = std::cos(phi);
+    photonPolarization = (cosp * photonPolarization + sinp * perp).unit();
+
+    // Generate a new photon:
+    G4DynamicParticle* scintPhoton =
+      new G4DynamicParticle(opticalphoton, photonMomentum);
+    scintPhoton->SetPolarization(photonPolarization);
+    scintPhoton->SetKineticEnergy(sampledEnergy);
+
+    // Generate new G4Track object:
+    G4double rand = G4UniformRand();
+    if(genStep.charge == 0)
+    {
+      rand = 1.0;
+    }
+
+    // emission time distribution
+    G4double delta = rand * genStep.stepLength;
+    G4double deltaTime =
+      delta / (genStep.preVelocity +
+               rand * (genStep.postVelocity - genStep.preVelocity) / 2.);
+    if(genStep.riseTime == 0.0)
+    {
+      deltaTime -= genStep.scintTime * std::log(G4UniformRand());
+    }
+    else
+    {
+      deltaTime += sample_time(genStep.riseTime, genStep.scintTime);
+    }
+
+    G4double secTime          = genStep.time + deltaTime;
+    G4ThreeVector secPosition = genStep.position + rand * genStep.deltaPosition;
+
+    G4Track* secTrack = new G4Track(scintPhoton, secTime, secPosition);
+    secTrack->SetParentID(genStep.parentID);
+    secTrack->SetCreatorModelID(secID);
+    if(fScintillationTrackInfo)
+      secTrack->SetUserInformation(
+        new G4ScintillationTrackInformation(scintType));
+    photons.push_back(secTrack);
+  }
+  return genStep.numPhotons;
+}
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 G4double G4Scintillation::GetMeanFreePath(const G4Track&, G4double,
                                           G4ForceCondition* condition)
@@ -613,7 +671,7 @@ G4double G4Scintillation::GetMeanLifeTime(const G4Track&,
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
-G4double G4Scintillation::sample_time(G4double tau1, G4double tau2)
+G4double G4Scintillation::sample_time(G4double tau1, G4double tau2) const
 {
   // tau1: rise time and tau2: decay time
   // Loop checking, 07-Aug-2015, Vladimir Ivanchenko
@@ -901,6 +959,13 @@ void G4Scintillation::SetStackPhotons(const G4bool stackingFlag)
   G4OpticalParameters::Instance()->SetScintStackPhotons(fStackingFlag);
 }
 
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4Scintillation::SetStoreGenSteps(const G4bool val)
+{
+  fStoreGenSteps = val;
+  G4OpticalParameters::Instance()->SetScintStoreGenSteps(fStoreGenSteps);
+}
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 void G4Scintillation::SetVerboseLevel(G4int verbose)
 {
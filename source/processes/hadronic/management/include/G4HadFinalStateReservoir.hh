@@ -0,0 +1,164 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// 19-Oct-2026 Per-thread reservoir of pre-generated hadronic final states
+
+// Class Description
+// Opt-in, controlled approximation for thick-target simulations in which
+// the same (projectile, model, isotope, energy) combinations are sampled
+// many times. Inelastic final states produced by a model are stored in
+// the centre-of-mass frame of the projectile and the target at rest, in
+// bins of log(Ekin) per projectile, model and isotope. Once a bin is full,
+// further interactions are served from it: a stored state is picked at
+// random, rotated by a random azimuthal angle, its CM momenta rescaled to
+// the actual available energy, and boosted back with the actual CM
+// velocity. A fraction of the interactions is still generated by the model
+// and replaces a random slot (refresh); another fraction is used to compare
+// cached and fresh final states (validation), so that the bias introduced
+// by the approximation can be printed at the end of the run.
+// An instance is owned by each G4HadronicProcess, hence it is thread-local.
+// Class Description - End
+
+#ifndef G4HadFinalStateReservoir_h
+#define G4HadFinalStateReservoir_h 1
+
+#include "globals.hh"
+#include "G4ThreeVector.hh"
+#include "G4HadFinalState.hh"
+#include <map>
+#include <tuple>
+#include <vector>
+#include <iosfwd>
+
+class G4HadProjectile;
+class G4Nucleus;
+class G4ParticleDefinition;
+class G4HadronicInteraction;
+
+class G4HadFinalStateReservoir
+{
+public:
+
+  G4HadFinalStateReservoir(G4int nStates, G4int binsPerDecade,
+                           G4double refreshFraction,
+                           G4double validationFraction);
+
+  ~G4HadFinalStateReservoir();
+
+  G4HadFinalState* Sample(const G4HadProjectile& aPro,
+                          const G4Nucleus& aNucleus,
+                          const G4HadronicInteraction* aModel);
+  // returns a final state built from the reservoir, or nullptr if the
+  // model has to be called; in that case Store() must follow
+
+  void Store(const G4HadProjectile& aPro, const G4Nucleus& aNucleus,
+             const G4HadFinalState* aResult);
+  // record a final state freshly produced by the model
+
+  void DumpStatistics(std::ostream& out) const;
+  // print usage of the reservoir and the validation results
+
+  void Clear();
+  // drop all stored final states and statistics
+
+  inline G4int GetNumberOfStates() const { return fNStates; }
+
+private:
+
+  struct StoredSecondary
+  {
+    const G4ParticleDefinition* fDef;
+    G4ThreeVector fMom;
+    G4double fMass;
+    G4double fTime;
+    G4double fWeight;
+    G4int fModelID;
+  };
+
+  struct StoredState
+  {
+    std::vector<StoredSecondary> fSecondaries;
+    G4double fLocalEnergyDeposit;
+    G4double fKineticCM;
+    G4double fAvailableCM;
+  };
+
+  typedef std::tuple<const G4ParticleDefinition*,
+                     const G4HadronicInteraction*, G4int, G4int, G4int> Key;
+  typedef std::vector<StoredState> Bin;
+
+  struct Statistics
+  {
+    G4double fN = 0.0;
+    G4double fMult = 0.0;
+    G4double fMult2 = 0.0;
+    G4double fEkin = 0.0;
+    G4double fEkin2 = 0.0;
+    G4double fImbalance = 0.0;
+    G4double fImbalance2 = 0.0;
+  };
+
+  enum { kSkip = 0, kFill, kRefresh, kValidate };
+
+  Key MakeKey(const G4HadProjectile& aPro, const G4Nucleus& aNucleus,
+              const G4HadronicInteraction* aModel) const;
+
+  G4bool Kinematics(const G4HadProjectile& aPro, const G4Nucleus& aNucleus,
+                    G4double& beta, G4double& ekinCM) const;
+
+  const StoredState& SelectState(const Bin& aBin) const;
+
+  G4bool BuildFinalState(const StoredState& aState, G4double beta,
+                         G4double ekinCM, G4HadFinalState& aResult) const;
+
+  void Accumulate(const G4HadProjectile& aPro, const G4Nucleus& aNucleus,
+                  const G4HadFinalState& aResult, Statistics& stat) const;
+
+  G4HadFinalStateReservoir(const G4HadFinalStateReservoir&) = delete;
+  G4HadFinalStateReservoir& operator=(const G4HadFinalStateReservoir&) = delete;
+
+  std::map<Key, Bin> fBins;
+
+  G4HadFinalState fResult;
+  G4HadFinalState fCheck;
+
+  Key fLastKey;
+  G4int fAction;
+
+  G4int fNStates;
+  G4double fBinsPerDecade;
+  G4double fRefresh;
+  G4double fValidation;
+
+  G4double fNCalls;
+  G4double fNReused;
+
+  Statistics fCachedStat;
+  Statistics fFreshStat;
+};
+
+#endif
@@ -45,6 +45,7 @@
 // 14-Sep-2012 Inherit from RestDiscrete, use subtype code (now in ctor) to
 //		configure base-class
 // 28-Sep-2012 M. Kelsey -- Undo inheritance change, keep new ctor
+// 19-Oct-2026 Added optional reservoir of pre-generated final states
 
 #ifndef G4HadronicProcess_h
 #define G4HadronicProcess_h 1
@@ -66,6 +67,7 @@ class G4HadronicInteraction;
 class G4HadronicProcessStore;
 class G4VCrossSectionDataSet;
 class G4VLeadingParticleBiasing;
+class G4HadFinalStateReservoir;
 
 class G4HadronicProcess : public G4VDiscreteProcess
 {
@@ -179,6 +181,10 @@ public:
   inline G4CrossSectionDataStore* GetCrossSectionDataStore()
     {return theCrossSectionDataStore;}
 
+  // access to the reservoir of final states (nullptr if disabled)
+  inline G4HadFinalStateReservoir* GetFinalStateReservoir() const
+    {return theReservoir;}
+
 protected:
 
   void DumpState(const G4Track&, const G4String&, G4ExceptionDescription&);
@@ -231,6 +237,8 @@ private:
   G4CrossSectionDataStore* theCrossSectionDataStore;
 
   G4HadronicProcessStore* theProcessStore;
+
+  G4HadFinalStateReservoir* theReservoir;
      
   G4Nucleus targetNucleus;
 
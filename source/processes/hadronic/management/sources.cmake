@@ -4,6 +4,7 @@
 geant4_add_module(G4hadronic_mgt
   PUBLIC_HEADERS
     G4EnergyRangeManager.hh
+    G4HadFinalStateReservoir.hh
     G4HadLeadBias.hh
     G4HadronicEPTestMessenger.hh
     G4HadronicInteraction.hh
@@ -18,6 +19,7 @@ geant4_add_module(G4hadronic_mgt
     G4VPreCompoundModel.hh
   SOURCES
     G4EnergyRangeManager.cc
+    G4HadFinalStateReservoir.cc
     G4HadLeadBias.cc
     G4HadronicEPTestMessenger.cc
     G4HadronicInteraction.cc
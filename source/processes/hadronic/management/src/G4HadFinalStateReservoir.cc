@@ -0,0 +1,295 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// 19-Oct-2026 Per-thread reservoir of pre-generated hadronic final states
+
+#include "G4HadFinalStateReservoir.hh"
+#include "G4HadProjectile.hh"
+#include "G4Nucleus.hh"
+#include "G4NucleiProperties.hh"
+#include "G4DynamicParticle.hh"
+#include "G4LorentzVector.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Log.hh"
+#include "Randomize.hh"
+#include <iostream>
+#include <iomanip>
+
+G4HadFinalStateReservoir::G4HadFinalStateReservoir(G4int nStates,
+                                                   G4int binsPerDecade,
+                                                   G4double refreshFraction,
+                                                   G4double validationFraction)
+  : fAction(kSkip), fNStates(std::max(nStates, 1)), 
+    fBinsPerDecade(G4double(std::max(binsPerDecade, 1))),
+    fRefresh(refreshFraction), fValidation(validationFraction),
+    fNCalls(0.0), fNReused(0.0)
+{}
+
+G4HadFinalStateReservoir::~G4HadFinalStateReservoir()
+{}
+
+void G4HadFinalStateReservoir::Clear()
+{
+  fBins.clear();
+  fNCalls = fNReused = 0.0;
+  fCachedStat = Statistics();
+  fFreshStat = Statistics();
+  fAction = kSkip;
+}
+
+G4HadFinalStateReservoir::Key 
+G4HadFinalStateReservoir::MakeKey(const G4HadProjectile& aPro, 
+                                  const G4Nucleus& aNucleus,
+                                  const G4HadronicInteraction* aModel) const
+{
+  static const G4double invlog10 = 1.0/G4Log(10.);
+  // bins are counted from 1 meV to keep the index positive
+  G4double ekin = std::max(aPro.GetKineticEnergy()/CLHEP::eV, 1.e-3);
+  G4int bin = G4int(fBinsPerDecade*(G4Log(ekin)*invlog10 + 3.0));
+  return Key(aPro.GetDefinition(), aModel, aNucleus.GetZ_asInt(), 
+             aNucleus.GetA_asInt(), bin);
+}
+
+G4bool 
+G4HadFinalStateReservoir::Kinematics(const G4HadProjectile& aPro, 
+                                     const G4Nucleus& aNucleus,
+                                     G4double& beta, G4double& ekinCM) const
+{
+  // the model frame has the projectile along z and the target at rest
+  G4double mass = G4NucleiProperties::GetNuclearMass(aNucleus.GetA_asInt(),
+                                                     aNucleus.GetZ_asInt());
+  G4LorentzVector lv = aPro.Get4Momentum();
+  G4double mproj = lv.m();
+  lv.setE(lv.e() + mass);
+  beta = lv.z()/lv.e();
+  ekinCM = lv.m() - mproj - mass;
+  return (mass > 0.0 && ekinCM > 0.0);
+}
+
+const G4HadFinalStateReservoir::StoredState& 
+G4HadFinalStateReservoir::SelectState(const Bin& aBin) const
+{
+  G4int idx = G4int(aBin.size()*G4UniformRand());
+  return aBin[std::min(idx, G4int(aBin.size()) - 1)];
+}
+
+G4HadFinalState* 
+G4HadFinalStateReservoir::Sample(const G4HadProjectile& aPro,
+                                 const G4Nucleus& aNucleus,
+                                 const G4HadronicInteraction* aModel)
+{
+  fNCalls += 1.0;
+  fLastKey = MakeKey(aPro, aNucleus, aModel);
+
+  // the bin is filled by the model first
+  auto it = fBins.find(fLastKey);
+  if(it == fBins.end() || G4int(it->second.size()) < fNStates) {
+    fAction = kFill;
+    return nullptr;
+  }
+  G4double rndm = G4UniformRand();
+  if(rndm < fRefresh) {
+    fAction = kRefresh;
+    return nullptr;
+  } else if(rndm < fRefresh + fValidation) {
+    fAction = kValidate;
+    return nullptr;
+  }
+
+  fAction = kSkip;
+  G4double beta, ekinCM;
+  if(!Kinematics(aPro, aNucleus, beta, ekinCM)) { return nullptr; }
+
+  fResult.Clear();
+  if(!BuildFinalState(SelectState(it->second), beta, ekinCM, fResult)) {
+    return nullptr;
+  }
+  fNReused += 1.0;
+  return &fResult;
+}
+
+void G4HadFinalStateReservoir::Store(const G4HadProjectile& aPro, 
+                                     const G4Nucleus& aNucleus,
+                                     const G4HadFinalState* aResult)
+{
+  G4int action = fAction;
+  fAction = kSkip;
+  if(kSkip == action || nullptr == aResult || 
+     aResult->GetStatusChange() != stopAndKill) { return; }
+
+  G4double beta, ekinCM;
+  if(!Kinematics(aPro, aNucleus, beta, ekinCM)) { return; }
+
+  Bin& bin = fBins[fLastKey];
+
+  // compare the fresh final state with one served from the same bin
+  if(kValidate == action) {
+    Accumulate(aPro, aNucleus, *aResult, fFreshStat);
+    fCheck.Clear();
+    if(BuildFinalState(SelectState(bin), beta, ekinCM, fCheck)) {
+      Accumulate(aPro, aNucleus, fCheck, fCachedStat);
+    }
+    std::size_t nsec = fCheck.GetNumberOfSecondaries();
+    for(std::size_t i=0; i<nsec; ++i) { delete fCheck.GetSecondary(i)->GetParticle(); }
+    fCheck.Clear();
+    return;
+  }
+
+  StoredState state;
+  state.fLocalEnergyDeposit = aResult->GetLocalEnergyDeposit();
+  state.fKineticCM = 0.0;
+  state.fAvailableCM = ekinCM;
+  std::size_t nsec = aResult->GetNumberOfSecondaries();
+  state.fSecondaries.reserve(nsec);
+  for(std::size_t i=0; i<nsec; ++i) {
+    const G4HadSecondary* sec = aResult->GetSecondary(i);
+    const G4DynamicParticle* dp = sec->GetParticle();
+    G4LorentzVector lv = dp->Get4Momentum();
+    lv.boost(0.0, 0.0, -beta);
+    StoredSecondary part;
+    part.fDef = dp->GetDefinition();
+    part.fMom = lv.vect();
+    part.fMass = std::max(dp->GetMass(), 0.0);
+    part.fTime = sec->GetTime();
+    part.fWeight = sec->GetWeight();
+    part.fModelID = sec->GetCreatorModelID();
+    state.fKineticCM += 
+      std::sqrt(part.fMom.mag2() + part.fMass*part.fMass) - part.fMass;
+    state.fSecondaries.push_back(part);
+  }
+
+  if(G4int(bin.size()) < fNStates) {
+    bin.push_back(state);
+  } else {
+    G4int idx = G4int(fNStates*G4UniformRand());
+    bin[std::min(idx, fNStates - 1)] = state;
+  }
+}
+
+G4bool 
+G4HadFinalStateReservoir::BuildFinalState(const StoredState& aState,
+                                          G4double beta, G4double ekinCM,
+                                          G4HadFinalState& aResult) const
+{
+  // the CM momenta are scaled to absorb the difference between the
+  // actual available energy and the one at which the state was generated
+  G4double tkin = aState.fKineticCM + ekinCM - aState.fAvailableCM;
+  if(tkin <= 0.0) { return false; }
+  G4double scale = 1.0;
+  if(aState.fKineticCM > 0.0) {
+    for(G4int iter=0; iter<10; ++iter) {
+      G4double t = 0.0;
+      G4double dt = 0.0;
+      for(auto const& part : aState.fSecondaries) {
+        G4double p2 = part.fMom.mag2();
+        G4double e = std::sqrt(scale*scale*p2 + part.fMass*part.fMass);
+        t += e - part.fMass;
+        if(e > 0.0) { dt += scale*p2/e; }
+      }
+      if(dt <= 0.0) { break; }
+      G4double delta = (tkin - t)/dt;
+      scale += delta;
+      if(scale <= 0.0) { return false; }
+      if(std::abs(t - tkin) < 1.e-9*tkin) { break; }
+    }
+  }
+
+  // random rotation around the projectile direction
+  G4double phi = CLHEP::twopi*G4UniformRand();
+  for(auto const& part : aState.fSecondaries) {
+    G4ThreeVector mom = scale*part.fMom;
+    mom.rotateZ(phi);
+    G4LorentzVector lv(mom, std::sqrt(mom.mag2() + part.fMass*part.fMass));
+    lv.boost(0.0, 0.0, beta);
+    G4HadSecondary sec(new G4DynamicParticle(part.fDef, lv), part.fWeight, 
+                       part.fModelID);
+    sec.SetTime(part.fTime);
+    aResult.AddSecondary(sec);
+  }
+  aResult.SetStatusChange(stopAndKill);
+  aResult.SetLocalEnergyDeposit(aState.fLocalEnergyDeposit);
+  return true;
+}
+
+void G4HadFinalStateReservoir::Accumulate(const G4HadProjectile& aPro,
+                                          const G4Nucleus& aNucleus,
+                                          const G4HadFinalState& aResult,
+                                          Statistics& stat) const
+{
+  G4double mass = G4NucleiProperties::GetNuclearMass(aNucleus.GetA_asInt(),
+                                                     aNucleus.GetZ_asInt());
+  G4double ein = aPro.GetTotalEnergy() + mass;
+  G4double eout = aResult.GetLocalEnergyDeposit();
+  G4double ekin = 0.0;
+  std::size_t nsec = aResult.GetNumberOfSecondaries();
+  for(std::size_t i=0; i<nsec; ++i) {
+    const G4DynamicParticle* dp = aResult.GetSecondary(i)->GetParticle();
+    ekin += dp->GetKineticEnergy();
+    eout += dp->GetTotalEnergy();
+  }
+  G4double mult = G4double(G4int(nsec));
+  stat.fN += 1.0;
+  stat.fMult += mult;
+  stat.fMult2 += mult*mult;
+  stat.fEkin += ekin;
+  stat.fEkin2 += ekin*ekin;
+  stat.fImbalance += ein - eout;
+  stat.fImbalance2 += (ein - eout)*(ein - eout);
+}
+
+void G4HadFinalStateReservoir::DumpStatistics(std::ostream& out) const
+{
+  out << " Final state reservoir: " << fBins.size() << " bins of " 
+      << fNStates << " states; " << fNReused << " of " << fNCalls
+      << " interactions served from the reservoir" << G4endl;
+  if(fFreshStat.fN <= 0.0 || fCachedStat.fN <= 0.0) { return; }
+
+  out << " Validation with " << fFreshStat.fN 
+      << " fresh final states (cached - fresh)/error:" << G4endl;
+  auto print = [&out](const G4String& name, G4double s1, G4double s2, 
+                      G4double n1, G4double c1, G4double c2, G4double n2,
+                      G4double unit) {
+    G4double mean1 = s1/n1;
+    G4double mean2 = c1/n2;
+    G4double err = std::sqrt(std::max(s2/n1 - mean1*mean1, 0.0)/n1 
+                             + std::max(c2/n2 - mean2*mean2, 0.0)/n2);
+    out << "   " << std::setw(24) << std::left << name << std::right
+        << " fresh= " << std::setw(11) << mean1/unit 
+        << " cached= " << std::setw(11) << mean2/unit;
+    if(err > 0.0) { out << " bias= " << (mean2 - mean1)/err << " sigma"; }
+    out << G4endl;
+  };
+  print("<multiplicity>", fFreshStat.fMult, fFreshStat.fMult2, fFreshStat.fN,
+        fCachedStat.fMult, fCachedStat.fMult2, fCachedStat.fN, 1.0);
+  print("<sum Ekin> (MeV)", fFreshStat.fEkin, fFreshStat.fEkin2, 
+        fFreshStat.fN, fCachedStat.fEkin, fCachedStat.fEkin2, 
+        fCachedStat.fN, CLHEP::MeV);
+  print("<E imbalance> (MeV)", fFreshStat.fImbalance, fFreshStat.fImbalance2,
+        fFreshStat.fN, fCachedStat.fImbalance, fCachedStat.fImbalance2, 
+        fCachedStat.fN, CLHEP::MeV);
+}
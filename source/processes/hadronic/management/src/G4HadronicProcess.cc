@@ -48,6 +48,7 @@
 // 28-Sep-2012 Restore inheritance from G4VDiscreteProcess, remove enable-flag
 //		changing, remove warning message from original ctor.
 // 21-Aug-2019 V.Ivanchenko leave try/catch only for ApplyYourself(..), cleanup 
+// 19-Oct-2026 optional reservoir of pre-generated final states
 
 #include "G4HadronicProcess.hh"
 
@@ -65,6 +66,8 @@
 
 #include "G4HadronicException.hh"
 #include "G4HadronicProcessStore.hh"
+#include "G4HadronicParameters.hh"
+#include "G4HadFinalStateReservoir.hh"
 #include "G4VCrossSectionDataSet.hh"
 
 #include "G4NistManager.hh"
@@ -102,6 +105,13 @@ G4HadronicProcess::G4HadronicProcess(const G4String& processName,
 G4HadronicProcess::~G4HadronicProcess()
 {
   theProcessStore->DeRegister(this);
+  if(nullptr != theReservoir) {
+    if(G4HadronicParameters::Instance()->GetVerboseLevel() > 0) {
+      G4cout << "### " << GetProcessName() << G4endl;
+      theReservoir->DumpStatistics(G4cout);
+    }
+    delete theReservoir;
+  }
   delete theTotalResult;
   delete theCrossSectionDataStore;
 }
@@ -110,6 +120,7 @@ void G4HadronicProcess::InitialiseLocal() {
   theTotalResult = new G4ParticleChange();
   theTotalResult->SetSecondaryWeightByProcess(true);
   theInteraction = nullptr;
+  theReservoir = nullptr;
   theCrossSectionDataStore = new G4CrossSectionDataStore();
   theProcessStore = G4HadronicProcessStore::Instance();
   theProcessStore->Register(this);
@@ -182,6 +193,18 @@ void G4HadronicProcess::BuildPhysicsTable(const G4ParticleDefinition& p)
 {
   theCrossSectionDataStore->BuildPhysicsTable(p);
   theEnergyRangeManager.BuildPhysicsTable(p);
+
+  // the final state reservoir is an opt-in approximation for inelastic
+  // processes; each thread owns its own process, hence its own reservoir
+  G4HadronicParameters* param = G4HadronicParameters::Instance();
+  if(nullptr == theReservoir && GetProcessSubType() == fHadronInelastic &&
+     param->GetFinalStateReservoirSize() > 0) {
+    theReservoir = 
+      new G4HadFinalStateReservoir(param->GetFinalStateReservoirSize(),
+                                   param->GetFinalStateReservoirBinsPerDecade(),
+                                   param->GetFinalStateRefreshFraction(),
+                                   param->GetFinalStateValidationFraction());
+  }
   G4HadronicProcessStore::Instance()->PrintInfo(&p);
 }
 
@@ -263,6 +286,11 @@ G4HadronicProcess::PostStepDoIt(const G4Track& aTrack, const G4Step&)
 
   G4HadFinalState* result = nullptr;
   G4int reentryCount = 0;
+
+  // Final state from the reservoir, if enabled and the bin is filled
+  if(nullptr != theReservoir) {
+    result = theReservoir->Sample(thePro, targetNucleus, theInteraction);
+  }
   /* 
   G4cout << "### " << aParticle->GetDefinition()->GetParticleName() 
 	 << "  Ekin(MeV)= " << aParticle->GetKineticEnergy()
@@ -271,48 +299,54 @@ G4HadronicProcess::PostStepDoIt(const G4Track& aTrack, const G4Step&)
 	 << "  by " << theInteraction->GetModelName() 
 	 << G4endl;
   */
-  do
-  {
-    try
+  if(nullptr == result) {
+    do
     {
-      // Save random engine if requested for debugging
-      if (G4Hadronic_Random_File) {
-         CLHEP::HepRandom::saveEngineStatus(G4Hadronic_Random_File);
+      try
+      {
+        // Save random engine if requested for debugging
+        if (G4Hadronic_Random_File) {
+           CLHEP::HepRandom::saveEngineStatus(G4Hadronic_Random_File);
+        }
+        // Call the interaction
+        result = theInteraction->ApplyYourself( thePro, targetNucleus);
+        ++reentryCount;
       }
-      // Call the interaction
-      result = theInteraction->ApplyYourself( thePro, targetNucleus);
-      ++reentryCount;
-    }
-    catch(G4HadronicException & aR)
-    {
-      G4ExceptionDescription ed;
-      aR.Report(ed);
-      ed << "Call for " << theInteraction->GetModelName() << G4endl;
-      ed << "Target element "<<anElement->GetName()<<"  Z= "
-	 << targetNucleus.GetZ_asInt()
-	 << "  A= " << targetNucleus.GetA_asInt() << G4endl;
-      DumpState(aTrack,"ApplyYourself",ed);
-      ed << " ApplyYourself failed" << G4endl;
-      G4Exception("G4HadronicProcess::PostStepDoIt", "had006", FatalException,
+      catch(G4HadronicException & aR)
+      {
+        G4ExceptionDescription ed;
+        aR.Report(ed);
+        ed << "Call for " << theInteraction->GetModelName() << G4endl;
+        ed << "Target element "<<anElement->GetName()<<"  Z= "
+	   << targetNucleus.GetZ_asInt()
+	   << "  A= " << targetNucleus.GetA_asInt() << G4endl;
+        DumpState(aTrack,"ApplyYourself",ed);
+        ed << " ApplyYourself failed" << G4endl;
+        G4Exception("G4HadronicProcess::PostStepDoIt", "had006", FatalException,
 		  ed);
-    }
-
-    // Check the result for catastrophic energy non-conservation
-    result = CheckResult(thePro, targetNucleus, result);
+      }
 
-    if(reentryCount>100) {
-      G4ExceptionDescription ed;
-      ed << "Call for " << theInteraction->GetModelName() << G4endl;
-      ed << "Target element "<<anElement->GetName()<<"  Z= "
-	 << targetNucleus.GetZ_asInt()
-	 << "  A= " << targetNucleus.GetA_asInt() << G4endl;
-      DumpState(aTrack,"ApplyYourself",ed);
-      ed << " ApplyYourself does not completed after 100 attempts" << G4endl;
-      G4Exception("G4HadronicProcess::PostStepDoIt", "had006", FatalException,
+      // Check the result for catastrophic energy non-conservation
+      result = CheckResult(thePro, targetNucleus, result);
+
+      if(reentryCount>100) {
+        G4ExceptionDescription ed;
+        ed << "Call for " << theInteraction->GetModelName() << G4endl;
+        ed << "Target element "<<anElement->GetName()<<"  Z= "
+	   << targetNucleus.GetZ_asInt()
+	   << "  A= " << targetNucleus.GetA_asInt() << G4endl;
+        DumpState(aTrack,"ApplyYourself",ed);
+        ed << " ApplyYourself does not completed after 100 attempts" << G4endl;
+        G4Exception("G4HadronicProcess::PostStepDoIt", "had006", FatalException,
 		  ed);
+      }
+    }
+    while(!result);  /* Loop checking, 30-Oct-2015, G.Folger */
+
+    if(nullptr != theReservoir) {
+      theReservoir->Store(thePro, targetNucleus, result);
     }
   }
-  while(!result);  /* Loop checking, 30-Oct-2015, G.Folger */
 
   // Check whether kaon0 or anti_kaon0 are present between the secondaries: 
   // if this is the case, transform them into either kaon0S or kaon0L,
@@ -0,0 +1,74 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// Walker alias tables for the rows of a G4CascadeData cross-section
+// or multiplicity array, one table per energy bin.  Used by
+// G4CascadeSampler::sampleAlias() to select multiplicities and final-state
+// channels in O(1), instead of summing interpolated cross sections.
+//
+// 20261019  New class for alias-table sampling of channel tables
+
+#ifndef G4_CASCADE_ALIAS_TABLE_HH
+#define G4_CASCADE_ALIAS_TABLE_HH
+
+#include "globals.hh"
+#include <vector>
+
+
+template <int NBINS>
+class G4CascadeAliasTable {
+public:
+  enum { energyBins=NBINS };
+
+  // Tables are built for rows [startRow,stopRow) of x
+  G4CascadeAliasTable(const G4double x[][energyBins],
+		      G4int startRow, G4int stopRow);
+
+  virtual ~G4CascadeAliasTable() {}
+
+  // False if any tabulated value is negative
+  G4bool isValid() const { return valid; }
+
+  G4int size() const { return nRows; }
+
+  // Sum of all rows at given energy bin
+  G4double sum(G4int bin) const { return total[bin]; }
+
+  // Row index (relative to startRow) sampled at given energy bin
+  G4int sample(G4int bin, G4double rndm) const;
+
+private:
+  G4int nRows;
+  G4bool valid;
+  std::vector<G4double> total;		// Sum per energy bin
+  std::vector<G4double> prob;		// Acceptance [bin*nRows+row]
+  std::vector<G4int> alias;		// Alias index [bin*nRows+row]
+};
+
+#include "G4CascadeAliasTable.icc"
+
+#endif	/* G4_CASCADE_ALIAS_TABLE_HH */
@@ -47,6 +47,7 @@
 #define G4_CASCADE_FUNCTIONS_HH
 
 #include "G4CascadeChannel.hh"
+#include "G4CascadeAliasTable.hh"
 #include "globals.hh"
 #include "Randomize.hh"
 #include <vector>
@@ -72,6 +73,13 @@ public:
 				       G4int mult, G4double ke) const;
 
   virtual void printTable(std::ostream& os=G4cout) const;
+
+private:
+  typedef G4CascadeAliasTable<SAMP::energyBins> AliasTable;
+
+  // Alias tables built once from DATA, shared by all threads
+  static const AliasTable& multiplicityTable();
+  static const AliasTable& finalStateTable(G4int mult);
 };
 
 #include "G4CascadeFunctions.icc"
@@ -78,6 +78,7 @@ private:
   G4UIcmdWithABool*     historyCmd;
   G4UIcmdWithABool*     use3BodyCmd;
   G4UIcmdWithABool*     usePSCmd;
+  G4UIcmdWithABool*     useAliasCmd;
   G4UIcmdWithAString*   randomFileCmd;
   G4UIcmdWithABool*     nucUseBestCmd;
   G4UIcmdWithADouble*   nucRad2parCmd;
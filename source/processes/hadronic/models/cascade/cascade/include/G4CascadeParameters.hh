@@ -58,6 +58,7 @@ public:
   static G4bool showHistory()         { return Instance()->SHOW_HISTORY; }
   static G4bool use3BodyMom()	      { return Instance()->USE_3BODYMOM; }
   static G4bool usePhaseSpace()       { return Instance()->USE_PHASESPACE; }
+  static G4bool useAliasSampling()    { return Instance()->USE_ALIAS; }
   static G4double piNAbsorption()     { return Instance()->PIN_ABSORPTION; }
   static const G4String& randomFile() { return Instance()->RANDOM_FILE; }
 
@@ -86,6 +87,7 @@ private:	// Environment variable values, null pointers mean not set
   const char* G4CASCADE_SHOW_HISTORY;
   const char* G4CASCADE_USE_3BODYMOM;
   const char* G4CASCADE_USE_PHASESPACE;
+  const char* G4CASCADE_USE_ALIAS;
   const char* G4CASCADE_PIN_ABSORPTION;
   const char* G4CASCADE_RANDOM_FILE;
   const char* G4NUCMODEL_USE_BEST;
@@ -110,6 +112,7 @@ private:	// Environment variable values, null pointers mean not set
   G4bool SHOW_HISTORY;
   G4bool USE_3BODYMOM;
   G4bool USE_PHASESPACE;
+  G4bool USE_ALIAS;
   G4double PIN_ABSORPTION;
   G4String RANDOM_FILE;
 
@@ -32,12 +32,14 @@
 //		binning, as base to new sampler.
 // 20100803  M. Kelsey -- Add print function for debugging.
 // 20110923  M. Kelsey -- Add optional ostream& argument to print()
+// 20261019  Add sampleAlias() using precomputed G4CascadeAliasTable
 
 #ifndef G4_CASCADE_SAMPLER_HH
 #define G4_CASCADE_SAMPLER_HH
 
 #include "globals.hh"
 #include "G4CascadeInterpolator.hh"
+#include "G4CascadeAliasTable.hh"
 #include <iosfwd>
 #include <vector>
 
@@ -61,6 +63,10 @@ public:
   findFinalStateIndex(G4int mult, G4double ke, const G4int index[],
 		      const G4double xsec[][energyBins]) const;
 
+  // Row index from alias tables, mixing the two energy bins around ke
+  // with their interpolation weights; -1 if outside tabulated energies
+  G4int sampleAlias(G4double ke, const G4CascadeAliasTable<NBINS>& table) const;
+
   virtual void print(std::ostream& os) const;
 
 private:
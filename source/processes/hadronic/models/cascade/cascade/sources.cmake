@@ -29,6 +29,8 @@ geant4_add_module(G4hadronic_bert_cascade
     G4Analyser.hh
     G4BigBanger.hh
     G4CascadParticle.hh
+    G4CascadeAliasTable.hh
+    G4CascadeAliasTable.icc
     G4CascadeChannel.hh
     G4CascadeChannelTables.hh
     G4CascadeCheckBalance.hh
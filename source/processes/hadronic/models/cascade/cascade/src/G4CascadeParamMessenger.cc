@@ -34,6 +34,7 @@
 // 20141030  M. Kelsey -- Add flag to enable direct pi-N absorption
 // 20141211  M. Kelsey -- Change PIN_ABSORPTION flag to G4double, for energy cut
 // 20200110  M. Kelsey -- Reset cmdDir to 0 before .../cascade/ directory.
+// 20261019  Add flag for USE_ALIAS
 
 #include "G4CascadeParamMessenger.hh"
 #include "G4CascadeParameters.hh"
@@ -74,6 +75,8 @@ G4CascadeParamMessenger::G4CascadeParamMessenger(G4CascadeParameters* params)
 			"Use three-body momentum parametrizations");
   usePSCmd = CreateCommand<G4UIcmdWithABool>("usePhaseSpace",
 			"Use Kopylov N-body momentum generator");
+  useAliasCmd = CreateCommand<G4UIcmdWithABool>("useAliasSampling",
+			"Use alias tables to sample multiplicity and channel");
   randomFileCmd = CreateCommand<G4UIcmdWithAString>("randomFile",
 			"Save random-engine to file at each interaction");
   nucUseBestCmd = CreateCommand<G4UIcmdWithABool>("useBestNuclearModel",
@@ -112,6 +115,7 @@ G4CascadeParamMessenger::~G4CascadeParamMessenger() {
   delete historyCmd;
   delete use3BodyCmd;
   delete usePSCmd;
+  delete useAliasCmd;
   delete randomFileCmd;
   delete nucUseBestCmd;
   delete nucRad2parCmd;
@@ -182,6 +186,9 @@ void G4CascadeParamMessenger::SetNewValue(G4UIcommand* cmd, G4String arg) {
   if (cmd == usePSCmd)
     theParams->G4CASCADE_USE_PHASESPACE = StoB(arg) ? strdup(arg.c_str()) : 0;
 
+  if (cmd == useAliasCmd)
+    theParams->G4CASCADE_USE_ALIAS = StoB(arg) ? strdup(arg.c_str()) : 0;
+
   if (cmd == randomFileCmd)
     theParams->G4CASCADE_RANDOM_FILE = arg.empty() ? 0 : strdup(arg.c_str());
 
@@ -40,6 +40,7 @@
 //		and trailing effect.
 // 20141121  Use G4AutoDelete to avoid end-of-thread memory leaks
 // 20141211  M. Kelsey -- Change PIN_ABSORPTION flag to G4double, for energy cut
+// 20261019  Add flag to use alias tables for channel sampling
 
 #include "G4CascadeParameters.hh"
 #include "G4CascadeParamMessenger.hh"
@@ -91,6 +92,7 @@ G4CascadeParameters::G4CascadeParameters()
     G4CASCADE_SHOW_HISTORY(std::getenv("G4CASCADE_SHOW_HISTORY")),
     G4CASCADE_USE_3BODYMOM(std::getenv("G4CASCADE_USE_3BODYMOM")),
     G4CASCADE_USE_PHASESPACE(std::getenv("G4CASCADE_USE_PHASESPACE")),
+    G4CASCADE_USE_ALIAS(std::getenv("G4CASCADE_USE_ALIAS")),
     G4CASCADE_PIN_ABSORPTION(std::getenv("G4CASCADE_PIN_ABSORPTION")),
     G4CASCADE_RANDOM_FILE(std::getenv("G4CASCADE_RANDOM_FILE")),
     G4NUCMODEL_USE_BEST(std::getenv("G4NUCMODEL_USE_BEST")),
@@ -121,6 +123,7 @@ void G4CascadeParameters::Initialize() {
   USE_3BODYMOM = (0!=G4CASCADE_USE_3BODYMOM);
   USE_PHASESPACE = (0!=G4CASCADE_USE_PHASESPACE &&
 		    G4CASCADE_USE_PHASESPACE[0]!='0');
+  USE_ALIAS = (0!=G4CASCADE_USE_ALIAS && G4CASCADE_USE_ALIAS[0]!='0');
   PIN_ABSORPTION = (G4CASCADE_PIN_ABSORPTION ? strtod(G4CASCADE_PIN_ABSORPTION,0)
 		    : 0.);
   RANDOM_FILE = (G4CASCADE_RANDOM_FILE ? G4CASCADE_RANDOM_FILE : "");
@@ -172,6 +175,8 @@ void G4CascadeParameters::DumpConfig(std::ostream& os) const {
     os << "G4CASCADE_USE_3BODYMOM = " << G4CASCADE_USE_3BODYMOM << endl;
   if (G4CASCADE_USE_PHASESPACE)
     os << "G4CASCADE_USE_PHASESPACE = " << G4CASCADE_USE_PHASESPACE << endl;
+  if (G4CASCADE_USE_ALIAS)
+    os << "G4CASCADE_USE_ALIAS = " << G4CASCADE_USE_ALIAS << endl;
   if (G4CASCADE_RANDOM_FILE)
     os << "G4CASCADE_RANDOM_FILE = " << G4CASCADE_RANDOM_FILE << endl;
   if (G4NUCMODEL_USE_BEST)
@@ -60,6 +60,7 @@ class G4VMultiFragmentation;
 class G4VFermiBreakUp;
 class G4VEvaporation;
 class G4VEvaporationChannel;
+class G4HadFinalState;
 
 class G4ExcitationHandler 
 {
@@ -70,6 +71,15 @@ public:
 
   G4ReactionProductVector* BreakItUp(const G4Fragment &theInitialState);
 
+  // products are added to the existing vector
+  void BreakItUp(const G4Fragment &theInitialState,
+                 G4ReactionProductVector* products);
+
+  // products are added directly as secondaries of the final state,
+  // time is added to the formation time of each product
+  void BreakItUp(const G4Fragment &theInitialState,
+                 G4HadFinalState &theFinalState, G4double time);
+
   // short model description used for automatic web documentation
   void ModelDescription(std::ostream& outFile) const;
 
@@ -108,6 +118,14 @@ private:
 
   void SetParameters();
 
+  // de-excitation chain, final fragments are stored in theResults
+  void DeExcite(const G4Fragment &theInitialState);
+
+  // particle definition, momentum and total energy of a final fragment
+  const G4ParticleDefinition* SecondaryDefinition(G4Fragment*, 
+                                                  G4ThreeVector& mom,
+                                                  G4double& etot);
+
   inline void SortSecondaryFragment(G4Fragment*);
 
   G4ExcitationHandler(const G4ExcitationHandler &right);
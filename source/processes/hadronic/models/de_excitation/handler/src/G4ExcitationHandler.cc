@@ -84,6 +84,8 @@
 #include "G4NuclearLevelData.hh"
 #include "G4Pow.hh"
 #include "G4PhysicsModelCatalog.hh"
+#include "G4HadFinalState.hh"
+#include "G4DynamicParticle.hh"
 
 G4ExcitationHandler::G4ExcitationHandler()
   : icID(0),maxZForFermiBreakUp(9),maxAForFermiBreakUp(17),
@@ -279,6 +281,71 @@ G4VEvaporationChannel* G4ExcitationHandler::GetPhotonEvaporation()
 
 G4ReactionProductVector * 
 G4ExcitationHandler::BreakItUp(const G4Fragment & theInitialState)
+{
+  G4ReactionProductVector * theReactionProductVector = 
+    new G4ReactionProductVector();
+  BreakItUp(theInitialState, theReactionProductVector);
+  return theReactionProductVector;
+}
+
+void 
+G4ExcitationHandler::BreakItUp(const G4Fragment & theInitialState,
+                               G4ReactionProductVector * theReactionProductVector)
+{
+  DeExcite(theInitialState);
+
+  // MAC (24/07/08)
+  // To optimise the storing speed, we reserve space 
+  // in memory for the vector
+  theReactionProductVector->reserve(theReactionProductVector->size() 
+                                    + theResults.size());
+
+  G4ThreeVector mom;
+  G4double etot;
+  for (auto & frag : theResults) {
+    const G4ParticleDefinition* part = SecondaryDefinition(frag, mom, etot);
+    if(part) {
+      G4ReactionProduct * theNew = new G4ReactionProduct(part);
+      theNew->SetMomentum(mom);
+      theNew->SetTotalEnergy(etot);
+      theNew->SetFormationTime(frag->GetCreationTime());
+      theNew->SetCreatorModelID((part == theElectron) ? icID 
+                                : frag->GetCreatorModelID());
+      theReactionProductVector->push_back(theNew);
+    }
+    delete frag;
+  }
+  if(fVerbose > 3) { 	
+    G4cout << "@@@@@@@@@@ End G4Excitation Handler "<< G4endl;
+  }
+}
+
+void 
+G4ExcitationHandler::BreakItUp(const G4Fragment & theInitialState,
+                               G4HadFinalState & theFinalState,
+                               G4double time)
+{
+  DeExcite(theInitialState);
+
+  G4ThreeVector mom;
+  G4double etot;
+  for (auto & frag : theResults) {
+    const G4ParticleDefinition* part = SecondaryDefinition(frag, mom, etot);
+    if(part) {
+      G4HadSecondary aNew(new G4DynamicParticle(part, etot, mom));
+      aNew.SetTime(time + std::max(frag->GetCreationTime(), 0.0));
+      aNew.SetCreatorModelID((part == theElectron) ? icID 
+                             : frag->GetCreatorModelID());
+      theFinalState.AddSecondary(aNew);
+    }
+    delete frag;
+  }
+  if(fVerbose > 3) { 	
+    G4cout << "@@@@@@@@@@ End G4Excitation Handler "<< G4endl;
+  }
+}
+
+void G4ExcitationHandler::DeExcite(const G4Fragment & theInitialState)
 {
   // Variables existing until end of method
   G4Fragment * theInitialStatePtr = new G4Fragment(theInitialState);
@@ -425,123 +492,96 @@ G4ExcitationHandler::BreakItUp(const G4Fragment & theInitialState)
            << " was evap;  "
 	   << theResults.size() << " results. " << G4endl; 
   }
-  G4ReactionProductVector * theReactionProductVector = 
-    new G4ReactionProductVector();
-
-  // MAC (24/07/08)
-  // To optimise the storing speed, we reserve space 
-  // in memory for the vector
-  theReactionProductVector->reserve( theResults.size() );
-
   if(fVerbose > 2) { 	
     G4cout << "### ExcitationHandler provides " << theResults.size() 
 	   << " evaporated products:" << G4endl;
   }
-  for (auto & frag : theResults) {
+}
 
-    // in the case of dummy de-excitation, excitation energy is transfered 
-    // into kinetic energy of output ion
-    if(!isActive) {
-      G4double mass = frag->GetGroundStateMass();
-      G4double ptot = (frag->GetMomentum()).vect().mag();
-      G4double etot = (frag->GetMomentum()).e();
-      G4double fac  = (etot <= mass || 0.0 == ptot) ? 0.0 
-	: std::sqrt((etot - mass)*(etot + mass))/ptot; 
-      G4LorentzVector lv((frag->GetMomentum()).px()*fac, 
-			 (frag->GetMomentum()).py()*fac,
-			 (frag->GetMomentum()).pz()*fac, etot);
-      frag->SetMomentum(lv);
-    }
-    if(fVerbose > 3) { 
-      G4cout << *frag;
-      if(frag->NuclearPolarization()) { 
-	G4cout << "  " << frag->NuclearPolarization(); 
-      }
-      G4cout << G4endl;
+const G4ParticleDefinition* 
+G4ExcitationHandler::SecondaryDefinition(G4Fragment* frag, 
+                                         G4ThreeVector& mom, G4double& etot)
+{
+  // in the case of dummy de-excitation, excitation energy is transfered 
+  // into kinetic energy of output ion
+  if(!isActive) {
+    G4double mass = frag->GetGroundStateMass();
+    G4double ptot = (frag->GetMomentum()).vect().mag();
+    etot = (frag->GetMomentum()).e();
+    G4double fac  = (etot <= mass || 0.0 == ptot) ? 0.0 
+      : std::sqrt((etot - mass)*(etot + mass))/ptot; 
+    G4LorentzVector lv((frag->GetMomentum()).px()*fac, 
+                       (frag->GetMomentum()).py()*fac,
+                       (frag->GetMomentum()).pz()*fac, etot);
+    frag->SetMomentum(lv);
+  }
+  if(fVerbose > 3) { 
+    G4cout << *frag;
+    if(frag->NuclearPolarization()) { 
+      G4cout << "  " << frag->NuclearPolarization(); 
     }
+    G4cout << G4endl;
+  }
 
-    G4int fragmentA = frag->GetA_asInt();
-    G4int fragmentZ = frag->GetZ_asInt();
-    G4double etot= frag->GetMomentum().e();
-    G4double eexc = 0.0;
-    const G4ParticleDefinition* theKindOfFragment = nullptr;
-    if (fragmentA == 0) {       // photon or e-
-      theKindOfFragment = frag->GetParticleDefinition();   
-    } else if (fragmentA == 1 && fragmentZ == 0) { // neutron
-      theKindOfFragment = theNeutron;
-    } else if (fragmentA == 1 && fragmentZ == 1) { // proton
-      theKindOfFragment = theProton;
-    } else if (fragmentA == 2 && fragmentZ == 1) { // deuteron
-      theKindOfFragment = theDeuteron;
-    } else if (fragmentA == 3 && fragmentZ == 1) { // triton
-      theKindOfFragment = theTriton;
-    } else if (fragmentA == 3 && fragmentZ == 2) { // helium3
-      theKindOfFragment = theHe3;
-    } else if (fragmentA == 4 && fragmentZ == 2) { // alpha
-      theKindOfFragment = theAlpha;
-    } else {
+  G4int fragmentA = frag->GetA_asInt();
+  G4int fragmentZ = frag->GetZ_asInt();
+  etot = frag->GetMomentum().e();
+  mom = frag->GetMomentum().vect();
+  G4double eexc = 0.0;
+  const G4ParticleDefinition* theKindOfFragment = nullptr;
+  if (fragmentA == 0) {       // photon or e-
+    theKindOfFragment = frag->GetParticleDefinition();   
+  } else if (fragmentA == 1 && fragmentZ == 0) { // neutron
+    theKindOfFragment = theNeutron;
+  } else if (fragmentA == 1 && fragmentZ == 1) { // proton
+    theKindOfFragment = theProton;
+  } else if (fragmentA == 2 && fragmentZ == 1) { // deuteron
+    theKindOfFragment = theDeuteron;
+  } else if (fragmentA == 3 && fragmentZ == 1) { // triton
+    theKindOfFragment = theTriton;
+  } else if (fragmentA == 3 && fragmentZ == 2) { // helium3
+    theKindOfFragment = theHe3;
+  } else if (fragmentA == 4 && fragmentZ == 2) { // alpha
+    theKindOfFragment = theAlpha;
+  } else {
 
-      // fragment
-      eexc = frag->GetExcitationEnergy();
-      G4int idxf = frag->GetFloatingLevelNumber();
-      if(eexc < minExcitation) { 
-	eexc = 0.0; 
-        idxf = 0;
-      }
+    // fragment
+    eexc = frag->GetExcitationEnergy();
+    G4int idxf = frag->GetFloatingLevelNumber();
+    if(eexc < minExcitation) { 
+      eexc = 0.0; 
+      idxf = 0;
+    }
 
-      theKindOfFragment = theTableOfIons->GetIon(fragmentZ,fragmentA,eexc,
-                                                 G4Ions::FloatLevelBase(idxf));
-      if(fVerbose > 3) {
-	G4cout << "### EXCH: Find ion Z= " << fragmentZ 
-               << " A= " << fragmentA
-	       << " Eexc(MeV)= " << eexc/MeV << " idx= " << idxf 
-	       << G4endl;
-      }
+    theKindOfFragment = theTableOfIons->GetIon(fragmentZ,fragmentA,eexc,
+                                               G4Ions::FloatLevelBase(idxf));
+    if(fVerbose > 3) {
+      G4cout << "### EXCH: Find ion Z= " << fragmentZ 
+             << " A= " << fragmentA
+             << " Eexc(MeV)= " << eexc/MeV << " idx= " << idxf 
+             << G4endl;
     }
-    // fragment identified
+  }
+  // fragment not found out ground state is created
+  if(!theKindOfFragment) { 
+    theKindOfFragment = 
+      theTableOfIons->GetIon(fragmentZ,fragmentA,0.0,noFloat,0);
     if(theKindOfFragment) {
-      G4ReactionProduct * theNew = new G4ReactionProduct(theKindOfFragment);
-      theNew->SetMomentum(frag->GetMomentum().vect());
-      theNew->SetTotalEnergy(etot);
-      theNew->SetFormationTime(frag->GetCreationTime());
-      if(theKindOfFragment == theElectron) {
-	theNew->SetCreatorModelID(icID);
+      mom.set(0.0,0.0,0.0); 
+      G4double ionmass = theKindOfFragment->GetPDGMass();
+      if(etot <= ionmass) {
+        etot = ionmass;
       } else {
-	theNew->SetCreatorModelID(frag->GetCreatorModelID());
+        G4double ptot = std::sqrt((etot - ionmass)*(etot + ionmass));
+        mom = (frag->GetMomentum().vect().unit())*ptot;
       }
-      theReactionProductVector->push_back(theNew);
-
-      // fragment not found out ground state is created
-    } else { 
-      theKindOfFragment = 
-	theTableOfIons->GetIon(fragmentZ,fragmentA,0.0,noFloat,0);
-      if(theKindOfFragment) {
-	G4ThreeVector mom(0.0,0.0,0.0); 
-	G4double ionmass = theKindOfFragment->GetPDGMass();
-	if(etot <= ionmass) {
-	  etot = ionmass;
-	} else {
-	  G4double ptot = std::sqrt((etot - ionmass)*(etot + ionmass));
-	  mom = (frag->GetMomentum().vect().unit())*ptot;
-	}
-	G4ReactionProduct * theNew = new G4ReactionProduct(theKindOfFragment);
-	theNew->SetMomentum(mom);
-	theNew->SetTotalEnergy(etot);
-	theNew->SetFormationTime(frag->GetCreationTime());
-	theNew->SetCreatorModelID(frag->GetCreatorModelID());
-	theReactionProductVector->push_back(theNew);
-	if(fVerbose > 3) {
-	  G4cout << "          ground state, energy corrected E(MeV)= " 
-                 << etot << G4endl;
-	}
+      if(fVerbose > 3) {
+        G4cout << "          ground state, energy corrected E(MeV)= " 
+               << etot << G4endl;
       }
     }
-    delete frag;
   }
-  if(fVerbose > 3) { 	
-    G4cout << "@@@@@@@@@@ End G4Excitation Handler "<< G4endl;
-  }
-  return theReactionProductVector;
+  return theKindOfFragment;
 }
 
 void G4ExcitationHandler::ModelDescription(std::ostream& outFile) const
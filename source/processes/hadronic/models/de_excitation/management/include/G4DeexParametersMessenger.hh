@@ -89,6 +89,9 @@ private:
   G4UIcmdWithAnInteger*      maxjCmd;
   G4UIcmdWithAnInteger*      verbCmd;
 
+  G4UIcmdWithAString*        storeCmd;
+  G4UIcmdWithAString*        retrieveCmd;
+
 };
 
 #endif
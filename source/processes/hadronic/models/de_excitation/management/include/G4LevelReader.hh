@@ -67,6 +67,14 @@ public:
   const G4LevelManager* MakeLevelManager(G4int Z, G4int A,
 					 const G4String& filename);
 
+  // create level manager from a record of the binary level data file
+  const G4LevelManager* ReadBinaryLevelManager(G4int Z, G4int A,
+                                               std::istream& in);
+
+  // write level manager as a record of the binary level data file;
+  // nullptr is written as a record without levels
+  void WriteBinaryLevelManager(const G4LevelManager* man, std::ostream& out);
+
   inline void SetVerbose(G4int val);
   
 private:
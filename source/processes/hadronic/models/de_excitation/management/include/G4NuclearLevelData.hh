@@ -42,6 +42,13 @@
 //
 // Nuclear level data uploaded at initialisation of Geant4 from 
 // data files of the G4LEVELGAMMADATA
+//
+// Level managers are created on first request and shared between
+// threads; the lookup of an already created manager does not lock.
+// Instead of the text data files, a binary file written by 
+// StoreLevelData() may be used as the source of the level data, 
+// either via RetrieveLevelData() or via the environment variable 
+// G4LEVELGAMMABINARY
 // 
 
 #ifndef G4NUCLEARLEVELDATA_HH
@@ -52,6 +59,10 @@
 #include "G4Threading.hh"
 #include <vector>
 #include <iostream>
+#include <fstream>
+#include <atomic>
+#include <memory>
+#include <cstdint>
 
 class G4LevelReader;
 class G4LevelManager;
@@ -114,11 +125,24 @@ public:
   // stream only existing levels
   void StreamLevels(std::ostream& os, G4int Z, G4int A);
 
+  // write level data of all isotopes into a binary file
+  G4bool StoreLevelData(const G4String& filename);
+
+  // use binary file written by StoreLevelData as the source of level data
+  G4bool RetrieveLevelData(const G4String& filename);
+
   G4NuclearLevelData(G4NuclearLevelData &) = delete;
   G4NuclearLevelData & operator=(const G4NuclearLevelData &right) = delete;
 
 private:
 
+  // create level manager from binary or text data, called under lock
+  const G4LevelManager* CreateLevelManager(G4int Z, G4int A);
+
+  G4bool OpenBinaryFile(const G4String& filename);
+
+  inline G4bool UseBinaryData() const;
+
   G4DeexPrecoParameters* fDeexPrecoParameters;
   G4LevelReader*         fLevelReader;
   G4PairingCorrection*   fPairingCorrection;
@@ -131,12 +155,23 @@ private:
   static const G4int AMAX[ZMAX];
   static const G4int LEVELIDX[ZMAX];
 
-  std::vector<const G4LevelManager*> fLevelManagers[ZMAX];
-  std::vector<G4bool> fLevelManagerFlags[ZMAX];
+  std::unique_ptr<std::atomic<const G4LevelManager*>[]> fLevelManagers[ZMAX];
+  std::unique_ptr<std::atomic<G4bool>[]> fLevelManagerFlags[ZMAX];
+
+  // binary level data: record offsets per isotope, -1 if absent
+  std::ifstream fBinaryFile;
+  std::vector<std::int64_t> fBinaryOffsets[ZMAX];
+  G4bool fBinaryICData;
 
 #ifdef G4MULTITHREADED
   static G4Mutex nuclearLevelDataMutex;
 #endif
 };
 
+inline G4bool G4NuclearLevelData::UseBinaryData() const
+{
+  return (fBinaryFile.is_open() && 
+          fBinaryICData == fDeexPrecoParameters->StoreICLevelData());
+}
+
 #endif
@@ -55,6 +55,7 @@
 #include "G4UIcmdWithAString.hh"
 #include "G4UImanager.hh"
 #include "G4DeexPrecoParameters.hh"
+#include "G4NuclearLevelData.hh"
 
 #include <sstream>
 
@@ -101,6 +102,18 @@ G4DeexParametersMessenger::G4DeexParametersMessenger(G4DeexPrecoParameters* ptr)
   verbCmd->SetParameterName("verb",true);
   verbCmd->SetDefaultValue(1);
   verbCmd->AvailableForStates(G4State_PreInit);
+
+  storeCmd = new G4UIcmdWithAString("/process/had/deex/storeLevelData",this);
+  storeCmd->SetGuidance("Write nuclear level data of all isotopes into a binary file.");
+  storeCmd->SetParameterName("fname",false);
+  storeCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+  storeCmd->SetToBeBroadcasted(false);
+
+  retrieveCmd = new G4UIcmdWithAString("/process/had/deex/retrieveLevelData",this);
+  retrieveCmd->SetGuidance("Use binary file written by storeLevelData as nuclear level data.");
+  retrieveCmd->SetParameterName("fname",false);
+  retrieveCmd->AvailableForStates(G4State_PreInit);
+  retrieveCmd->SetToBeBroadcasted(false);
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -115,6 +128,8 @@ G4DeexParametersMessenger::~G4DeexParametersMessenger()
   delete isoCmd;
   delete maxjCmd;
   delete verbCmd;
+  delete storeCmd;
+  delete retrieveCmd;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -134,6 +149,10 @@ void G4DeexParametersMessenger::SetNewValue(G4UIcommand* command,
     theParameters->SetTwoJMAX(maxjCmd->GetNewIntValue(newValue));
   } else if (command == verbCmd) { 
     theParameters->SetVerbose(verbCmd->GetNewIntValue(newValue));
+  } else if (command == storeCmd) { 
+    G4NuclearLevelData::GetInstance()->StoreLevelData(newValue);
+  } else if (command == retrieveCmd) { 
+    G4NuclearLevelData::GetInstance()->RetrieveLevelData(newValue);
   }
 }
 
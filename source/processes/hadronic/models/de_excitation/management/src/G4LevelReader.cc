@@ -51,6 +51,20 @@
 #include <fstream>
 #include <sstream>
 
+namespace
+{
+  template <typename T> inline void WriteItem(std::ostream& out, const T& x)
+  {
+    out.write(reinterpret_cast<const char*>(&x), sizeof(T));
+  }
+
+  template <typename T> inline G4bool ReadItem(std::istream& in, T& x)
+  {
+    in.read(reinterpret_cast<char*>(&x), sizeof(T));
+    return !in.fail();
+  }
+}
+
 G4String G4LevelReader::fFloatingLevels[] = {
   "-", "+X", "+Y", "+Z", "+U", "+V", "+W", "+R", "+S", "+T", "+A", "+B", "+C"};
 
@@ -453,3 +467,107 @@ G4LevelReader::LevelManager(G4int Z, G4int A, G4int nlev,
 
   return lman;
 }
+
+const G4LevelManager* 
+G4LevelReader::ReadBinaryLevelManager(G4int Z, G4int A, std::istream& in)
+{
+  G4int nlevels = 0;
+  if(!ReadItem(in, nlevels) || nlevels <= 0) { return nullptr; }
+  if(nlevels > fLevelMax) {
+    fLevelMax = nlevels;
+    vEnergy.resize(fLevelMax,0.0);
+    vSpin.resize(fLevelMax,0);
+    vLevel.resize(fLevelMax,nullptr);
+  }
+  G4int i = 0;
+  for(; i<nlevels; ++i) {
+    if(!ReadItem(in, vEnergy[i]) || !ReadItem(in, vSpin[i]) 
+       || !ReadItem(in, ntrans)) { break; }
+    vLevel[i] = nullptr;
+    if(ntrans < 0) { continue; }
+    if(!ReadItem(in, fTime)) { break; }
+    if(ntrans > fTransMax) {
+      fTransMax = ntrans;
+      vTrans.resize(fTransMax);
+      vRatio.resize(fTransMax);
+      vGammaCumProbability.resize(fTransMax);
+      vGammaProbability.resize(fTransMax);
+      vShellProbability.resize(fTransMax);
+    }
+    G4bool ok = true;
+    for(G4int j=0; j<ntrans; ++j) {
+      G4int nshell = 0;
+      ok = ReadItem(in, vTrans[j]) && ReadItem(in, vGammaCumProbability[j])
+        && ReadItem(in, vGammaProbability[j]) && ReadItem(in, vRatio[j])
+        && ReadItem(in, nshell);
+      vShellProbability[j] = nullptr;
+      if(ok && nshell > 0) {
+        std::vector<G4float>* vec = new std::vector<G4float>(nshell, 0.0f);
+        in.read(reinterpret_cast<char*>(vec->data()), nshell*sizeof(G4float));
+        ok = !in.fail();
+        vShellProbability[j] = vec;
+      }
+      if(!ok) {
+        for(G4int jj=0; jj<=j; ++jj) { delete vShellProbability[jj]; }
+        break;
+      }
+    }
+    if(!ok) { break; }
+    vLevel[i] = new G4NucLevel((size_t)ntrans, fTime,
+                               vTrans,
+                               vGammaCumProbability,
+                               vGammaProbability,
+                               vRatio,
+                               vShellProbability);
+  }
+  if(i < nlevels) {
+    for(G4int j=0; j<i; ++j) { delete vLevel[j]; }
+    G4ExceptionDescription ed;
+    ed << "Binary level data for Z= " << Z << " A= " << A  
+       << " are corrupted"; 
+    G4Exception("G4LevelReader::ReadBinaryLevelManager(..)","had014",
+                FatalException, ed, "");
+    return nullptr;
+  }
+  if (fVerbose > 1) {
+    G4cout << "=== Reader: new manager for Z= " << Z << " A= " << A 
+           << " Nlevels= " << nlevels << " from binary data" << G4endl;
+  }
+  return new G4LevelManager(Z, A, (size_t)nlevels, vEnergy, vSpin, vLevel);
+}
+
+void G4LevelReader::WriteBinaryLevelManager(const G4LevelManager* man,
+                                            std::ostream& out)
+{
+  G4int nlevels = (man) ? G4int(man->NumberOfTransitions() + 1) : 0;
+  WriteItem(out, nlevels);
+  for(G4int i=0; i<nlevels; ++i) {
+    // spin code as encoded in LevelManager(..)
+    G4int spin = man->FloatingLevel(i)*100000 + 100 
+      + man->Parity(i)*man->SpinTwo(i);
+    G4double e = man->LevelEnergy(i);
+    WriteItem(out, e);
+    WriteItem(out, spin);
+    const G4NucLevel* level = man->GetLevel(i);
+    G4int nt = (level) ? G4int(level->NumberOfTransitions()) : -1;
+    WriteItem(out, nt);
+    if(!level) { continue; }
+    G4double time = level->GetTimeGamma();
+    WriteItem(out, time);
+    for(G4int j=0; j<nt; ++j) {
+      G4int trans = G4int(level->FinalExcitationIndex(j)*10000) 
+        + level->TransitionType(j);
+      WriteItem(out, trans);
+      WriteItem(out, level->GammaCumProbability(j));
+      WriteItem(out, level->GammaProbability(j));
+      WriteItem(out, level->MultipolarityRatio(j));
+      const std::vector<G4float>* vec = level->ShellProbabilty(j);
+      G4int nshell = (vec) ? G4int(vec->size()) : 0;
+      WriteItem(out, nshell);
+      if(nshell > 0) {
+        out.write(reinterpret_cast<const char*>(vec->data()),
+                  nshell*sizeof(G4float));
+      }
+    }
+  }
+}
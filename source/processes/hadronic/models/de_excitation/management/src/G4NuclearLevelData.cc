@@ -51,6 +51,8 @@
 #include "G4SystemOfUnits.hh"
 #include "G4Pow.hh"
 #include <iomanip>
+#include <cstdlib>
+#include <cstring>
 
 G4NuclearLevelData* G4NuclearLevelData::theInstance = nullptr;
 
@@ -442,13 +444,23 @@ G4NuclearLevelData::G4NuclearLevelData()
   fDeexPrecoParameters = new G4DeexPrecoParameters();
   fLevelReader = new G4LevelReader(this);
   for(G4int Z=0; Z<ZMAX; ++Z) {
-    (fLevelManagers[Z]).resize(AMAX[Z]-AMIN[Z]+1,nullptr);
-    (fLevelManagerFlags[Z]).resize(AMAX[Z]-AMIN[Z]+1,false);
+    const G4int nn = AMAX[Z]-AMIN[Z]+1;
+    fLevelManagers[Z].reset(new std::atomic<const G4LevelManager*>[nn]);
+    fLevelManagerFlags[Z].reset(new std::atomic<G4bool>[nn]);
+    for(G4int j=0; j<nn; ++j) {
+      fLevelManagers[Z][j].store(nullptr, std::memory_order_relaxed);
+      fLevelManagerFlags[Z][j].store(false, std::memory_order_relaxed);
+    }
   }
   fShellCorrection = new G4ShellCorrection();
   fPairingCorrection = new G4PairingCorrection();
   fG4calc = G4Pow::GetInstance();
   fInitialized = false;
+  fBinaryICData = false;
+
+  // the constructor is called under the lock of GetInstance()
+  const char* binfile = std::getenv("G4LEVELGAMMABINARY");
+  if(nullptr != binfile) { OpenBinaryFile(binfile); }
 }
 
 G4NuclearLevelData::~G4NuclearLevelData()
@@ -458,9 +470,9 @@ G4NuclearLevelData::~G4NuclearLevelData()
   delete fShellCorrection;
   delete fPairingCorrection;
   for(G4int Z=1; Z<ZMAX; ++Z) {
-    size_t nn = (fLevelManagers[Z]).size();
-    for(size_t j=0; j<nn; ++j) { 
-      delete (fLevelManagers[Z])[j]; 
+    const G4int nn = AMAX[Z]-AMIN[Z]+1;
+    for(G4int j=0; j<nn; ++j) { 
+      delete fLevelManagers[Z][j].load(std::memory_order_relaxed); 
     }
   }
 }
@@ -470,19 +482,34 @@ G4NuclearLevelData::GetLevelManager(G4int Z, G4int A)
 {
   if(Z < 1 || Z >= ZMAX || A < AMIN[Z] || A > AMAX[Z]) { return nullptr; } 
   const G4int idx = A - AMIN[Z];
-  if( !(fLevelManagerFlags[Z])[idx] ) {
+  if( !fLevelManagerFlags[Z][idx].load(std::memory_order_acquire) ) {
 #ifdef G4MULTITHREADED
     G4MUTEXLOCK(&nuclearLevelDataMutex);
-    if( !(fLevelManagerFlags[Z])[idx] ) {
+    if( !fLevelManagerFlags[Z][idx].load(std::memory_order_relaxed) ) {
 #endif
-      (fLevelManagers[Z])[idx] = fLevelReader->CreateLevelManager(Z, A);
-      (fLevelManagerFlags[Z])[idx] = true;
+      fLevelManagers[Z][idx].store(CreateLevelManager(Z, A),
+                                   std::memory_order_release);
+      fLevelManagerFlags[Z][idx].store(true, std::memory_order_release);
 #ifdef G4MULTITHREADED
     }
     G4MUTEXUNLOCK(&nuclearLevelDataMutex);
 #endif
   }
-  return (fLevelManagers[Z])[idx];
+  return fLevelManagers[Z][idx].load(std::memory_order_acquire);
+}
+
+const G4LevelManager* 
+G4NuclearLevelData::CreateLevelManager(G4int Z, G4int A)
+{
+  if(UseBinaryData()) {
+    const std::int64_t pos = fBinaryOffsets[Z][A - AMIN[Z]];
+    if(pos >= 0) {
+      fBinaryFile.clear();
+      fBinaryFile.seekg(pos);
+      return fLevelReader->ReadBinaryLevelManager(Z, A, fBinaryFile);
+    }
+  }
+  return fLevelReader->CreateLevelManager(Z, A);
 }
 
 G4bool 
@@ -501,9 +528,8 @@ G4NuclearLevelData::AddPrivateData(G4int Z, G4int A, const G4String& filename)
              << " A= " << A << " from <" << filename 
              << "> is done" << G4endl;
       const G4int idx = A - AMIN[Z];
-      delete (fLevelManagers[Z])[idx]; 
-      (fLevelManagers[Z])[idx] = newman;
-      (fLevelManagerFlags[Z])[idx] = true;
+      delete fLevelManagers[Z][idx].exchange(newman, std::memory_order_acq_rel);
+      fLevelManagerFlags[Z][idx].store(true, std::memory_order_release);
     }
 #ifdef G4MULTITHREADED
     G4MUTEXUNLOCK(&nuclearLevelDataMutex);
@@ -530,7 +556,8 @@ G4int G4NuclearLevelData::GetMaxA(G4int Z) const
 
 void G4NuclearLevelData::UploadNuclearLevelData(G4int ZZ)
 {
-  if(fInitialized) return;
+  // binary data are uploaded on request without parsing
+  if(fInitialized || UseBinaryData()) return;
 #ifdef G4MULTITHREADED
   G4MUTEXLOCK(&nuclearLevelDataMutex);
 #endif
@@ -541,9 +568,10 @@ void G4NuclearLevelData::UploadNuclearLevelData(G4int ZZ)
     for(G4int Z=1; Z<mZ; ++Z) {
       for(G4int A=AMIN[Z]; A<=AMAX[Z]; ++A) {
 	G4int idx = A - AMIN[Z];
-	if( !(fLevelManagerFlags[Z])[idx] ) {
-	  (fLevelManagers[Z])[idx] = fLevelReader->CreateLevelManager(Z, A);
-	  (fLevelManagerFlags[Z])[idx] = true;
+	if( !fLevelManagerFlags[Z][idx].load(std::memory_order_relaxed) ) {
+	  fLevelManagers[Z][idx].store(CreateLevelManager(Z, A),
+                                       std::memory_order_release);
+	  fLevelManagerFlags[Z][idx].store(true, std::memory_order_release);
 	}
       }
     }
@@ -664,3 +692,119 @@ void G4NuclearLevelData::StreamLevels(std::ostream& os,
     man->StreamInfo(os);
   }
 }
+
+namespace
+{
+  const char* const levelDataTag = "G4LEVELGAMMA1";
+  const std::size_t levelDataTagSize = 16;
+}
+
+G4bool G4NuclearLevelData::StoreLevelData(const G4String& filename)
+{
+  std::ofstream out(filename, std::ios::out | std::ios::binary);
+  if(!out.is_open()) {
+    G4ExceptionDescription ed;
+    ed << "Binary nuclear level data file <" << filename 
+       << "> is not opened";
+    G4Exception("G4NuclearLevelData::StoreLevelData","had0434",
+                JustWarning,ed,"");
+    return false;
+  }
+  // header: tag, IC flag, Z range, then A range and record offsets per Z
+  char tag[levelDataTagSize] = {0};
+  std::strncpy(tag, levelDataTag, levelDataTagSize-1);
+  out.write(tag, levelDataTagSize);
+  G4int flag = fDeexPrecoParameters->StoreICLevelData() ? 1 : 0;
+  G4int zmax = ZMAX;
+  out.write(reinterpret_cast<const char*>(&flag), sizeof(G4int));
+  out.write(reinterpret_cast<const char*>(&zmax), sizeof(G4int));
+  const std::streampos table = out.tellp();
+
+  std::vector<std::int64_t> offsets[ZMAX];
+  for(G4int Z=1; Z<ZMAX; ++Z) {
+    offsets[Z].assign(AMAX[Z]-AMIN[Z]+1, -1);
+    out.write(reinterpret_cast<const char*>(&AMIN[Z]), sizeof(G4int));
+    out.write(reinterpret_cast<const char*>(&AMAX[Z]), sizeof(G4int));
+    out.write(reinterpret_cast<const char*>(offsets[Z].data()),
+              offsets[Z].size()*sizeof(std::int64_t));
+  }
+  // records
+  for(G4int Z=1; Z<ZMAX; ++Z) {
+    for(G4int A=AMIN[Z]; A<=AMAX[Z]; ++A) {
+      const G4LevelManager* man = GetLevelManager(Z, A);
+      offsets[Z][A-AMIN[Z]] = (std::int64_t)out.tellp();
+      fLevelReader->WriteBinaryLevelManager(man, out);
+    }
+  }
+  // rewrite the table with the actual offsets
+  out.seekp(table);
+  for(G4int Z=1; Z<ZMAX; ++Z) {
+    out.write(reinterpret_cast<const char*>(&AMIN[Z]), sizeof(G4int));
+    out.write(reinterpret_cast<const char*>(&AMAX[Z]), sizeof(G4int));
+    out.write(reinterpret_cast<const char*>(offsets[Z].data()),
+              offsets[Z].size()*sizeof(std::int64_t));
+  }
+  G4bool res = !out.fail();
+  out.close();
+  if(fDeexPrecoParameters->GetVerbose() > 0) {
+    G4cout << "G4NuclearLevelData::StoreLevelData: level data are "
+           << (res ? "written to <" : "not written to <") << filename 
+           << ">" << G4endl;
+  }
+  return res;
+}
+
+G4bool G4NuclearLevelData::RetrieveLevelData(const G4String& filename)
+{
+#ifdef G4MULTITHREADED
+  G4MUTEXLOCK(&nuclearLevelDataMutex);
+#endif
+  G4bool res = OpenBinaryFile(filename);
+#ifdef G4MULTITHREADED
+  G4MUTEXUNLOCK(&nuclearLevelDataMutex);
+#endif
+  return res;
+}
+
+G4bool G4NuclearLevelData::OpenBinaryFile(const G4String& filename)
+{
+  if(fBinaryFile.is_open()) { fBinaryFile.close(); }
+  fBinaryFile.clear();
+  fBinaryFile.open(filename, std::ios::in | std::ios::binary);
+
+  G4bool res = fBinaryFile.is_open();
+  if(res) {
+    char tag[levelDataTagSize] = {0};
+    G4int flag = 0;
+    G4int zmax = 0;
+    fBinaryFile.read(tag, levelDataTagSize);
+    fBinaryFile.read(reinterpret_cast<char*>(&flag), sizeof(G4int));
+    fBinaryFile.read(reinterpret_cast<char*>(&zmax), sizeof(G4int));
+    res = (!fBinaryFile.fail() && 0 == std::strcmp(tag, levelDataTag)
+           && ZMAX == zmax);
+    fBinaryICData = (1 == flag);
+    for(G4int Z=1; Z<ZMAX && res; ++Z) {
+      G4int amin = 0;
+      G4int amax = 0;
+      fBinaryFile.read(reinterpret_cast<char*>(&amin), sizeof(G4int));
+      fBinaryFile.read(reinterpret_cast<char*>(&amax), sizeof(G4int));
+      res = (!fBinaryFile.fail() && AMIN[Z] == amin && AMAX[Z] == amax);
+      if(res) {
+        fBinaryOffsets[Z].resize(AMAX[Z]-AMIN[Z]+1);
+        fBinaryFile.read(reinterpret_cast<char*>(fBinaryOffsets[Z].data()),
+                         fBinaryOffsets[Z].size()*sizeof(std::int64_t));
+        res = !fBinaryFile.fail();
+      }
+    }
+  }
+  if(!res) {
+    fBinaryFile.close();
+    for(G4int Z=1; Z<ZMAX; ++Z) { fBinaryOffsets[Z].clear(); }
+    G4ExceptionDescription ed;
+    ed << "Binary nuclear level data file <" << filename 
+       << "> is not opened or has wrong format; text data are used";
+    G4Exception("G4NuclearLevelData::RetrieveLevelData","had0435",
+                JustWarning,ed,"");
+  }
+  return res;
+}
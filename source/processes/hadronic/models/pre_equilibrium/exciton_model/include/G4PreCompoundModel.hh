@@ -87,6 +87,8 @@ private:
   void PerformEquilibriumEmission(const G4Fragment & aFragment, 
 				  G4ReactionProductVector * result) const;
 
+  inline G4bool IsEquilibrium(const G4Fragment & aFragment) const;
+
   G4PreCompoundModel(const G4PreCompoundModel &) = delete;
   const G4PreCompoundModel& operator=(const G4PreCompoundModel &right) = delete;
   G4bool operator==(const G4PreCompoundModel &right) const = delete;
@@ -117,10 +119,17 @@ inline void G4PreCompoundModel::PerformEquilibriumEmission(
             const G4Fragment & aFragment,
             G4ReactionProductVector * result) const 
 {
-  G4ReactionProductVector* deexResult = 
-    GetExcitationHandler()->BreakItUp(aFragment);
-  result->insert(result->end(),deexResult->begin(), deexResult->end());
-  delete deexResult;
+  GetExcitationHandler()->BreakItUp(aFragment, result);
+}
+
+inline G4bool 
+G4PreCompoundModel::IsEquilibrium(const G4Fragment & aFragment) const
+{
+  G4double U = aFragment.GetExcitationEnergy();
+  G4int Z = aFragment.GetZ_asInt(); 
+  G4int A = aFragment.GetA_asInt(); 
+  return (!isActive || (Z < minZ && A < minA) || 
+          U < fLowLimitExc*A || U > A*fHighLimitExc);
 }
 
 #endif
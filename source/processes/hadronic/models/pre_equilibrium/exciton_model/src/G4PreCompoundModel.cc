@@ -170,13 +170,22 @@ G4PreCompoundModel::ApplyYourself(const G4HadProjectile & thePrimary,
   anInitialState.SetNumberOfHoles(1,0);
   anInitialState.SetCreationTime(thePrimary.GetGlobalTime());
   anInitialState.SetCreatorModelID(modelID);
-  
-  // call excitation handler
-  G4ReactionProductVector* result = DeExcite(anInitialState);
 
   // fill particle change
   theResult.Clear();
   theResult.SetStatusChange(stopAndKill);
+
+  // equilibrium emission from the start: products of the excitation 
+  // handler are added directly to the final state
+  if(!isInitialised) { InitialiseModel(); }
+  if(IsEquilibrium(anInitialState)) {
+    GetExcitationHandler()->BreakItUp(anInitialState, theResult, timePrimary);
+    return &theResult;
+  }
+  
+  // call excitation handler
+  G4ReactionProductVector* result = DeExcite(anInitialState);
+
   for(auto const & prod : *result) {
     G4DynamicParticle * aNewDP = new G4DynamicParticle(prod->GetDefinition(),
 						       prod->GetTotalEnergy(),
@@ -209,8 +218,7 @@ G4ReactionProductVector* G4PreCompoundModel::DeExcite(G4Fragment& aFragment)
   //G4cout << aFragment << G4endl;
 
   // Perform Equilibrium Emission 
-  if (!isActive || (Z < minZ && A < minA) || 
-      U < fLowLimitExc*A || U > A*fHighLimitExc) {
+  if (IsEquilibrium(aFragment)) {
     PerformEquilibriumEmission(aFragment, Result);
     return Result;
   }
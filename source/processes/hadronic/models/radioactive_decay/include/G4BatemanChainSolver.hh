@@ -0,0 +1,109 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+#ifndef G4BatemanChainSolver_h
+#define G4BatemanChainSolver_h 1
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+//  File:   G4BatemanChainSolver.hh                                           //
+//  Date:   19 October 2026                                                   //
+//  Description: activities of all descendants of a parent nuclide from the  //
+//               coefficients of the extended Bateman equations computed by   //
+//               G4Radioactivation::CalculateChainsFromParent. The chains are //
+//               flattened once per parent; the lifetimes shared by several   //
+//               chains are identified so that the convolution with the      //
+//               source time profile is evaluated once per distinct lifetime //
+//               when all activities are requested at a given time.          //
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "globals.hh"
+#include "G4RadioactiveDecayChainsFromParent.hh"
+
+#include <functional>
+#include <vector>
+
+class G4BatemanChainSolver
+{
+  public:
+    // convolve(t, tau): convolution of the source time profile with
+    // exp(-t/tau), divided by tau (G4Radioactivation::ConvolveSourceTimeProfile)
+    typedef std::function<G4double(G4double, G4double)> Convolution;
+
+    G4BatemanChainSolver() = default;
+    explicit G4BatemanChainSolver(const G4RadioactiveDecayRates& rates);
+
+    void SetRates(const G4RadioactiveDecayRates& rates);
+
+    // Nuclides of the chains; index 0 is the parent
+    inline std::size_t GetNumberOfNuclides() const {return fZ.size();}
+    inline G4int GetZ(std::size_t i) const {return fZ[i];}
+    inline G4int GetA(std::size_t i) const {return fA[i];}
+    inline G4double GetE(std::size_t i) const {return fE[i];}
+    inline G4int GetGeneration(std::size_t i) const {return fGeneration[i];}
+
+    // Distinct lifetimes appearing in the chains
+    inline std::size_t GetNumberOfLifetimes() const {return fLifetimes.size();}
+    inline G4double GetLifetime(std::size_t k) const {return fLifetimes[k];}
+
+    // Activity of nuclide i at time t, A_i(t) = - sum_j C_ij convolve(t, tau_ij)
+    // (Eq. 4.23 of the DERA technical note); negative values, due to
+    // cancellation errors, are set to zero
+    G4double GetActivity(std::size_t i, G4double t,
+                         const Convolution& convolve) const;
+
+    // Activities of all nuclides at time t; convolve is called once per
+    // distinct lifetime
+    void GetActivities(G4double t, const Convolution& convolve,
+                       std::vector<G4double>& activities) const;
+
+    // Activities of all nuclides at each of the given times;
+    // activities[n*GetNumberOfNuclides() + i] is the one of nuclide i at times[n]
+    void GetActivities(const std::vector<G4double>& times,
+                       const Convolution& convolve,
+                       std::vector<G4double>& activities) const;
+
+  private:
+    G4double Sum(std::size_t i, const std::vector<G4double>& convolutions) const;
+
+    std::vector<G4int> fZ;
+    std::vector<G4int> fA;
+    std::vector<G4double> fE;
+    std::vector<G4int> fGeneration;
+
+    // Coefficients and lifetime indices of nuclide i are stored in
+    // [fOffsets[i], fOffsets[i+1])
+    std::vector<std::size_t> fOffsets;
+    std::vector<G4double> fCoefficients;
+    std::vector<std::size_t> fLifetimeIndex;
+    std::vector<G4double> fLifetimes;
+
+    // Work space for the convolutions
+    mutable std::vector<G4double> fConvolutions;
+};
+#endif
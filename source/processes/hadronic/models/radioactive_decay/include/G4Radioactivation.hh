@@ -42,6 +42,7 @@
 #include "G4NucleusLimits.hh"
 #include "G4RadioactiveDecayRatesToDaughter.hh"
 #include "G4RadioactiveDecayChainsFromParent.hh"
+#include "G4BatemanChainSolver.hh"
 #include "G4RadioactivityTable.hh"
 #include "G4ThreeVector.hh"
 #include "G4Threading.hh"
@@ -51,7 +52,7 @@ class G4RadioactivationMessenger;
 
 typedef std::vector<G4RadioactiveDecayChainsFromParent> G4RadioactiveDecayParentChainTable;
 typedef std::vector<G4RadioactiveDecayRatesToDaughter> G4RadioactiveDecayRates;
-typedef std::map<G4String, G4DecayTable*> DecayTableMap;
+typedef std::unordered_map<const G4ParticleDefinition*, G4DecayTable*> DecayTableMap;
 
 
 class G4Radioactivation : public G4RadioactiveDecay
@@ -92,6 +93,12 @@ class G4Radioactivation : public G4RadioactiveDecay
     // and place it in "chainsFromParent".
     // used in VR decay mode only 
 
+    const G4BatemanChainSolver& GetChainSolver(const G4ParticleDefinition&);
+    // Returns the Bateman solver for all the descendants of the specified
+    // isotope, calculating the chains first if needed.  The activities of
+    // all descendants at a given time can be obtained from it in one call.
+    // used in VR decay mode only
+
     void SetDecayRate(G4int,G4int,G4double, G4int, std::vector<G4double>,
                       std::vector<G4double>);
     // Sets "theDecayRate" with data supplied in the arguements.
@@ -170,6 +177,8 @@ class G4Radioactivation : public G4RadioactiveDecay
     G4RadioactiveDecayRates theDecayRateVector;
     G4RadioactiveDecayChainsFromParent chainsFromParent;
     G4RadioactiveDecayParentChainTable theParentChainTable;
+    std::unordered_map<const G4ParticleDefinition*, G4BatemanChainSolver> theChainSolvers;
+    std::vector<G4double> theActivities;
 
     // for the radioactivity tables
     std::vector<G4RadioactivityTable*> theRadioactivityTables;
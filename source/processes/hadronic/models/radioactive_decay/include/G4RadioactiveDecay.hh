@@ -43,6 +43,7 @@
 
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <CLHEP/Units/SystemOfUnits.h>
 
 #include "G4ios.hh"
@@ -59,7 +60,7 @@ class G4Fragment;
 class G4RadioactiveDecayMessenger;
 class G4PhotonEvaporation;
 
-typedef std::map<G4String, G4DecayTable*> DecayTableMap;
+typedef std::unordered_map<const G4ParticleDefinition*, G4DecayTable*> DecayTableMap;
 
 
 class G4RadioactiveDecay : public G4VRestDiscreteProcess 
@@ -108,7 +109,8 @@ class G4RadioactiveDecay : public G4VRestDiscreteProcess
     void SetARM(G4bool arm) {applyARM = arm;}
 
     G4DecayTable* LoadDecayTable(const G4ParticleDefinition& theParentNucleus);
-    // Load the decay data of isotope theParentNucleus
+    // Build the decay table of isotope theParentNucleus from the decay data
+    // shared by all threads (G4RadioactiveDecayDatabase)
 
     void AddUserDecayDataFile(G4int Z, G4int A,G4String filename);
     // Allow the user to replace the radio-active decay data provided in Geant4
@@ -190,11 +192,9 @@ class G4RadioactiveDecay : public G4VRestDiscreteProcess
 
     static const G4double levelTolerance;
 
-    // Library of decay tables
+    // Library of decay tables of this thread; the decay data they are
+    // built from are shared through G4RadioactiveDecayDatabase
     DecayTableMap* dkmap;
-#ifdef G4MULTITHREADED
-    static DecayTableMap* master_dkmap;
-#endif
 
   private:
 
@@ -260,8 +260,6 @@ class G4RadioactiveDecay : public G4VRestDiscreteProcess
 #ifdef G4MULTITHREADED
   public:
     static G4Mutex radioactiveDecayMutex;
-  protected:
-    G4int& NumberOfInstances();
 #endif
 };
 
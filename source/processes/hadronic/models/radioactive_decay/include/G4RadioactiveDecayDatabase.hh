@@ -0,0 +1,145 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+//  File:   G4RadioactiveDecayDatabase.hh                                     //
+//  Date:   19 October 2026                                                   //
+//  Description: thread-shared registry of the parsed RadioactiveDecay data   //
+//               files. Each z<Z>.a<A> file is parsed once, on first request, //
+//               into an immutable list of parent levels; later requests for  //
+//               the same isotope, from any thread, read the list without     //
+//               locking. Decay tables (which hold thread-local channels) are //
+//               still built per thread by G4RadioactiveDecay from this data. //
+//               The whole database can be stored in, and retrieved from, a   //
+//               single binary file to avoid parsing at startup.              //
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef G4RadioactiveDecayDatabase_h
+#define G4RadioactiveDecayDatabase_h 1
+
+#include "globals.hh"
+#include "G4Ions.hh"
+#include "G4BetaDecayType.hh"
+#include "G4RadioactiveDecayMode.hh"
+#include "G4Threading.hh"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// One decay channel record of a parent level (energies with units)
+struct G4RadioactiveDecayChannelData
+{
+  G4RadioactiveDecayMode mode;
+  G4double branchingRatio;
+  G4double daughterExcitation;
+  G4double Q;
+  G4Ions::G4FloatLevelBase daughterFloatLevel;
+  G4BetaDecayType betaType;
+};
+
+// Decay data of one parent level. Branching ratios of the channels are
+// those of the file; they are normalised per decay mode with
+// modeTotalBR/modeSumBR once the channels are inserted in the table.
+struct G4RadioactiveDecayLevelData
+{
+  G4double excitation;
+  G4Ions::G4FloatLevelBase floatLevel;
+  std::vector<G4RadioactiveDecayChannelData> channels;
+  std::vector<G4double> modeTotalBR;
+  std::vector<G4double> modeSumBR;
+};
+
+typedef std::vector<G4RadioactiveDecayLevelData> G4RadioactiveDecayLevelList;
+
+
+class G4RadioactiveDecayDatabase
+{
+  public:
+
+    static G4RadioactiveDecayDatabase* GetInstance();
+
+    ~G4RadioactiveDecayDatabase();
+
+    // Parent levels of the isotope (Z, A) from the RadioactiveDecay
+    // database; the file is parsed on first call. The list is empty if
+    // there is no data file. The pointer stays valid until the end of
+    // the job. nullptr, with a warning, if (Z, A) is outside the range
+    // of the database.
+    const G4RadioactiveDecayLevelList* GetLevels(G4int Z, G4int A);
+
+    // First level matching the excitation energy within tolerance and,
+    // if floatLevel is not noFloat, the floating level; nullptr if none
+    static const G4RadioactiveDecayLevelData*
+    FindLevel(const G4RadioactiveDecayLevelList& levels, G4double excitation,
+              G4Ions::G4FloatLevelBase floatLevel, G4double tolerance);
+
+    // Parses a decay data file; returns false if it cannot be opened.
+    // Used directly for user-defined files, which are not shared.
+    static G4bool ParseFile(const G4String& fileName,
+                            G4RadioactiveDecayLevelList& levels);
+
+    // Parses all data files of the database and writes them in binary
+    // form; returns false if the output file cannot be written
+    G4bool StoreBinary(const G4String& fileName);
+
+    // Registers all isotopes found in a file written by StoreBinary().
+    // Isotopes already registered are kept. Returns false if the file
+    // cannot be read or was not written by StoreBinary().
+    G4bool RetrieveBinary(const G4String& fileName);
+
+    // Number of isotopes registered so far (including those without data)
+    G4int GetNumberOfIsotopes() const { return fNumberOfIsotopes; }
+
+    const G4String& GetDirectory() const { return fDirPath; }
+
+    G4RadioactiveDecayDatabase(const G4RadioactiveDecayDatabase&) = delete;
+    G4RadioactiveDecayDatabase& operator=(const G4RadioactiveDecayDatabase&) = delete;
+
+  private:
+
+    G4RadioactiveDecayDatabase();
+
+    // Publishes the list of (Z, A) unless another one was published
+    // first; returns the published list. Called under fMutex.
+    const G4RadioactiveDecayLevelList*
+    Register(G4int index, G4RadioactiveDecayLevelList* levels);
+
+    static G4int Index(G4int Z, G4int A);
+
+    static const G4int ZMAX = 120;
+    static const G4int AMAX = 300;
+
+    G4String fDirPath;
+    std::unique_ptr<std::atomic<const G4RadioactiveDecayLevelList*>[]> fLevels;
+    std::atomic<G4int> fNumberOfIsotopes;
+    G4Mutex fMutex;
+};
+
+#endif
@@ -81,6 +81,8 @@ class G4RadioactiveDecayMessenger: public G4UImessenger
     G4UIcmdWith3Vector* colldirCmd;
     G4UIcmdWithADoubleAndUnit* collangleCmd;
     G4UIcmdWithADoubleAndUnit* thresholdForVeryLongDecayTimeCmd;
+    G4UIcmdWithAString* storeDatabaseCmd;
+    G4UIcmdWithAString* retrieveDatabaseCmd;
 };
 
 #endif
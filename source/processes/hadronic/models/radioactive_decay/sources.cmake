@@ -4,6 +4,7 @@
 geant4_add_module(G4hadronic_radioactivedecay
   PUBLIC_HEADERS
     G4AlphaDecay.hh
+    G4BatemanChainSolver.hh
     G4BatemanParameters.hh
     G4BetaDecayCorrections.hh
     G4BetaDecayType.hh
@@ -17,6 +18,7 @@ geant4_add_module(G4hadronic_radioactivedecay
     G4NucleusLimits.hh
     G4ProtonDecay.hh
     G4RadioactiveDecay.hh
+    G4RadioactiveDecayDatabase.hh
     G4RadioactiveDecayMessenger.hh
     G4Radioactivation.hh
     G4RadioactivationMessenger.hh
@@ -29,6 +31,7 @@ geant4_add_module(G4hadronic_radioactivedecay
     G4UserLimitsForRD.hh
   SOURCES
     G4AlphaDecay.cc
+    G4BatemanChainSolver.cc
     G4BatemanParameters.cc
     G4BetaDecayCorrections.cc
     G4BetaDecayType.cc
@@ -42,6 +45,7 @@ geant4_add_module(G4hadronic_radioactivedecay
     G4NucleusLimits.cc
     G4ProtonDecay.cc
     G4RadioactiveDecay.cc
+    G4RadioactiveDecayDatabase.cc
     G4RadioactiveDecayMessenger.cc
     G4Radioactivation.cc
     G4RadioactivationMessenger.cc
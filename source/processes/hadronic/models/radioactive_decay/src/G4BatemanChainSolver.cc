@@ -0,0 +1,141 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+//  File:   G4BatemanChainSolver.cc                                           //
+//  Date:   19 October 2026                                                   //
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "G4BatemanChainSolver.hh"
+
+#include <algorithm>
+#include <map>
+
+
+G4BatemanChainSolver::G4BatemanChainSolver(const G4RadioactiveDecayRates& rates)
+{
+  SetRates(rates);
+}
+
+
+void G4BatemanChainSolver::SetRates(const G4RadioactiveDecayRates& rates)
+{
+  std::size_t n = rates.size();
+  fZ.resize(n);
+  fA.resize(n);
+  fE.resize(n);
+  fGeneration.resize(n);
+  fOffsets.assign(1, 0);
+  fOffsets.reserve(n+1);
+  fCoefficients.clear();
+  fLifetimeIndex.clear();
+  fLifetimes.clear();
+
+  std::map<G4double, std::size_t> lifetimes;
+  for (std::size_t i = 0; i < n; ++i) {
+    const G4RadioactiveDecayRatesToDaughter& rate = rates[i];
+    fZ[i] = rate.GetZ();
+    fA[i] = rate.GetA();
+    fE[i] = rate.GetE();
+    fGeneration[i] = rate.GetGeneration();
+
+    std::vector<G4double> coeffs = rate.GetDecayRateC();
+    std::vector<G4double> taus = rate.GetTaos();
+    std::size_t nterms = std::min(coeffs.size(), taus.size());
+    for (std::size_t j = 0; j < nterms; ++j) {
+      auto it = lifetimes.find(taus[j]);
+      if (it == lifetimes.end()) {
+        it = lifetimes.insert(std::make_pair(taus[j], fLifetimes.size())).first;
+        fLifetimes.push_back(taus[j]);
+      }
+      fCoefficients.push_back(coeffs[j]);
+      fLifetimeIndex.push_back(it->second);
+    }
+    fOffsets.push_back(fCoefficients.size());
+  }
+}
+
+
+G4double
+G4BatemanChainSolver::Sum(std::size_t i,
+                          const std::vector<G4double>& convolutions) const
+{
+  G4double activity = 0.0;
+  for (std::size_t j = fOffsets[i]; j < fOffsets[i+1]; ++j) {
+    activity -= fCoefficients[j]*convolutions[fLifetimeIndex[j]];
+  }
+  return (activity < 0.0) ? G4double(0.0) : activity;
+}
+
+
+G4double
+G4BatemanChainSolver::GetActivity(std::size_t i, G4double t,
+                                  const Convolution& convolve) const
+{
+  G4double activity = 0.0;
+  for (std::size_t j = fOffsets[i]; j < fOffsets[i+1]; ++j) {
+    activity -= fCoefficients[j]*convolve(t, fLifetimes[fLifetimeIndex[j]]);
+  }
+  return (activity < 0.0) ? G4double(0.0) : activity;
+}
+
+
+void G4BatemanChainSolver::GetActivities(G4double t,
+                                         const Convolution& convolve,
+                                         std::vector<G4double>& activities) const
+{
+  std::size_t nlife = fLifetimes.size();
+  fConvolutions.resize(nlife);
+  for (std::size_t k = 0; k < nlife; ++k) {
+    fConvolutions[k] = convolve(t, fLifetimes[k]);
+  }
+
+  std::size_t n = fZ.size();
+  activities.resize(n);
+  for (std::size_t i = 0; i < n; ++i) activities[i] = Sum(i, fConvolutions);
+}
+
+
+void G4BatemanChainSolver::GetActivities(const std::vector<G4double>& times,
+                                         const Convolution& convolve,
+                                         std::vector<G4double>& activities) const
+{
+  std::size_t n = fZ.size();
+  std::size_t nlife = fLifetimes.size();
+  activities.resize(times.size()*n);
+  fConvolutions.resize(nlife);
+  for (std::size_t m = 0; m < times.size(); ++m) {
+    for (std::size_t k = 0; k < nlife; ++k) {
+      fConvolutions[k] = convolve(times[m], fLifetimes[k]);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      activities[m*n + i] = Sum(i, fConvolutions);
+    }
+  }
+}
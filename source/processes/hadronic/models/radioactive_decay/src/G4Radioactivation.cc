@@ -145,13 +145,12 @@ G4Radioactivation::~G4Radioactivation()
 
 G4DecayTable* G4Radioactivation::GetDecayTable1(const G4ParticleDefinition* aNucleus)
 {
-  G4String key = aNucleus->GetParticleName();
-  DecayTableMap::iterator table_ptr = dkmap->find(key);
+  DecayTableMap::iterator table_ptr = dkmap->find(aNucleus);
 
   G4DecayTable* theDecayTable = 0;
   if (table_ptr == dkmap->end() ) {                   // If table not there,
     theDecayTable = LoadDecayTable(*aNucleus);        // load from file and
-    if(theDecayTable) (*dkmap)[key] = theDecayTable;  // store in library
+    if(theDecayTable) (*dkmap)[aNucleus] = theDecayTable;  // store in library
   } else {
     theDecayTable = table_ptr->second;
   }
@@ -163,11 +162,19 @@ G4Radioactivation::IsRateTableReady(const G4ParticleDefinition& aParticle)
 {
   // Check whether the radioactive decay rates table for the ion has already
   // been calculated.
-  G4String aParticleName = aParticle.GetParticleName();
-  for (size_t i = 0; i < theParentChainTable.size(); i++) {
-    if (theParentChainTable[i].GetIonName() == aParticleName) return true;
+  return (theChainSolvers.find(&aParticle) != theChainSolvers.end());
+}
+
+
+const G4BatemanChainSolver&
+G4Radioactivation::GetChainSolver(const G4ParticleDefinition& aParticle)
+{
+  auto solver = theChainSolvers.find(&aParticle);
+  if (solver == theChainSolvers.end()) {
+    CalculateChainsFromParent(aParticle);
+    solver = theChainSolvers.find(&aParticle);
   }
-  return false;
+  return solver->second;
 }
 
 
@@ -692,6 +699,9 @@ CalculateChainsFromParent(const G4ParticleDefinition& theParentNucleus)
 
   // finally add the decayratetable to the tablevector
   theParentChainTable.push_back(chainsFromParent);
+
+  // and flatten the chains for the evaluation of the activities
+  theChainSolvers[&theParentNucleus].SetRates(theDecayRateVector);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -903,17 +913,15 @@ G4Radioactivation::DecayIt(const G4Track& theTrack, const G4Step&)
       G4ParticleDefinition* parentNucleus;
 
       // Get decay chains for the given nuclide
-      if (!IsRateTableReady(*theParticleDef)) CalculateChainsFromParent(*theParticleDef);
-      GetChainsFromParent(*theParticleDef);
+      const G4BatemanChainSolver& chains = GetChainSolver(*theParticleDef);
+      auto convolve = [this](G4double t, G4double tau)
+                      {return ConvolveSourceTimeProfile(t, tau);};
 
       // Declare some of the variables required in the implementation
       G4int PZ;
       G4int PA;
       G4double PE;
       G4String keyName;
-      std::vector<G4double> PT;
-      std::vector<G4double> PR;
-      G4double taotime;
       /*long*/ G4double decayRate;
 
       size_t i;
@@ -949,76 +957,29 @@ G4Radioactivation::DecayIt(const G4Track& theTrack, const G4Step&)
         // it should be calculated in seconds
         weight1 /= s ;
 	    
+        // Calculate the decay rates of all the isotopes.  theActivities[i]
+        // is the radioactivity of isotope i of the chains at 'theDecayTime';
+        // it will be used to calculate the statistical weight of the decay
+        // products of this isotope.
+        //
+        // The chains of a given parent nucleus (ZP,AP,EP) to each descendant
+        // nuclide (Z,A,E) are flattened by G4BatemanChainSolver; nuclide 0 is
+        // the parent itself, and the activity of nuclide i is
+        //           A_i = - sum_j C_ij * convolution(theDecayTime, tau_ij)
+        // (Eq.4.23 of the TN), where the negative sign is required as the
+        // rate in the equation is defined to be negative, i.e. decay away.
+        // The convolution with the source time profile is evaluated once
+        // for each distinct lifetime of the chains.  Negative decay rates,
+        // which are likely due to cancellation errors, are set to zero.
+        chains.GetActivities(theDecayTime, convolve, theActivities);
+
         // loop over all the possible secondaries of the nucleus
         // the first one is itself.
-        for (i = 0; i < theDecayRateVector.size(); i++) {
-          PZ = theDecayRateVector[i].GetZ();
-          PA = theDecayRateVector[i].GetA();
-          PE = theDecayRateVector[i].GetE();
-          PT = theDecayRateVector[i].GetTaos();
-          PR = theDecayRateVector[i].GetDecayRateC();
-
-          // The array of arrays theDecayRateVector contains all possible decay
-          // chains of a given parent nucleus (ZP,AP,EP) to a given descendant
-          // nuclide (Z,A,E).
-          //
-          // theDecayRateVector[0] contains the decay parameters of the parent
-          // nucleus
-          //           PZ = ZP
-          //           PA = AP
-          //           PE = EP
-          //           PT[] = {TP}
-          //           PR[] = {RP}
-          //
-          // theDecayRateVector[1] contains the decay of the parent to the first
-          // generation daughter (Z1,A1,E1).
-          //           PZ = Z1
-          //           PA = A1
-          //           PE = E1
-          //           PT[] = {TP, T1}
-          //           PR[] = {RP, R1}
-          //
-          // theDecayRateVector[2] contains the decay of the parent to the first
-          // generation daughter (Z1,A1,E1) and the decay of the first
-          // generation daughter to the second generation daughter (Z2,A2,E2).
-          //           PZ = Z2
-          //           PA = A2
-          //           PE = E2
-          //           PT[] = {TP, T1, T2}
-          //           PR[] = {RP, R1, R2}
-          //
-          // theDecayRateVector[3] may contain a branch chain
-          //           PZ = Z2a
-          //           PA = A2a
-          //           PE = E2a
-          //           PT[] = {TP, T1, T2a}
-          //           PR[] = {RP, R1, R2a}
-          //
-          // and so on.
-
-          // Calculate the decay rate of the isotope.  decayRate is the
-          // radioactivity of isotope (PZ,PA,PE) at 'theDecayTime'
-          // it will be used to calculate the statistical weight of the 
-          // decay products of this isotope
-
-          // For each nuclide, calculate all the decay chains which can reach
-          // the parent nuclide
-          decayRate = 0.L;
-          for (G4int j = 0; j < G4int(PT.size() ); j++) {
-            taotime = ConvolveSourceTimeProfile(theDecayTime,PT[j]);
-            decayRate -= PR[j] * (/*long*/ G4double)taotime;  // PRs are Acoeffs, taotime is inverse time
-            // Eq.4.23 of of the TN
-            // note the negative here is required as the rate in the
-            // equation is defined to be negative, 
-            // i.e. decay away, but we need positive value here.
-
-            // G4cout << j << "\t"<< PT[j]/s << "\t" << PR[j] << "\t" << decayRate << G4endl;		
-          }
-
-          // At this point any negative decay rates are probably small enough
-          // (order 10**-30) that negative values are likely due to cancellation
-          // errors.  Set them to zero.
-          if (decayRate < 0.0) decayRate = 0.0;
+        for (i = 0; i < chains.GetNumberOfNuclides(); i++) {
+          PZ = chains.GetZ(i);
+          PA = chains.GetA(i);
+          PE = chains.GetE(i);
+          decayRate = theActivities[i];
 
           //  G4cout <<theDecayTime/s <<"\t"<<nbin<<G4endl;
           //  G4cout << theTrack.GetWeight() <<"\t"<<weight1<<"\t"<<decayRate<< G4endl;
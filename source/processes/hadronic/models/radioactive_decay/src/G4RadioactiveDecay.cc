@@ -40,6 +40,7 @@
 
 #include "G4RadioactiveDecay.hh"
 #include "G4RadioactiveDecayMessenger.hh"
+#include "G4RadioactiveDecayDatabase.hh"
 
 #include "G4SystemOfUnits.hh"
 #include "G4DynamicParticle.hh"
@@ -101,13 +102,6 @@ const G4ThreeVector G4RadioactiveDecay::origin(0.,0.,0.);
 #ifdef G4MULTITHREADED
 #include "G4AutoLock.hh"
 G4Mutex G4RadioactiveDecay::radioactiveDecayMutex = G4MUTEX_INITIALIZER;
-DecayTableMap* G4RadioactiveDecay::master_dkmap = 0;
-
-G4int& G4RadioactiveDecay::NumberOfInstances()
-{
-  static G4int numberOfInstances = 0;
-  return numberOfInstances;
-}
 #endif
 
 G4RadioactiveDecay::G4RadioactiveDecay(const G4String& processName)
@@ -156,11 +150,6 @@ G4RadioactiveDecay::G4RadioactiveDecay(const G4String& processName)
   theUserRadioactiveDataFiles.clear();
 
   // Instantiate the map of decay tables
-#ifdef G4MULTITHREADED
-  G4AutoLock lk(&G4RadioactiveDecay::radioactiveDecayMutex);
-  NumberOfInstances()++;
-  if(!master_dkmap) master_dkmap = new DecayTableMap;
-#endif
   dkmap = new DecayTableMap;
 
   // Apply default values
@@ -192,18 +181,6 @@ G4RadioactiveDecay::~G4RadioactiveDecay()
   }
   dkmap->clear();
   delete dkmap;
-#ifdef G4MULTITHREADED
-  G4AutoLock lk(&G4RadioactiveDecay::radioactiveDecayMutex);
-  --NumberOfInstances();
-  if(NumberOfInstances()==0)
-  {
-    for (DecayTableMap::iterator i = master_dkmap->begin(); i != master_dkmap->end(); i++) {
-      delete i->second;
-    }
-    master_dkmap->clear();
-    delete master_dkmap;
-  }
-#endif
 }
 
 
@@ -231,13 +208,12 @@ G4bool G4RadioactiveDecay::IsApplicable(const G4ParticleDefinition& aParticle)
 
 G4DecayTable* G4RadioactiveDecay::GetDecayTable(const G4ParticleDefinition* aNucleus)
 {
-  G4String key = aNucleus->GetParticleName();
-  DecayTableMap::iterator table_ptr = dkmap->find(key);
+  DecayTableMap::iterator table_ptr = dkmap->find(aNucleus);
 
   G4DecayTable* theDecayTable = 0;
   if (table_ptr == dkmap->end() ) {                   // If table not there,     
     theDecayTable = LoadDecayTable(*aNucleus);        // load from file and
-    if(theDecayTable) (*dkmap)[key] = theDecayTable;  // store in library 
+    if(theDecayTable) (*dkmap)[aNucleus] = theDecayTable;  // store in library 
   } else {
     theDecayTable = table_ptr->second;
   }
@@ -510,16 +486,14 @@ G4RadioactiveDecay::StreamInfo(std::ostream& os, const G4String& endline)
 
 ////////////////////////////////////////////////////////////////////////////////
 //                                                                            //
-//  LoadDecayTable loads the decay scheme from the RadioactiveDecay database  // 
-//  for the parent nucleus.                                                   //
+//  LoadDecayTable builds the decay table of the parent nucleus from the      //
+//  RadioactiveDecay database, parsed once and shared by all threads.         //
 //                                                                            //
 ////////////////////////////////////////////////////////////////////////////////
 
 G4DecayTable*
 G4RadioactiveDecay::LoadDecayTable(const G4ParticleDefinition& theParentNucleus)
 {
-  // Generate input data file name using Z and A of the parent nucleus
-  // file containing radioactive decay data.
   G4int A = ((const G4Ions*)(&theParentNucleus))->GetAtomicMass();
   G4int Z = ((const G4Ions*)(&theParentNucleus))->GetAtomicNumber();
 
@@ -527,352 +501,116 @@ G4RadioactiveDecay::LoadDecayTable(const G4ParticleDefinition& theParentNucleus)
   G4Ions::G4FloatLevelBase G4floatingLevel =
     ((const G4Ions*)(&theParentNucleus))->GetFloatLevelBase();
 
-#ifdef G4MULTITHREADED
-  G4AutoLock lk(&G4RadioactiveDecay::radioactiveDecayMutex);
+  // Check if data have been provided by the user; user files are parsed
+  // here and not shared
+  const G4RadioactiveDecayLevelList* levels = 0;
+  G4RadioactiveDecayLevelList userLevels;
 
-  G4String key = theParentNucleus.GetParticleName();
-  DecayTableMap::iterator master_table_ptr = master_dkmap->find(key);
-
-  if (master_table_ptr != master_dkmap->end() ) {   // If table is there              
-    return master_table_ptr->second;
+  std::map<G4int, G4String>::const_iterator userFile =
+    theUserRadioactiveDataFiles.find(1000*A+Z);
+  if (userFile != theUserRadioactiveDataFiles.end() && userFile->second != "") {
+    G4RadioactiveDecayDatabase::ParseFile(userFile->second, userLevels);
+    levels = &userLevels;
+  } else {
+    levels = G4RadioactiveDecayDatabase::GetInstance()->GetLevels(Z, A);
   }
-#endif
 
-  //Check if data have been provided by the user
-  G4String file = theUserRadioactiveDataFiles[1000*A+Z];
-
-  if (file == "") {
-    std::ostringstream os;
-    os << dirPath << "/z" << Z << ".a" << A << '\0';
-    file = os.str();
+  // Take first level which matches excitation energy (and G4floating level
+  // if specified)
+  const G4RadioactiveDecayLevelData* level = 0;
+  if (levels) {
+    level = G4RadioactiveDecayDatabase::FindLevel(*levels, levelEnergy,
+                                                  G4floatingLevel, levelTolerance);
   }
 
   G4DecayTable* theDecayTable = new G4DecayTable();
-  G4bool found(false);     // True if energy level matches one in table
-
-  std::ifstream DecaySchemeFile;
-  DecaySchemeFile.open(file);
-
-  if (DecaySchemeFile.good()) {
-    // Initialize variables used for reading in radioactive decay data
-    G4bool G4floatMatch(false);
-    const G4int nMode = G4RadioactiveDecayModeSize;
-    G4double modeTotalBR[nMode] = {0.0};
-    G4double modeSumBR[nMode];
-    for (G4int i = 0; i < nMode; i++) {
-      modeSumBR[i] = 0.0;
-    }
 
-    char inputChars[120]={' '};
-    G4String inputLine;
-    G4String recordType("");
-    G4String G4floatingFlag("");
-    G4String daughterFloatFlag("");
-    G4Ions::G4FloatLevelBase daughterFloatLevel;
-    G4RadioactiveDecayMode theDecayMode;
-    G4double decayModeTotal(0.0);
-    G4double parentExcitation(0.0);
-    G4double a(0.0);
-    G4double b(0.0);
-    G4double c(0.0);
-    G4double dummy(0.0);
-    G4BetaDecayType betaType(allowed);
-
-    // Loop through each data file record until you identify the decay
-    // data relating to the nuclide of concern.
-
-    G4bool complete(false);  // bool insures only one set of values read for any
-                             // given parent energy level
-    G4int loop = 0;
-    while (!complete && !DecaySchemeFile.getline(inputChars, 120).eof()) {  /* Loop checking, 01.09.2015, D.Wright */
-      loop++;
-      if (loop > 100000) {
-        G4Exception("G4RadioactiveDecay::LoadDecayTable()", "HAD_RDM_100",
-                    JustWarning, "While loop count exceeded");
-        break;
-      }
- 
-      inputLine = inputChars;
-      G4StrUtil::rstrip(inputLine);
-      if (inputChars[0] != '#' && inputLine.length() != 0) {
-        std::istringstream tmpStream(inputLine);
-
-        if (inputChars[0] == 'P') {
-          // Nucleus is a parent type.  Check excitation level to see if it
-          // matches that of theParentNucleus
-          tmpStream >> recordType >> parentExcitation >> G4floatingFlag >> dummy;
-          // "dummy" takes the place of half-life
-          //  Now read in from ENSDFSTATE in particle category
-
-          if (found) {
-            complete = true;
-          } else {
-            // Take first level which matches excitation energy regardless of G4floating level
-            found = (std::abs(parentExcitation*keV - levelEnergy) < levelTolerance);
-            if (G4floatingLevel != noFloat) {
-              // If G4floating level specificed, require match of both energy and G4floating level
-              G4floatMatch = (G4floatingLevel == G4Ions::FloatLevelBase(G4floatingFlag.back()) );
-              if (!G4floatMatch) found = false;
-            }
+  if (level) {
+    for (const auto& data : level->channels) {
+      G4double b = data.branchingRatio;
+      G4double Q = data.Q;
+      G4double daughterExcitation = data.daughterExcitation;
+      G4Ions::G4FloatLevelBase daughterFloatLevel = data.daughterFloatLevel;
+
+      switch (data.mode) {
+        case IT:
+          {
+          G4ITDecay* anITChannel = new G4ITDecay(&theParentNucleus, b,
+                                                 0.0, 0.0, photonEvaporation);
+          anITChannel->SetARM(applyARM);
+          theDecayTable->Insert(anITChannel);
           }
-
-        } else if (found) {
-          // The right part of the radioactive decay data file has been found.  Search
-          // through it to determine the mode of decay of the subsequent records.
-
-          // Store for later the total decay probability for each decay mode 
-          if (inputLine.length() < 72) {
-            tmpStream >> theDecayMode >> dummy >> decayModeTotal;
-            switch (theDecayMode) {
-              case IT:
-                {
-                G4ITDecay* anITChannel = new G4ITDecay(&theParentNucleus, decayModeTotal,
-                                                       0.0, 0.0, photonEvaporation);
-//                anITChannel->SetHLThreshold(halflifethreshold);
-                anITChannel->SetARM(applyARM);
-                theDecayTable->Insert(anITChannel);
-//                anITChannel->DumpNuclearInfo();
-                }
-                break;
-              case BetaMinus:
-                modeTotalBR[BetaMinus] = decayModeTotal; break;
-              case BetaPlus:
-                modeTotalBR[BetaPlus] = decayModeTotal; break;
-              case KshellEC:
-                modeTotalBR[KshellEC] = decayModeTotal; break;
-              case LshellEC:
-                modeTotalBR[LshellEC] = decayModeTotal; break;
-              case MshellEC:
-                modeTotalBR[MshellEC] = decayModeTotal; break;
-              case NshellEC:
-                modeTotalBR[NshellEC] = decayModeTotal; break;
-              case Alpha:
-                modeTotalBR[Alpha] = decayModeTotal; break;
-              case Proton:
-                modeTotalBR[Proton] = decayModeTotal; break;
-              case Neutron:
-                modeTotalBR[Neutron] = decayModeTotal; break;
-              case SpFission:
-                modeTotalBR[SpFission] = decayModeTotal; break;
-              case BDProton:
-                /* Not yet implemented */  break;
-              case BDNeutron:
-                /* Not yet implemented */  break;
-              case Beta2Minus:
-                /* Not yet implemented */  break;
-              case Beta2Plus:
-                /* Not yet implemented */  break;
-              case Proton2:
-                /* Not yet implemented */  break;
-              case Neutron2:
-                /* Not yet implemented */  break;
-              case Triton:
-                modeTotalBR[Triton] = decayModeTotal; break;
-              case RDM_ERROR:
-
-              default:
-                G4Exception("G4RadioactiveDecay::LoadDecayTable()", "HAD_RDM_000",
-                            FatalException, "Selected decay mode does not exist");
-            }  // switch
-
-          } else {
-            if (inputLine.length() < 84) {
-              tmpStream >> theDecayMode >> a >> daughterFloatFlag >> b >> c;
-              betaType = allowed;
-            } else {
-              tmpStream >> theDecayMode >> a >> daughterFloatFlag >> b >> c >> betaType;
-            }
-
-            // Allowed transitions are the default. Forbidden transitions are
-            // indicated in the last column.
-            a /= 1000.;
-            c /= 1000.;
-            b /= 100.;
-            daughterFloatLevel = G4Ions::FloatLevelBase(daughterFloatFlag.back());
-
-            switch (theDecayMode) {
-              case BetaMinus:
-              {
-                G4BetaMinusDecay* aBetaMinusChannel =
-                  new G4BetaMinusDecay(&theParentNucleus, b, c*MeV, a*MeV,
-                                       daughterFloatLevel, betaType);
-//              aBetaMinusChannel->DumpNuclearInfo();
-//                aBetaMinusChannel->SetHLThreshold(halflifethreshold);
-                theDecayTable->Insert(aBetaMinusChannel);
-                modeSumBR[BetaMinus] += b;
-              }
-              break;
-
-              case BetaPlus:
-              {
-                G4BetaPlusDecay* aBetaPlusChannel =
-                  new G4BetaPlusDecay(&theParentNucleus, b, c*MeV, a*MeV,
-                                      daughterFloatLevel, betaType);
-//              aBetaPlusChannel->DumpNuclearInfo();
-//                aBetaPlusChannel->SetHLThreshold(halflifethreshold);
-                theDecayTable->Insert(aBetaPlusChannel);
-                modeSumBR[BetaPlus] += b;
-              }
-              break;
-
-              case KshellEC:  // K-shell electron capture
-              {
-                G4ECDecay* aKECChannel =
-                  new G4ECDecay(&theParentNucleus, b, c*MeV, a*MeV,
-                                daughterFloatLevel, KshellEC);
-//              aKECChannel->DumpNuclearInfo();
-//                aKECChannel->SetHLThreshold(halflifethreshold);
-                aKECChannel->SetARM(applyARM);
-                theDecayTable->Insert(aKECChannel);
-                modeSumBR[KshellEC] += b;
-              }
-              break;
-
-              case LshellEC:  // L-shell electron capture
-              {
-                G4ECDecay* aLECChannel =
-                  new G4ECDecay(&theParentNucleus, b, c*MeV, a*MeV,
-                                daughterFloatLevel, LshellEC);
-//              aLECChannel->DumpNuclearInfo();
-//                aLECChannel->SetHLThreshold(halflifethreshold);
-                aLECChannel->SetARM(applyARM);
-                theDecayTable->Insert(aLECChannel);
-                modeSumBR[LshellEC] += b;
-              }
-              break;
-
-              case MshellEC:  // M-shell electron capture
-              {
-                G4ECDecay* aMECChannel =
-                  new G4ECDecay(&theParentNucleus, b, c*MeV, a*MeV,
-                                daughterFloatLevel, MshellEC);
-//              aMECChannel->DumpNuclearInfo();
-//                aMECChannel->SetHLThreshold(halflifethreshold);
-                aMECChannel->SetARM(applyARM);
-                theDecayTable->Insert(aMECChannel);
-                modeSumBR[MshellEC] += b;
-              }
-              break;
-
-              case NshellEC:  // N-shell electron capture
-              {
-                G4ECDecay* aNECChannel =
-                  new G4ECDecay(&theParentNucleus, b, c*MeV, a*MeV,
-                                daughterFloatLevel, NshellEC);
-//              aNECChannel->DumpNuclearInfo();
-//                aNECChannel->SetHLThreshold(halflifethreshold);
-                aNECChannel->SetARM(applyARM);
-                theDecayTable->Insert(aNECChannel);
-                modeSumBR[NshellEC] += b;
-              }
-              break;
-
-              case Alpha:
-              {
-                G4AlphaDecay* anAlphaChannel =
-                  new G4AlphaDecay(&theParentNucleus, b, c*MeV, a*MeV,
-                                   daughterFloatLevel);
-//              anAlphaChannel->DumpNuclearInfo();
-//                anAlphaChannel->SetHLThreshold(halflifethreshold);
-                theDecayTable->Insert(anAlphaChannel);
-                modeSumBR[Alpha] += b;
-              }
-              break;
-
-	      case Proton:
-              {
-                G4ProtonDecay* aProtonChannel =
-                  new G4ProtonDecay(&theParentNucleus, b, c*MeV, a*MeV,
-                                    daughterFloatLevel);
-//              aProtonChannel->DumpNuclearInfo();
-//                aProtonChannel->SetHLThreshold(halflifethreshold);
-                theDecayTable->Insert(aProtonChannel);
-                modeSumBR[Proton] += b;
-              }
-              break;
-
-              case Neutron:
-              {
-                G4NeutronDecay* aNeutronChannel =
-                  new G4NeutronDecay(&theParentNucleus, b, c*MeV, a*MeV,
-                                     daughterFloatLevel);
-//              aNeutronChannel->DumpNuclearInfo();
-//                aNeutronChannel->SetHLThreshold(halflifethreshold);
-                theDecayTable->Insert(aNeutronChannel);
-                modeSumBR[Neutron] += b;
-              }
-              break;
-
-              case SpFission:
-              {
-                G4SFDecay* aSpontFissChannel =
-//                  new G4SFDecay(&theParentNucleus, decayModeTotal, 0.0, 0.0);
-                  new G4SFDecay(&theParentNucleus, b, c*MeV, a*MeV,
-                                daughterFloatLevel);
-                theDecayTable->Insert(aSpontFissChannel);
-                modeSumBR[SpFission] += b;
-              }
-              break;
-
-              case BDProton:
-                  // Not yet implemented
-                  // G4cout << " beta-delayed proton decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
-                  break;
-
-              case BDNeutron:
-                  // Not yet implemented
-                  // G4cout << " beta-delayed neutron decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
-                  break;
-
-              case Beta2Minus:
-                  // Not yet implemented
-                  // G4cout << " Double beta- decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
-                  break;
-
-              case Beta2Plus:
-                  // Not yet implemented
-                  // G4cout << " Double beta+ decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
-                  break;
-
-              case Proton2:
-                  // Not yet implemented
-                  // G4cout << " Double proton decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
-                  break;
-
-              case Neutron2:
-                  // Not yet implemented
-                  // G4cout << " Double beta- decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
-                  break;
-
-              case Triton:
-                {
-                    G4TritonDecay* aTritonChannel =
-                    new G4TritonDecay(&theParentNucleus, b, c*MeV, a*MeV,
-                                     daughterFloatLevel);
-                    //              anAlphaChannel->DumpNuclearInfo();
-                    //                anAlphaChannel->SetHLThreshold(halflifethreshold);
-                    theDecayTable->Insert(aTritonChannel);
-                    modeSumBR[Triton] += b;
-                }
-              break;
-
-              case RDM_ERROR:
-
-              default:
-                G4Exception("G4RadioactiveDecay::LoadDecayTable()", "HAD_RDM_000",
-                            FatalException, "Selected decay mode does not exist");
-            }  // switch
-          }  // line < 72
-        }  // if char == P
-      }  // if char != #
-    }  // While
+          break;
+
+        case BetaMinus:
+          theDecayTable->Insert(new G4BetaMinusDecay(&theParentNucleus, b, Q,
+                                                     daughterExcitation,
+                                                     daughterFloatLevel,
+                                                     data.betaType));
+          break;
+
+        case BetaPlus:
+          theDecayTable->Insert(new G4BetaPlusDecay(&theParentNucleus, b, Q,
+                                                    daughterExcitation,
+                                                    daughterFloatLevel,
+                                                    data.betaType));
+          break;
+
+        case KshellEC:  // K-, L-, M- and N-shell electron capture
+        case LshellEC:
+        case MshellEC:
+        case NshellEC:
+          {
+          G4ECDecay* anECChannel =
+            new G4ECDecay(&theParentNucleus, b, Q, daughterExcitation,
+                          daughterFloatLevel, data.mode);
+          anECChannel->SetARM(applyARM);
+          theDecayTable->Insert(anECChannel);
+          }
+          break;
+
+        case Alpha:
+          theDecayTable->Insert(new G4AlphaDecay(&theParentNucleus, b, Q,
+                                                 daughterExcitation,
+                                                 daughterFloatLevel));
+          break;
+
+        case Proton:
+          theDecayTable->Insert(new G4ProtonDecay(&theParentNucleus, b, Q,
+                                                  daughterExcitation,
+                                                  daughterFloatLevel));
+          break;
+
+        case Neutron:
+          theDecayTable->Insert(new G4NeutronDecay(&theParentNucleus, b, Q,
+                                                   daughterExcitation,
+                                                   daughterFloatLevel));
+          break;
+
+        case SpFission:
+          theDecayTable->Insert(new G4SFDecay(&theParentNucleus, b, Q,
+                                              daughterExcitation,
+                                              daughterFloatLevel));
+          break;
+
+        case Triton:
+          theDecayTable->Insert(new G4TritonDecay(&theParentNucleus, b, Q,
+                                                  daughterExcitation,
+                                                  daughterFloatLevel));
+          break;
+
+        default:
+          // Other modes are not yet implemented and not stored in the database
+          break;
+      }  // switch
+    }
 
     // Go through the decay table and make sure that the branching ratios are
     // correctly normalised.
 
     G4VDecayChannel* theChannel = 0;
     G4NuclearDecay* theNuclearDecayChannel = 0;
-    G4String mode = "";
+    G4RadioactiveDecayMode theDecayMode;
 
     G4double theBR = 0.0;
     for (G4int i = 0; i < theDecayTable->entries(); i++) {
@@ -882,19 +620,16 @@ G4RadioactiveDecay::LoadDecayTable(const G4ParticleDefinition& theParentNucleus)
 
       if (theDecayMode != IT) {
 	theBR = theChannel->GetBR();
-	theChannel->SetBR(theBR*modeTotalBR[theDecayMode]/modeSumBR[theDecayMode]);
+	theChannel->SetBR(theBR*level->modeTotalBR[theDecayMode]/level->modeSumBR[theDecayMode]);
       }
     }
-  }  // decay file exists
-
-  DecaySchemeFile.close();
+  }
 
-  if (!found && levelEnergy > 0) {
+  if (!level && levelEnergy > 0) {
     // Case where IT cascade for excited isotopes has no entries in RDM database
     // Decay mode is isomeric transition.
     G4ITDecay* anITChannel = new G4ITDecay(&theParentNucleus, 1.0, 0.0, 0.0,
                                            photonEvaporation);
-//    anITChannel->SetHLThreshold(halflifethreshold);
     anITChannel->SetARM(applyARM);
     theDecayTable->Insert(anITChannel);
   }
@@ -903,9 +638,6 @@ G4RadioactiveDecay::LoadDecayTable(const G4ParticleDefinition& theParentNucleus)
     theDecayTable->DumpInfo();
   }
 
-#ifdef G4MULTITHREADED
-  //(*master_dkmap)[key] = theDecayTable;                  // store in master library 
-#endif
   return theDecayTable;
 }
 
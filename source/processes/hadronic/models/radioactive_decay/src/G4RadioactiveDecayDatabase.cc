@@ -0,0 +1,415 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+//  File:   G4RadioactiveDecayDatabase.cc                                     //
+//  Date:   19 October 2026                                                   //
+//  Description: thread-shared registry of the parsed RadioactiveDecay data   //
+//               files, with optional binary storage of the whole database.  //
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "G4RadioactiveDecayDatabase.hh"
+#include "G4AutoLock.hh"
+#include "G4SystemOfUnits.hh"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+  const char binaryTag[8] = "G4RDDB1";
+
+  template <typename T>
+  void WriteValue(std::ofstream& out, const T& value)
+  {
+    out.write((const char*)(&value), sizeof(T));
+  }
+
+  template <typename T>
+  G4bool ReadValue(std::ifstream& in, T& value)
+  {
+    in.read((char*)(&value), sizeof(T));
+    return !in.fail();
+  }
+}
+
+
+G4RadioactiveDecayDatabase* G4RadioactiveDecayDatabase::GetInstance()
+{
+  static G4RadioactiveDecayDatabase theDatabase;
+  return &theDatabase;
+}
+
+
+G4RadioactiveDecayDatabase::G4RadioactiveDecayDatabase()
+ : fLevels(new std::atomic<const G4RadioactiveDecayLevelList*>[(ZMAX+1)*(AMAX+1)]),
+   fNumberOfIsotopes(0)
+{
+  G4MUTEXINIT(fMutex);
+  for (G4int i = 0; i < (ZMAX+1)*(AMAX+1); ++i) {
+    fLevels[i].store(nullptr, std::memory_order_relaxed);
+  }
+  char* path_var = std::getenv("G4RADIOACTIVEDATA");
+  if (path_var) fDirPath = path_var;
+}
+
+
+G4RadioactiveDecayDatabase::~G4RadioactiveDecayDatabase()
+{
+  for (G4int i = 0; i < (ZMAX+1)*(AMAX+1); ++i) {
+    delete fLevels[i].load(std::memory_order_relaxed);
+  }
+  G4MUTEXDESTROY(fMutex);
+}
+
+
+G4int G4RadioactiveDecayDatabase::Index(G4int Z, G4int A)
+{
+  if (Z < 0 || Z > ZMAX || A < 0 || A > AMAX) return -1;
+  return Z*(AMAX+1) + A;
+}
+
+
+const G4RadioactiveDecayLevelList*
+G4RadioactiveDecayDatabase::Register(G4int index,
+                                     G4RadioactiveDecayLevelList* levels)
+{
+  const G4RadioactiveDecayLevelList* current =
+    fLevels[index].load(std::memory_order_relaxed);
+  if (current) {
+    delete levels;
+    return current;
+  }
+  fLevels[index].store(levels, std::memory_order_release);
+  ++fNumberOfIsotopes;
+  return levels;
+}
+
+
+const G4RadioactiveDecayLevelList*
+G4RadioactiveDecayDatabase::GetLevels(G4int Z, G4int A)
+{
+  G4int index = Index(Z, A);
+  if (index < 0) {
+    G4ExceptionDescription ed;
+    ed << "Isotope Z=" << Z << " A=" << A << " is outside the database range;"
+       << " no decay data";
+    G4Exception("G4RadioactiveDecayDatabase::GetLevels()", "HAD_RDM_300",
+                JustWarning, ed);
+    return nullptr;
+  }
+
+  // Lock-free path once the isotope has been registered
+  const G4RadioactiveDecayLevelList* levels =
+    fLevels[index].load(std::memory_order_acquire);
+  if (levels) return levels;
+
+  G4AutoLock lk(&fMutex);
+  levels = fLevels[index].load(std::memory_order_relaxed);
+  if (levels) return levels;
+
+  std::ostringstream os;
+  os << fDirPath << "/z" << Z << ".a" << A;
+  G4RadioactiveDecayLevelList* parsed = new G4RadioactiveDecayLevelList;
+  ParseFile(os.str(), *parsed);
+  return Register(index, parsed);
+}
+
+
+const G4RadioactiveDecayLevelData*
+G4RadioactiveDecayDatabase::FindLevel(const G4RadioactiveDecayLevelList& levels,
+                                      G4double excitation,
+                                      G4Ions::G4FloatLevelBase floatLevel,
+                                      G4double tolerance)
+{
+  // Take first level which matches excitation energy regardless of floating
+  // level, unless a floating level is specified
+  for (const auto& level : levels) {
+    if (std::abs(level.excitation - excitation) >= tolerance) continue;
+    if (floatLevel != noFloat && floatLevel != level.floatLevel) continue;
+    return &level;
+  }
+  return nullptr;
+}
+
+
+G4bool G4RadioactiveDecayDatabase::ParseFile(const G4String& fileName,
+                                             G4RadioactiveDecayLevelList& levels)
+{
+  std::ifstream DecaySchemeFile;
+  DecaySchemeFile.open(fileName);
+  if (!DecaySchemeFile.good()) return false;
+
+  const G4int nMode = G4RadioactiveDecayModeSize;
+
+  char inputChars[120]={' '};
+  G4String inputLine;
+  G4String recordType("");
+  G4String floatingFlag("");
+  G4String daughterFloatFlag("");
+  G4RadioactiveDecayMode theDecayMode;
+  G4double decayModeTotal(0.0);
+  G4double parentExcitation(0.0);
+  G4double a(0.0);
+  G4double b(0.0);
+  G4double c(0.0);
+  G4double dummy(0.0);
+  G4BetaDecayType betaType(allowed);
+
+  // Records preceding the first parent record are ignored
+  G4RadioactiveDecayLevelData* level = nullptr;
+
+  G4int loop = 0;
+  while (!DecaySchemeFile.getline(inputChars, 120).eof()) {  /* Loop checking, 01.09.2015, D.Wright */
+    loop++;
+    if (loop > 100000) {
+      G4Exception("G4RadioactiveDecayDatabase::ParseFile()", "HAD_RDM_100",
+                  JustWarning, "While loop count exceeded");
+      break;
+    }
+
+    inputLine = inputChars;
+    G4StrUtil::rstrip(inputLine);
+    if (inputChars[0] == '#' || inputLine.length() == 0) continue;
+
+    std::istringstream tmpStream(inputLine);
+
+    if (inputChars[0] == 'P') {
+      // New parent level; "dummy" takes the place of half-life
+      tmpStream >> recordType >> parentExcitation >> floatingFlag >> dummy;
+
+      G4RadioactiveDecayLevelData newLevel;
+      newLevel.excitation = parentExcitation*keV;
+      newLevel.floatLevel = G4Ions::FloatLevelBase(floatingFlag.back());
+      newLevel.modeTotalBR.assign(nMode, 0.0);
+      newLevel.modeSumBR.assign(nMode, 0.0);
+      levels.push_back(newLevel);
+      level = &levels.back();
+
+    } else if (level) {
+      // Store the total decay probability of each decay mode; isomeric
+      // transitions are given by the total only
+      if (inputLine.length() < 72) {
+        tmpStream >> theDecayMode >> dummy >> decayModeTotal;
+        switch (theDecayMode) {
+          case IT:
+            level->channels.push_back({IT, decayModeTotal, 0.0, 0.0,
+                                       noFloat, allowed});
+            break;
+          case BetaMinus: case BetaPlus:
+          case KshellEC: case LshellEC: case MshellEC: case NshellEC:
+          case Alpha: case Proton: case Neutron: case SpFission:
+          case Triton:
+            level->modeTotalBR[theDecayMode] = decayModeTotal;
+            break;
+          case BDProton: case BDNeutron: case Beta2Minus: case Beta2Plus:
+          case Proton2: case Neutron2:
+            /* Not yet implemented */  break;
+          case RDM_ERROR:
+
+          default:
+            G4Exception("G4RadioactiveDecayDatabase::ParseFile()", "HAD_RDM_000",
+                        FatalException, "Selected decay mode does not exist");
+        }  // switch
+
+      } else {
+        // Allowed transitions are the default. Forbidden transitions are
+        // indicated in the last column.
+        if (inputLine.length() < 84) {
+          tmpStream >> theDecayMode >> a >> daughterFloatFlag >> b >> c;
+          betaType = allowed;
+        } else {
+          tmpStream >> theDecayMode >> a >> daughterFloatFlag >> b >> c >> betaType;
+        }
+        a /= 1000.;
+        c /= 1000.;
+        b /= 100.;
+
+        switch (theDecayMode) {
+          case BetaMinus: case BetaPlus:
+          case KshellEC: case LshellEC: case MshellEC: case NshellEC:
+          case Alpha: case Proton: case Neutron: case SpFission:
+          case Triton:
+            level->channels.push_back({theDecayMode, b, a*MeV, c*MeV,
+                                       G4Ions::FloatLevelBase(daughterFloatFlag.back()),
+                                       betaType});
+            level->modeSumBR[theDecayMode] += b;
+            break;
+          case BDProton: case BDNeutron: case Beta2Minus: case Beta2Plus:
+          case Proton2: case Neutron2:
+            /* Not yet implemented */  break;
+          case RDM_ERROR:
+
+          default:
+            G4Exception("G4RadioactiveDecayDatabase::ParseFile()", "HAD_RDM_000",
+                        FatalException, "Selected decay mode does not exist");
+        }  // switch
+      }  // line < 72
+    }  // if char == P
+  }  // While
+
+  DecaySchemeFile.close();
+  return true;
+}
+
+
+G4bool G4RadioactiveDecayDatabase::StoreBinary(const G4String& fileName)
+{
+  // Parse every isotope of the database not yet registered
+  for (G4int Z = 1; Z <= ZMAX; ++Z) {
+    for (G4int A = Z; A <= AMAX; ++A) GetLevels(Z, A);
+  }
+
+  std::ofstream out(fileName, std::ios::out|std::ios::binary);
+  if (!out) {
+    G4ExceptionDescription ed;
+    ed << "Cannot open " << fileName << " for writing";
+    G4Exception("G4RadioactiveDecayDatabase::StoreBinary()", "HAD_RDM_301",
+                JustWarning, ed);
+    return false;
+  }
+
+  out.write(binaryTag, sizeof(binaryTag));
+
+  G4int nIsotopes = 0;
+  for (G4int i = 0; i < (ZMAX+1)*(AMAX+1); ++i) {
+    const G4RadioactiveDecayLevelList* levels = fLevels[i].load(std::memory_order_acquire);
+    if (levels && !levels->empty()) ++nIsotopes;
+  }
+  WriteValue(out, nIsotopes);
+
+  for (G4int i = 0; i < (ZMAX+1)*(AMAX+1); ++i) {
+    const G4RadioactiveDecayLevelList* levels = fLevels[i].load(std::memory_order_acquire);
+    if (!levels || levels->empty()) continue;
+
+    G4int Z = i/(AMAX+1);
+    G4int A = i%(AMAX+1);
+    G4int nLevels = (G4int)levels->size();
+    WriteValue(out, Z);
+    WriteValue(out, A);
+    WriteValue(out, nLevels);
+
+    for (const auto& level : *levels) {
+      G4int floatLevel = static_cast<G4int>(level.floatLevel);
+      G4int nMode = (G4int)level.modeTotalBR.size();
+      G4int nChannels = (G4int)level.channels.size();
+      WriteValue(out, level.excitation);
+      WriteValue(out, floatLevel);
+      WriteValue(out, nMode);
+      for (G4int iMode = 0; iMode < nMode; ++iMode) {
+        WriteValue(out, level.modeTotalBR[iMode]);
+        WriteValue(out, level.modeSumBR[iMode]);
+      }
+      WriteValue(out, nChannels);
+      for (const auto& channel : level.channels) {
+        G4int mode = channel.mode;
+        G4int daughterFloatLevel = static_cast<G4int>(channel.daughterFloatLevel);
+        G4int betaType = channel.betaType;
+        WriteValue(out, mode);
+        WriteValue(out, channel.branchingRatio);
+        WriteValue(out, channel.daughterExcitation);
+        WriteValue(out, channel.Q);
+        WriteValue(out, daughterFloatLevel);
+        WriteValue(out, betaType);
+      }
+    }
+  }
+
+  out.close();
+  return !out.fail();
+}
+
+
+G4bool G4RadioactiveDecayDatabase::RetrieveBinary(const G4String& fileName)
+{
+  std::ifstream in(fileName, std::ios::in|std::ios::binary);
+  char tag[sizeof(binaryTag)] = {0};
+  in.read(tag, sizeof(tag));
+  G4int nIsotopes = 0;
+  G4bool ok = !in.fail() && std::memcmp(tag, binaryTag, sizeof(tag)) == 0
+              && ReadValue(in, nIsotopes) && nIsotopes >= 0;
+
+  // Read everything before publishing anything
+  std::vector<std::pair<G4int, G4RadioactiveDecayLevelList*> > isotopes;
+
+  for (G4int n = 0; ok && n < nIsotopes; ++n) {
+    G4int Z = 0, A = 0, nLevels = 0;
+    ok = ReadValue(in, Z) && ReadValue(in, A) && ReadValue(in, nLevels)
+         && Index(Z, A) >= 0 && nLevels >= 0;
+    if (!ok) break;
+
+    G4RadioactiveDecayLevelList* levels = new G4RadioactiveDecayLevelList(nLevels);
+    isotopes.push_back(std::make_pair(Index(Z, A), levels));
+
+    for (auto& level : *levels) {
+      G4int floatLevel = 0, nMode = 0, nChannels = 0;
+      ok = ReadValue(in, level.excitation) && ReadValue(in, floatLevel)
+           && ReadValue(in, nMode) && nMode == G4RadioactiveDecayModeSize;
+      if (!ok) break;
+      level.floatLevel = G4Ions::FloatLevelBase(floatLevel);
+      level.modeTotalBR.resize(nMode);
+      level.modeSumBR.resize(nMode);
+      for (G4int iMode = 0; ok && iMode < nMode; ++iMode) {
+        ok = ReadValue(in, level.modeTotalBR[iMode])
+             && ReadValue(in, level.modeSumBR[iMode]);
+      }
+      ok = ok && ReadValue(in, nChannels) && nChannels >= 0;
+      if (!ok) break;
+
+      level.channels.resize(nChannels);
+      for (auto& channel : level.channels) {
+        G4int mode = 0, daughterFloatLevel = 0, betaType = 0;
+        ok = ReadValue(in, mode) && ReadValue(in, channel.branchingRatio)
+             && ReadValue(in, channel.daughterExcitation) && ReadValue(in, channel.Q)
+             && ReadValue(in, daughterFloatLevel) && ReadValue(in, betaType)
+             && mode >= 0 && mode < G4RadioactiveDecayModeSize;
+        if (!ok) break;
+        channel.mode = G4RadioactiveDecayMode(mode);
+        channel.daughterFloatLevel = G4Ions::FloatLevelBase(daughterFloatLevel);
+        channel.betaType = G4BetaDecayType(betaType);
+      }
+      if (!ok) break;
+    }
+  }
+
+  if (!ok) {
+    for (auto& isotope : isotopes) delete isotope.second;
+    G4ExceptionDescription ed;
+    ed << fileName << " is not a valid radioactive decay database file";
+    G4Exception("G4RadioactiveDecayDatabase::RetrieveBinary()", "HAD_RDM_302",
+                JustWarning, ed);
+    return false;
+  }
+
+  G4AutoLock lk(&fMutex);
+  for (auto& isotope : isotopes) Register(isotope.first, isotope.second);
+  return true;
+}
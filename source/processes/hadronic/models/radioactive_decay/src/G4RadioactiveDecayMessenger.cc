@@ -38,6 +38,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "G4RadioactiveDecayMessenger.hh"
+#include "G4RadioactiveDecayDatabase.hh"
 #include "G4NuclearLevelData.hh"
 #include <sstream>
 #include "G4HadronicException.hh"
@@ -143,6 +144,20 @@ G4RadioactiveDecayMessenger::G4RadioactiveDecayMessenger
   thresholdForVeryLongDecayTimeCmd->SetGuidance("Ignore decays at rest of nuclides happening after this time threshold");
   thresholdForVeryLongDecayTimeCmd->SetParameterName("ThresholdForVeryLongDecayTime",false);
   thresholdForVeryLongDecayTimeCmd->SetUnitCategory("Time");
+
+  // Commands to write and read the whole parsed decay database in binary
+  // form; the database is shared by all threads, hence not broadcasted
+  storeDatabaseCmd = new G4UIcmdWithAString("/process/had/rdm/storeDatabase",this);
+  storeDatabaseCmd->SetGuidance("Parse all files of the radioactive decay database");
+  storeDatabaseCmd->SetGuidance("and write them in a single binary file");
+  storeDatabaseCmd->SetParameterName("file_name",false);
+  storeDatabaseCmd->SetToBeBroadcasted(false);
+
+  retrieveDatabaseCmd = new G4UIcmdWithAString("/process/had/rdm/retrieveDatabase",this);
+  retrieveDatabaseCmd->SetGuidance("Read the radioactive decay database from a binary file");
+  retrieveDatabaseCmd->SetGuidance("written by /process/had/rdm/storeDatabase");
+  retrieveDatabaseCmd->SetParameterName("file_name",false);
+  retrieveDatabaseCmd->SetToBeBroadcasted(false);
 }
 
 
@@ -162,6 +177,8 @@ G4RadioactiveDecayMessenger::~G4RadioactiveDecayMessenger ()
   delete colldirCmd;
   delete collangleCmd;
   delete thresholdForVeryLongDecayTimeCmd;
+  delete storeDatabaseCmd;
+  delete retrieveDatabaseCmd;
 }
 
 
@@ -205,6 +222,10 @@ G4RadioactiveDecayMessenger::SetNewValue(G4UIcommand *command, G4String newValue
     theRadioactiveDecayContainer->SetDecayHalfAngle( collangleCmd->GetNewDoubleValue( newValues ) );
   } else if ( command == thresholdForVeryLongDecayTimeCmd ) {
     theRadioactiveDecayContainer->SetThresholdForVeryLongDecayTime( thresholdForVeryLongDecayTimeCmd->GetNewDoubleValue( newValues ) );
+  } else if ( command == storeDatabaseCmd ) {
+    G4RadioactiveDecayDatabase::GetInstance()->StoreBinary( newValues );
+  } else if ( command == retrieveDatabaseCmd ) {
+    G4RadioactiveDecayDatabase::GetInstance()->RetrieveBinary( newValues );
   }
 }
 
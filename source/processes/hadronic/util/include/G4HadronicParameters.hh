@@ -127,6 +127,28 @@ class G4HadronicParameters {
     // Boolean switch that allows to apply the Cosmic Ray (CR) coalescence algorithm
     // to the secondaries produced by a string model. By default it is disabled.
 
+    G4int GetFinalStateReservoirSize() const;
+    void SetFinalStateReservoirSize( G4int val );
+    // Number of final states pre-generated and cached per (projectile, model,
+    // isotope, log-energy bin) by inelastic hadronic processes, which then
+    // sample from this reservoir instead of calling the model.
+    // This is an approximation for thick-target (e.g. shielding) studies;
+    // by default it is 0, i.e. disabled.
+
+    G4int GetFinalStateReservoirBinsPerDecade() const;
+    void SetFinalStateReservoirBinsPerDecade( G4int val );
+    // Number of kinetic energy bins per decade of the final state reservoir.
+
+    G4double GetFinalStateRefreshFraction() const;
+    void SetFinalStateRefreshFraction( G4double val );
+    // Fraction of interactions for which the model is still called and its
+    // final state replaces a random entry of the reservoir.
+
+    G4double GetFinalStateValidationFraction() const;
+    void SetFinalStateValidationFraction( G4double val );
+    // Fraction of interactions for which the model is called in order to
+    // compare fresh and cached final states; the bias is printed at the end.
+
   private:
     G4HadronicParameters();
 
@@ -159,6 +181,11 @@ class G4HadronicParameters {
     G4bool   fEnableHyperNuclei = false;
     G4bool   fApplyFactorXS = false;
     G4bool   fEnableCRCoalescence = false;
+
+    G4int    fFinalStateReservoirSize = 0;
+    G4int    fFinalStateReservoirBinsPerDecade = 20;
+    G4double fFinalStateRefreshFraction = 0.01;
+    G4double fFinalStateValidationFraction = 0.0;
 };
 
 inline G4double G4HadronicParameters::GetMaxEnergy() const { 
@@ -232,4 +259,20 @@ inline G4bool G4HadronicParameters::EnableCRCoalescence() const {
   return fEnableCRCoalescence;
 }
 
+inline G4int G4HadronicParameters::GetFinalStateReservoirSize() const {
+  return fFinalStateReservoirSize;
+}
+
+inline G4int G4HadronicParameters::GetFinalStateReservoirBinsPerDecade() const {
+  return fFinalStateReservoirBinsPerDecade;
+}
+
+inline G4double G4HadronicParameters::GetFinalStateRefreshFraction() const {
+  return fFinalStateRefreshFraction;
+}
+
+inline G4double G4HadronicParameters::GetFinalStateValidationFraction() const {
+  return fFinalStateValidationFraction;
+}
+
 #endif
@@ -41,6 +41,7 @@
 class G4UIdirectory;
 class G4UIcommand;
 class G4UIcmdWithAnInteger;
+class G4UIcmdWithADouble;
 class G4UIcmdWithADoubleAndUnit;
 class G4UIcmdWithABool;
 class G4HadronicParameters;
@@ -57,6 +58,10 @@ class G4HadronicParametersMessenger : public G4UImessenger {
     G4UIcmdWithAnInteger* theVerboseCmd;
     G4UIcmdWithADoubleAndUnit* theMaxEnergyCmd;
     G4UIcmdWithABool* theCRCoalescenceCmd;
+    G4UIcmdWithAnInteger* theReservoirSizeCmd;
+    G4UIcmdWithAnInteger* theReservoirBinsCmd;
+    G4UIcmdWithADouble* theReservoirRefreshCmd;
+    G4UIcmdWithADouble* theReservoirValidationCmd;
 };
 
 #endif
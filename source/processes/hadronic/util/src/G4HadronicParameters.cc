@@ -202,3 +202,23 @@ void G4HadronicParameters::SetApplyFactorXS( G4bool val ) {
 void G4HadronicParameters::SetEnableCRCoalescence( G4bool val ) {
   if ( ! IsLocked() ) fEnableCRCoalescence = val;
 }
+
+
+void G4HadronicParameters::SetFinalStateReservoirSize( G4int val ) {
+  if ( ! IsLocked()  &&  val >= 0 ) fFinalStateReservoirSize = val;
+}
+
+
+void G4HadronicParameters::SetFinalStateReservoirBinsPerDecade( G4int val ) {
+  if ( ! IsLocked()  &&  val > 0 ) fFinalStateReservoirBinsPerDecade = val;
+}
+
+
+void G4HadronicParameters::SetFinalStateRefreshFraction( G4double val ) {
+  if ( ! IsLocked()  &&  val >= 0.0  &&  val <= 1.0 ) fFinalStateRefreshFraction = val;
+}
+
+
+void G4HadronicParameters::SetFinalStateValidationFraction( G4double val ) {
+  if ( ! IsLocked()  &&  val >= 0.0  &&  val <= 1.0 ) fFinalStateValidationFraction = val;
+}
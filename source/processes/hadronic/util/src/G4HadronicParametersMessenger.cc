@@ -35,6 +35,7 @@
 #include "G4UIdirectory.hh"
 #include "G4UIcommand.hh"
 #include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithADouble.hh"
 #include "G4UIcmdWithADoubleAndUnit.hh"
 #include "G4UIcmdWithABool.hh"
 #include "G4HadronicParameters.hh"
@@ -71,6 +72,32 @@ G4HadronicParametersMessenger::G4HadronicParametersMessenger( G4HadronicParamete
   theCRCoalescenceCmd->SetGuidance( "Enable Cosmic Ray (CR) coalescence." );
   theCRCoalescenceCmd->SetParameterName( "EnableCRCoalescence", false );
   theCRCoalescenceCmd->SetDefaultValue( false );
+
+  // These commands configure the reservoir of pre-generated final states
+  // of inelastic hadronic processes (an approximation, disabled by default)
+  theReservoirSizeCmd = new G4UIcmdWithAnInteger( "/process/had/finalStateReservoir", this );
+  theReservoirSizeCmd->SetGuidance( "Number of cached final states per projectile, isotope and energy bin (0 = disabled)" );
+  theReservoirSizeCmd->SetParameterName( "ReservoirSize", false );
+  theReservoirSizeCmd->SetRange( "ReservoirSize>=0" );
+  theReservoirSizeCmd->AvailableForStates( G4State_PreInit );
+
+  theReservoirBinsCmd = new G4UIcmdWithAnInteger( "/process/had/finalStateBinsPerDecade", this );
+  theReservoirBinsCmd->SetGuidance( "Number of kinetic energy bins per decade of the final state reservoir" );
+  theReservoirBinsCmd->SetParameterName( "BinsPerDecade", false );
+  theReservoirBinsCmd->SetRange( "BinsPerDecade>0" );
+  theReservoirBinsCmd->AvailableForStates( G4State_PreInit );
+
+  theReservoirRefreshCmd = new G4UIcmdWithADouble( "/process/had/finalStateRefresh", this );
+  theReservoirRefreshCmd->SetGuidance( "Fraction of interactions refreshing the final state reservoir" );
+  theReservoirRefreshCmd->SetParameterName( "Refresh", false );
+  theReservoirRefreshCmd->SetRange( "Refresh>=0.0 && Refresh<=1.0" );
+  theReservoirRefreshCmd->AvailableForStates( G4State_PreInit );
+
+  theReservoirValidationCmd = new G4UIcmdWithADouble( "/process/had/finalStateValidation", this );
+  theReservoirValidationCmd->SetGuidance( "Fraction of interactions used to measure the bias of the final state reservoir" );
+  theReservoirValidationCmd->SetParameterName( "Validation", false );
+  theReservoirValidationCmd->SetRange( "Validation>=0.0 && Validation<=1.0" );
+  theReservoirValidationCmd->AvailableForStates( G4State_PreInit );
 }
 
 
@@ -79,6 +106,10 @@ G4HadronicParametersMessenger::~G4HadronicParametersMessenger() {
   delete theVerboseCmd;
   delete theMaxEnergyCmd;
   delete theCRCoalescenceCmd;
+  delete theReservoirSizeCmd;
+  delete theReservoirBinsCmd;
+  delete theReservoirRefreshCmd;
+  delete theReservoirValidationCmd;
 }
 
 
@@ -92,5 +123,13 @@ void G4HadronicParametersMessenger::SetNewValue( G4UIcommand *command, G4String
     theHadronicParameters->SetMaxEnergy( theMaxEnergyCmd->GetNewDoubleValue( newValues ) );
   } else if ( command == theCRCoalescenceCmd ) {
     theHadronicParameters->SetEnableCRCoalescence( theCRCoalescenceCmd->GetNewBoolValue( newValues ) );
+  } else if ( command == theReservoirSizeCmd ) {
+    theHadronicParameters->SetFinalStateReservoirSize( theReservoirSizeCmd->GetNewIntValue( newValues ) );
+  } else if ( command == theReservoirBinsCmd ) {
+    theHadronicParameters->SetFinalStateReservoirBinsPerDecade( theReservoirBinsCmd->GetNewIntValue( newValues ) );
+  } else if ( command == theReservoirRefreshCmd ) {
+    theHadronicParameters->SetFinalStateRefreshFraction( theReservoirRefreshCmd->GetNewDoubleValue( newValues ) );
+  } else if ( command == theReservoirValidationCmd ) {
+    theHadronicParameters->SetFinalStateValidationFraction( theReservoirValidationCmd->GetNewDoubleValue( newValues ) );
   }
 }
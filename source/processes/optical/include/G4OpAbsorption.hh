@@ -50,6 +50,7 @@
 
 #include "G4VDiscreteProcess.hh"
 #include "G4OpticalPhoton.hh"
+#include "G4OpPropertyLookupTable.hh"
 
 class G4OpAbsorption : public G4VDiscreteProcess
 {
@@ -62,6 +63,10 @@ class G4OpAbsorption : public G4VDiscreteProcess
     const G4ParticleDefinition& aParticleType) override;
   // Returns true -> 'is applicable' only for an optical photon.
 
+  virtual void BuildPhysicsTable(
+    const G4ParticleDefinition& aParticleType) override;
+  // Builds the per-material lookup of the absorption length vectors
+
   virtual G4double GetMeanFreePath(const G4Track& aTrack, G4double,
                                    G4ForceCondition*) override;
   // Returns the absorption length for bulk absorption of optical
@@ -81,7 +86,7 @@ class G4OpAbsorption : public G4VDiscreteProcess
   G4OpAbsorption(const G4OpAbsorption& right) = delete;
   G4OpAbsorption& operator=(const G4OpAbsorption& right) = delete;
 
-  size_t idx_absorption = 0;
+  G4OpPropertyLookupTable fAbsLengthLookup;
 };
 
 // Inline methods
@@ -66,11 +66,14 @@
 #ifndef G4OpBoundaryProcess_h
 #define G4OpBoundaryProcess_h 1
 
+#include "G4OpPropertyLookupTable.hh"
 #include "G4OpticalPhoton.hh"
 #include "G4OpticalSurface.hh"
 #include "G4RandomTools.hh"
 #include "G4VDiscreteProcess.hh"
 
+#include <unordered_map>
+
 enum G4OpBoundaryProcessStatus
 {
   Undefined,
@@ -115,6 +118,8 @@ enum G4OpBoundaryProcessStatus
   Dichroic
 };
 
+class G4OpSurfaceLUT;
+
 class G4OpBoundaryProcess : public G4VDiscreteProcess
 {
  public:
@@ -144,6 +149,10 @@ class G4OpBoundaryProcess : public G4VDiscreteProcess
 
   virtual void PreparePhysicsTable(const G4ParticleDefinition&) override;
 
+  virtual void BuildPhysicsTable(const G4ParticleDefinition&) override;
+  // Builds the per-material lookup of the RINDEX and GROUPVEL vectors and
+  // the sampling tables of LUT and DAVIS surfaces
+
   virtual void Initialise();
 
   void SetVerboseLevel(G4int);
@@ -163,6 +172,9 @@ class G4OpBoundaryProcess : public G4VDiscreteProcess
   void DielectricLUT();
   void DielectricLUTDAVIS();
 
+  const G4OpSurfaceLUT* GetSurfaceLUT();
+  // Returns the flattened look-up-tables of the current optical surface
+
   void DielectricDichroic();
 
   void ChooseReflection();
@@ -224,7 +236,6 @@ class G4OpBoundaryProcess : public G4VDiscreteProcess
 
   size_t idx_dichroicX      = 0;
   size_t idx_dichroicY      = 0;
-  size_t idx_rindex1        = 0;
   size_t idx_rindex_surface = 0;
   size_t idx_reflect        = 0;
   size_t idx_eff            = 0;
@@ -232,11 +243,16 @@ class G4OpBoundaryProcess : public G4VDiscreteProcess
   size_t idx_lobe           = 0;
   size_t idx_spike          = 0;
   size_t idx_back           = 0;
-  size_t idx_rindex2        = 0;
-  size_t idx_groupvel       = 0;
   size_t idx_rrindex        = 0;
   size_t idx_irindex        = 0;
 
+  G4OpPropertyLookupTable fRindexLookup;
+  G4OpPropertyLookupTable fGroupVelLookup;
+
+  std::unordered_map<const G4OpticalSurface*, const G4OpSurfaceLUT*>
+    fSurfaceLUTs;
+  G4int fSurfaceLUTGeneration = -1;
+
   G4bool fInvokeSD;
 };
 
@@ -0,0 +1,153 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+////////////////////////////////////////////////////////////////////////
+// Optical Property Lookup Table Class Definition
+////////////////////////////////////////////////////////////////////////
+//
+// File:        G4OpPropertyLookupTable.hh
+// Description: Per-material O(1) bin lookup for optical property vectors.
+//              For each material a uniform grid over the energy range of
+//              the property vector stores the first vector bin touched by
+//              every grid cell. A lookup then needs one multiplication and
+//              at most a couple of comparisons to find the bin, instead of
+//              a binary search over the (non-uniform) free vector, and does
+//              not depend on a process-wide "last bin" cache that is
+//              invalidated each time the photon changes material.
+//              The property vectors are owned by the material properties
+//              tables, which may replace them after the table is built
+//              (e.g. GROUPVEL is recomputed when RINDEX changes): they are
+//              fetched by index at each lookup, and the grid of a material
+//              is only used for the vector it was built from.
+//              The interpolation itself is delegated to G4PhysicsVector,
+//              so returned values are identical to G4PhysicsVector::Value().
+//
+////////////////////////////////////////////////////////////////////////
+
+#ifndef G4OpPropertyLookupTable_h
+#define G4OpPropertyLookupTable_h 1
+
+#include "globals.hh"
+#include "G4PhysicsVector.hh"
+
+#include <vector>
+
+class G4Material;
+class G4PhysicsTable;
+
+class G4OpPropertyLookupTable
+{
+ public:
+  G4OpPropertyLookupTable()  = default;
+  ~G4OpPropertyLookupTable() = default;
+
+  void Build(G4int propertyIndex);
+  // Builds the lookup grids for the given material property (e.g.
+  // kRINDEX) of all materials currently in the material table.
+
+  void Build(const G4PhysicsTable* table);
+  // Builds the lookup grids for a table of per-material vectors indexed
+  // by material index (e.g. the G4OpRayleigh physics table).
+
+  void Clear();
+
+  const G4PhysicsVector* GetProperty(const G4Material* material) const;
+  // Returns the current property vector of the material, or nullptr if
+  // the material has none. For a table built from a G4PhysicsTable,
+  // returns the vector of the table.
+
+  inline G4double Value(const G4PhysicsVector* vec, std::size_t materialIndex,
+                        G4double energy) const;
+  // Returns vec->Value(energy). If vec is the vector the grid for this
+  // material was built from, the bin is found in constant time; otherwise
+  // (material created or property replaced after Build) falls back to
+  // the generic lookup. The bin found on the grid is checked by
+  // G4PhysicsVector::Value(), so a vector reallocated at the address of
+  // the original one still gets exact values.
+
+  inline std::size_t GetNumberOfMaterials() const;
+
+ private:
+  void AddEntry(const G4PhysicsVector* vec);
+
+  struct Entry
+  {
+    const G4PhysicsVector* fVector = nullptr;
+    G4double fEmin                 = 0.;
+    G4double fEmax                 = 0.;
+    G4double fInvCellWidth         = 0.;
+    std::size_t fFirstCell         = 0;
+    std::size_t fNCells            = 0;
+    std::size_t fLastBin           = 0;
+  };
+
+  std::vector<Entry> fEntries;
+  G4int fPropertyIndex = -1;
+  // Material property the table was built for, -1 for a physics table
+  std::vector<std::size_t> fCellBins;
+  // Flat storage of the grids of all materials; the grid of material i
+  // starts at fEntries[i].fFirstCell
+};
+
+////////////////////
+// Inline methods
+////////////////////
+
+inline G4double G4OpPropertyLookupTable::Value(const G4PhysicsVector* vec,
+                                               std::size_t materialIndex,
+                                               G4double energy) const
+{
+  if(materialIndex >= fEntries.size() ||
+     fEntries[materialIndex].fVector != vec)
+  {
+    return vec->Value(energy);
+  }
+  const Entry& entry = fEntries[materialIndex];
+  if(entry.fNCells == 0 || energy <= entry.fEmin || energy >= entry.fEmax ||
+     vec->GetVectorLength() != entry.fLastBin + 2)
+  {
+    return vec->Value(energy);
+  }
+  std::size_t cell = static_cast<std::size_t>((energy - entry.fEmin) *
+                                              entry.fInvCellWidth);
+  if(cell >= entry.fNCells)
+    cell = entry.fNCells - 1;
+  std::size_t idx = fCellBins[entry.fFirstCell + cell];
+  while(idx < entry.fLastBin && energy > vec->Energy(idx + 1))
+  {
+    ++idx;
+  }
+  return vec->Value(energy, idx);
+}
+
+inline std::size_t G4OpPropertyLookupTable::GetNumberOfMaterials() const
+{
+  return fEntries.size();
+}
+
+#endif /* G4OpPropertyLookupTable_h */
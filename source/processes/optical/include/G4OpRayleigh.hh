@@ -51,6 +51,7 @@
 #include "G4VDiscreteProcess.hh"
 #include "G4OpticalPhoton.hh"
 #include "G4PhysicsTable.hh"
+#include "G4OpPropertyLookupTable.hh"
 
 class G4OpRayleigh : public G4VDiscreteProcess
 {
@@ -98,7 +99,7 @@ class G4OpRayleigh : public G4VDiscreteProcess
   G4PhysicsFreeVector* CalculateRayleighMeanFreePaths(
     const G4Material* material) const;
 
-  size_t idx_rslength = 0;
+  G4OpPropertyLookupTable fRayleighLookup;
 };
 
 ////////////////////
@@ -0,0 +1,164 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+////////////////////////////////////////////////////////////////////////
+// Optical Surface Look-Up-Table Class Definition
+////////////////////////////////////////////////////////////////////////
+//
+// File:        G4OpSurfaceLUT.hh
+// Description: Sampling tables and boundary kernels for the LBNL (LUT)
+//              and DAVIS look-up-table surface models.
+//              The tables of a G4OpticalSurface are flattened once into
+//              sampling-friendly form and shared between threads:
+//              - LBNL: cumulative distribution of the (theta, phi) cells of
+//                the angular distribution for each incident angle, which
+//                replaces the rejection loop over random cells;
+//              - DAVIS: reflectivity per incident angle and, for incident
+//                angles with empty (azimuth, elevation) entries, the list
+//                of non-empty entries, so no draw is rejected.
+//              The sampled distributions are the same as those of the
+//              rejection loops previously used in G4OpBoundaryProcess.
+//              Besides the single-photon kernels used by
+//              G4OpBoundaryProcess, batched versions process arrays of
+//              photons, e.g. for a photon-bundle transport.
+// Created:     2026-10-19
+//
+////////////////////////////////////////////////////////////////////////
+
+#ifndef G4OpSurfaceLUT_h
+#define G4OpSurfaceLUT_h 1
+
+#include "globals.hh"
+#include "G4OpBoundaryProcess.hh"
+#include "G4ThreeVector.hh"
+
+#include <vector>
+
+class G4OpticalSurface;
+
+class G4OpSurfaceLUT
+{
+ public:
+  static const G4OpSurfaceLUT* GetSurfaceLUT(G4OpticalSurface* surface);
+  // Returns the shared tables of the surface, building them on first
+  // request. Returns nullptr if the surface is not of type dielectric_LUT
+  // or dielectric_LUTDAVIS. Thread-safe.
+
+  static void Clear();
+  // Deletes all tables; must not be called while tracking. Called by
+  // G4OpBoundaryProcess on the master when the physics tables are built,
+  // so that tables of deleted surfaces are not reused
+
+  static G4int GetGeneration();
+  // Number of calls to Clear(); tables obtained before the last call
+  // must no longer be used
+
+  ~G4OpSurfaceLUT() = default;
+
+  G4OpBoundaryProcessStatus DielectricLBNL(
+    const G4ThreeVector& oldMomentum, const G4ThreeVector& oldPolarization,
+    const G4ThreeVector& normal, G4double reflectivity,
+    G4double transmittance, G4ThreeVector& newMomentum,
+    G4ThreeVector& newPolarization) const;
+  // LBNL model for one photon. Returns the finish-specific reflection
+  // status, Transmission or Absorption; for Absorption the caller decides
+  // on detection.
+
+  G4OpBoundaryProcessStatus DielectricDAVIS(
+    const G4ThreeVector& oldMomentum, const G4ThreeVector& oldPolarization,
+    const G4ThreeVector& normal, G4double efficiency,
+    G4ThreeVector& newMomentum, G4ThreeVector& newPolarization) const;
+  // DAVIS model for one photon. Returns LobeReflection, Transmission or
+  // Absorption; for Absorption the caller decides on detection.
+
+  void DielectricLBNL(std::size_t n, const G4ThreeVector* oldMomentum,
+                      const G4ThreeVector* oldPolarization,
+                      const G4ThreeVector* normal,
+                      const G4double* reflectivity,
+                      const G4double* transmittance,
+                      G4ThreeVector* newMomentum,
+                      G4ThreeVector* newPolarization,
+                      G4OpBoundaryProcessStatus* status) const;
+  void DielectricDAVIS(std::size_t n, const G4ThreeVector* oldMomentum,
+                       const G4ThreeVector* oldPolarization,
+                       const G4ThreeVector* normal, const G4double* efficiency,
+                       G4ThreeVector* newMomentum,
+                       G4ThreeVector* newPolarization,
+                       G4OpBoundaryProcessStatus* status) const;
+  // Batched versions for n photons, equivalent to n single-photon calls
+
+  inline G4bool IsLBNL() const;
+  inline G4bool IsDAVIS() const;
+
+ private:
+  explicit G4OpSurfaceLUT(G4OpticalSurface* surface);
+
+  void BuildLBNL();
+  void BuildDAVIS();
+
+  void SampleLBNLCell(G4int angleIncident, G4int& thetaIndex,
+                      G4int& phiIndex) const;
+  void SampleDAVISAngles(G4int section, G4int angleIncident,
+                         G4double& azimuth, G4double& elevation) const;
+
+  G4OpticalSurface* fSurface;
+  G4bool fDAVIS = false;
+  G4double fCarTolerance;
+
+  // LBNL
+  G4OpBoundaryProcessStatus fLBNLStatus = Undefined;
+  G4int fNIncident                      = 0;
+  G4int fNTheta                         = 0;
+  G4int fNPhi                           = 0;
+  std::vector<G4double> fLBNLCDF;
+  // cumulative cell weights, fNTheta*fNPhi entries per incident angle
+  std::vector<G4double> fThetaRad;
+  std::vector<G4double> fPhiRad;
+
+  // DAVIS
+  static const G4int fNDAVISAngles = 90;
+  G4int fLUTbins                   = 0;
+  std::vector<G4double> fDAVISReflectivity;
+  std::vector<G4int> fDAVISFirst;
+  std::vector<G4int> fDAVISCount;
+  // for [section*fNDAVISAngles + angleIncident], section 0 for reflection
+  // and 1 for transmission: first entry in fDAVISEntries and number of
+  // entries; a first entry of -1 means all fLUTbins entries are non-empty
+  std::vector<G4int> fDAVISEntries;
+  // flat list of indices of (azimuth, elevation) pairs in the surface LUT
+};
+
+////////////////////
+// Inline methods
+////////////////////
+
+inline G4bool G4OpSurfaceLUT::IsLBNL() const { return !fDAVIS; }
+
+inline G4bool G4OpSurfaceLUT::IsDAVIS() const { return fDAVIS; }
+
+#endif /* G4OpSurfaceLUT_h */
@@ -7,7 +7,9 @@ geant4_add_module(G4optical
     G4OpBoundaryProcess.hh
     G4OpMieHG.hh
     G4OpProcessSubType.hh
+    G4OpPropertyLookupTable.hh
     G4OpRayleigh.hh
+    G4OpSurfaceLUT.hh
     G4OpWLS.hh
     G4OpWLS2.hh
     G4VWLSTimeGeneratorProfile.hh
@@ -17,7 +19,9 @@ geant4_add_module(G4optical
     G4OpAbsorption.cc
     G4OpBoundaryProcess.cc
     G4OpMieHG.cc
+    G4OpPropertyLookupTable.cc
     G4OpRayleigh.cc
+    G4OpSurfaceLUT.cc
     G4OpWLS.cc
     G4OpWLS2.cc
     G4VWLSTimeGeneratorProfile.cc
@@ -81,6 +81,12 @@ void G4OpAbsorption::Initialise()
   SetVerboseLevel(G4OpticalParameters::Instance()->GetAbsorptionVerboseLevel());
 }
 
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpAbsorption::BuildPhysicsTable(const G4ParticleDefinition&)
+{
+  fAbsLengthLookup.Build(kABSLENGTH);
+}
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 G4VParticleChange* G4OpAbsorption::PostStepDoIt(const G4Track& aTrack,
                                                 const G4Step& aStep)
@@ -105,18 +111,14 @@ G4double G4OpAbsorption::GetMeanFreePath(const G4Track& aTrack, G4double,
                                          G4ForceCondition*)
 {
   const G4DynamicParticle* aParticle = aTrack.GetDynamicParticle();
-  G4MaterialPropertiesTable* MPT =
-    aTrack.GetMaterial()->GetMaterialPropertiesTable();
-  G4double attLength = DBL_MAX;
+  const G4Material* material         = aTrack.GetMaterial();
+  G4double attLength                 = DBL_MAX;
 
-  if(MPT)
+  const G4PhysicsVector* attVector = fAbsLengthLookup.GetProperty(material);
+  if(attVector)
   {
-    G4MaterialPropertyVector* attVector = MPT->GetProperty(kABSLENGTH);
-    if(attVector)
-    {
-      attLength =
-        attVector->Value(aParticle->GetTotalMomentum(), idx_absorption);
-    }
+    attLength = fAbsLengthLookup.Value(attVector, material->GetIndex(),
+                                       aParticle->GetTotalMomentum());
   }
 
   return attLength;
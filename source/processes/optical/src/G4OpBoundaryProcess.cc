@@ -82,10 +82,12 @@
 #include "G4LogicalBorderSurface.hh"
 #include "G4LogicalSkinSurface.hh"
 #include "G4OpProcessSubType.hh"
+#include "G4OpSurfaceLUT.hh"
 #include "G4OpticalParameters.hh"
 #include "G4ParallelWorldProcess.hh"
 #include "G4PhysicalConstants.hh"
 #include "G4SystemOfUnits.hh"
+#include "G4Threading.hh"
 #include "G4TransportationManager.hh"
 #include "G4VSensitiveDetector.hh"
 
@@ -136,6 +138,33 @@ void G4OpBoundaryProcess::PreparePhysicsTable(const G4ParticleDefinition&)
   Initialise();
 }
 
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpBoundaryProcess::BuildPhysicsTable(const G4ParticleDefinition&)
+{
+  fRindexLookup.Build(kRINDEX);
+  fGroupVelLookup.Build(kGROUPVEL);
+
+  // Flatten the look-up-tables of LUT and DAVIS surfaces now rather than
+  // at the first boundary crossing. The master drops the tables of a
+  // previous geometry first, as surfaces may have been deleted
+  if(G4Threading::IsMasterThread())
+    G4OpSurfaceLUT::Clear();
+  fSurfaceLUTs.clear();
+  fSurfaceLUTGeneration = G4OpSurfaceLUT::GetGeneration();
+  const G4SurfacePropertyTable* surfaces =
+    G4SurfaceProperty::GetSurfacePropertyTable();
+  for(auto surfaceProperty : *surfaces)
+  {
+    auto surface = dynamic_cast<G4OpticalSurface*>(surfaceProperty);
+    if(surface != nullptr)
+    {
+      const G4OpSurfaceLUT* lut = G4OpSurfaceLUT::GetSurfaceLUT(surface);
+      if(lut != nullptr)
+        fSurfaceLUTs[surface] = lut;
+    }
+  }
+}
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 void G4OpBoundaryProcess::Initialise()
 {
@@ -191,16 +220,11 @@ G4VParticleChange* G4OpBoundaryProcess::PostStepDoIt(const G4Track& aTrack,
     if(verboseLevel > 1)
       BoundaryProcessVerbose();
 
-    G4MaterialPropertyVector* groupvel = nullptr;
-    G4MaterialPropertiesTable* aMPT = fMaterial2->GetMaterialPropertiesTable();
-    if(aMPT != nullptr)
-    {
-      groupvel = aMPT->GetProperty(kGROUPVEL);
-    }
+    const G4PhysicsVector* groupvel = fGroupVelLookup.GetProperty(fMaterial2);
     if(groupvel != nullptr)
     {
-      aParticleChange.ProposeVelocity(
-        groupvel->Value(fPhotonMomentum, idx_groupvel));
+      aParticleChange.ProposeVelocity(fGroupVelLookup.Value(
+        groupvel, fMaterial2->GetIndex(), fPhotonMomentum));
     }
     return G4VDiscreteProcess::PostStepDoIt(aTrack, aStep);
   }
@@ -267,15 +291,11 @@ G4VParticleChange* G4OpBoundaryProcess::PostStepDoIt(const G4Track& aTrack,
 #endif
   }
 
-  G4MaterialPropertyVector* rIndexMPV = nullptr;
-  G4MaterialPropertiesTable* MPT = fMaterial1->GetMaterialPropertiesTable();
-  if(MPT != nullptr)
-  {
-    rIndexMPV = MPT->GetProperty(kRINDEX);
-  }
+  const G4PhysicsVector* rIndexMPV = fRindexLookup.GetProperty(fMaterial1);
   if(rIndexMPV != nullptr)
   {
-    fRindex1 = rIndexMPV->Value(fPhotonMomentum, idx_rindex1);
+    fRindex1 = fRindexLookup.Value(rIndexMPV, fMaterial1->GetIndex(),
+                                   fPhotonMomentum);
   }
   else
   {
@@ -415,15 +435,11 @@ G4VParticleChange* G4OpBoundaryProcess::PostStepDoIt(const G4Track& aTrack,
           BoundaryProcessVerbose();
         return G4VDiscreteProcess::PostStepDoIt(aTrack, aStep);
       }
-      MPT = fMaterial2->GetMaterialPropertiesTable();
-      rIndexMPV = nullptr;
-      if(MPT != nullptr)
-      {
-        rIndexMPV = MPT->GetProperty(kRINDEX);
-      }
+      rIndexMPV = fRindexLookup.GetProperty(fMaterial2);
       if(rIndexMPV != nullptr)
       {
-        fRindex2 = rIndexMPV->Value(fPhotonMomentum, idx_rindex2);
+        fRindex2 = fRindexLookup.Value(rIndexMPV, fMaterial2->GetIndex(),
+                                       fPhotonMomentum);
       }
       else
       {
@@ -510,16 +526,11 @@ G4VParticleChange* G4OpBoundaryProcess::PostStepDoIt(const G4Track& aTrack,
   if(fStatus == FresnelRefraction || fStatus == Transmission)
   {
     // not all surface types check that fMaterial2 has an MPT
-    G4MaterialPropertiesTable* aMPT = fMaterial2->GetMaterialPropertiesTable();
-    G4MaterialPropertyVector* groupvel = nullptr;
-    if(aMPT != nullptr)
-    {
-      groupvel = aMPT->GetProperty(kGROUPVEL);
-    }
+    const G4PhysicsVector* groupvel = fGroupVelLookup.GetProperty(fMaterial2);
     if(groupvel != nullptr)
     {
-      aParticleChange.ProposeVelocity(
-        groupvel->Value(fPhotonMomentum, idx_groupvel));
+      aParticleChange.ProposeVelocity(fGroupVelLookup.Value(
+        groupvel, fMaterial2->GetIndex(), fPhotonMomentum));
     }
   }
 
@@ -779,175 +790,49 @@ void G4OpBoundaryProcess::DielectricMetal()
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 void G4OpBoundaryProcess::DielectricLUT()
 {
-  G4int thetaIndex, phiIndex;
-  G4double angularDistVal, thetaRad, phiRad;
-  G4ThreeVector perpVectorTheta, perpVectorPhi;
+  const G4OpSurfaceLUT* lut = GetSurfaceLUT();
 
-  fStatus = G4OpBoundaryProcessStatus(
-    G4int(fFinish) + (G4int(NoRINDEX) - G4int(groundbackpainted)));
-
-  G4int thetaIndexMax = fOpticalSurface->GetThetaIndexMax();
-  G4int phiIndexMax   = fOpticalSurface->GetPhiIndexMax();
-
-  G4double rand;
-
-  do
+  fStatus = lut->DielectricLBNL(fOldMomentum, fOldPolarization, fGlobalNormal,
+                                fReflectivity, fTransmittance, fNewMomentum,
+                                fNewPolarization);
+  if(fStatus == Absorption)
   {
-    rand = G4UniformRand();
-    if(rand > fReflectivity)
-    {
-      if(rand > fReflectivity + fTransmittance)
-      {
-        DoAbsorption();
-      }
-      else
-      {
-        fStatus          = Transmission;
-        fNewMomentum     = fOldMomentum;
-        fNewPolarization = fOldPolarization;
-      }
-      break;
-    }
-    else
-    {
-      // Calculate Angle between Normal and Photon Momentum
-      G4double anglePhotonToNormal = fOldMomentum.angle(-fGlobalNormal);
-      // Round to closest integer: LBNL model array has 91 values
-      G4int angleIncident = std::lrint(anglePhotonToNormal / CLHEP::deg);
-
-      // Take random angles THETA and PHI,
-      // and see if below Probability - if not - Redo
-      do
-      {
-        thetaIndex = G4RandFlat::shootInt(thetaIndexMax - 1);
-        phiIndex   = G4RandFlat::shootInt(phiIndexMax - 1);
-        // Find probability with the new indeces from LUT
-        angularDistVal = fOpticalSurface->GetAngularDistributionValue(
-          angleIncident, thetaIndex, phiIndex);
-        // Loop checking, 13-Aug-2015, Peter Gumplinger
-      } while(!G4BooleanRand(angularDistVal));
-
-      thetaRad = G4double(-90 + 4 * thetaIndex) * pi / 180.;
-      phiRad   = G4double(-90 + 5 * phiIndex) * pi / 180.;
-      // Rotate Photon Momentum in Theta, then in Phi
-      fNewMomentum = -fOldMomentum;
-
-      perpVectorTheta = fNewMomentum.cross(fGlobalNormal);
-      if(perpVectorTheta.mag() < fCarTolerance)
-      {
-        perpVectorTheta = fNewMomentum.orthogonal();
-      }
-      fNewMomentum =
-        fNewMomentum.rotate(anglePhotonToNormal - thetaRad, perpVectorTheta);
-      perpVectorPhi = perpVectorTheta.cross(fNewMomentum);
-      fNewMomentum  = fNewMomentum.rotate(-phiRad, perpVectorPhi);
-
-      // Rotate Polarization too:
-      fFacetNormal     = (fNewMomentum - fOldMomentum).unit();
-      fNewPolarization = -fOldPolarization +
-                         (2. * fOldPolarization * fFacetNormal * fFacetNormal);
-    }
-    // Loop checking, 13-Aug-2015, Peter Gumplinger
-  } while(fNewMomentum * fGlobalNormal <= 0.0);
+    DoAbsorption();
+  }
+  else if(fStatus != Transmission)
+  {
+    fFacetNormal = (fNewMomentum - fOldMomentum).unit();
+  }
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 void G4OpBoundaryProcess::DielectricLUTDAVIS()
 {
-  G4int angindex, random, angleIncident;
-  G4double reflectivityValue, elevation, azimuth;
-  G4double anglePhotonToNormal;
-
-  G4int lutbin  = fOpticalSurface->GetLUTbins();
-  G4double rand = G4UniformRand();
+  const G4OpSurfaceLUT* lut = GetSurfaceLUT();
 
-  G4double sinEl;
-  G4ThreeVector u, vNorm, w;
-
-  do
+  fStatus = lut->DielectricDAVIS(fOldMomentum, fOldPolarization, fGlobalNormal,
+                                 fEfficiency, fNewMomentum, fNewPolarization);
+  if(fStatus == Absorption)
   {
-    anglePhotonToNormal = fOldMomentum.angle(-fGlobalNormal);
-
-    // Davis model has 90 reflection bins: round down
-    // don't allow angleIncident to be 90 for anglePhotonToNormal close to 90
-    angleIncident = std::min(static_cast<G4int>(
-      std::floor(anglePhotonToNormal / CLHEP::deg)), 89);
-    reflectivityValue = fOpticalSurface->GetReflectivityLUTValue(angleIncident);
-
-    if(rand > reflectivityValue)
-    {
-      if(fEfficiency > 0.)
-      {
-        DoAbsorption();
-        break;
-      }
-      else
-      {
-        fStatus = Transmission;
-
-        if(angleIncident <= 0.01)
-        {
-          fNewMomentum = fOldMomentum;
-          break;
-        }
-
-        do
-        {
-          random = G4RandFlat::shootInt(1, lutbin + 1);
-          angindex =
-            (((random * 2) - 1)) + angleIncident * lutbin * 2 + 3640000;
-
-          azimuth =
-            fOpticalSurface->GetAngularDistributionValueLUT(angindex - 1);
-          elevation = fOpticalSurface->GetAngularDistributionValueLUT(angindex);
-        } while(elevation == 0. && azimuth == 0.);
-
-        sinEl = std::sin(elevation);
-        vNorm = (fGlobalNormal.cross(fOldMomentum)).unit();
-        u     = vNorm.cross(fGlobalNormal) * (sinEl * std::cos(azimuth));
-        vNorm *= (sinEl * std::sin(azimuth));
-        // fGlobalNormal shouldn't be modified here
-        w            = (fGlobalNormal *= std::cos(elevation));
-        fNewMomentum = u + vNorm + w;
-
-        // Rotate Polarization too:
-        fFacetNormal     = (fNewMomentum - fOldMomentum).unit();
-        fNewPolarization = -fOldPolarization + (2. * fOldPolarization *
-                                                fFacetNormal * fFacetNormal);
-      }
-    }
-    else
-    {
-      fStatus = LobeReflection;
-
-      if(angleIncident == 0)
-      {
-        fNewMomentum = -fOldMomentum;
-        break;
-      }
-
-      do
-      {
-        random   = G4RandFlat::shootInt(1, lutbin + 1);
-        angindex = (((random * 2) - 1)) + (angleIncident - 1) * lutbin * 2;
-
-        azimuth = fOpticalSurface->GetAngularDistributionValueLUT(angindex - 1);
-        elevation = fOpticalSurface->GetAngularDistributionValueLUT(angindex);
-      } while(elevation == 0. && azimuth == 0.);
-
-      sinEl = std::sin(elevation);
-      vNorm = (fGlobalNormal.cross(fOldMomentum)).unit();
-      u     = vNorm.cross(fGlobalNormal) * (sinEl * std::cos(azimuth));
-      vNorm *= (sinEl * std::sin(azimuth));
-      // fGlobalNormal shouldn't be modified here
-      w = (fGlobalNormal *= std::cos(elevation));
+    DoAbsorption();
+  }
+}
 
-      fNewMomentum = u + vNorm + w;
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+const G4OpSurfaceLUT* G4OpBoundaryProcess::GetSurfaceLUT()
+{
+  if(fSurfaceLUTGeneration != G4OpSurfaceLUT::GetGeneration())
+  {
+    fSurfaceLUTs.clear();
+    fSurfaceLUTGeneration = G4OpSurfaceLUT::GetGeneration();
+  }
+  auto it = fSurfaceLUTs.find(fOpticalSurface);
+  if(it != fSurfaceLUTs.end())
+    return it->second;
 
-      // Rotate Polarization too: (needs revision)
-      fNewPolarization = fOldPolarization;
-    }
-  } while(fNewMomentum * fGlobalNormal <= 0.0);
+  const G4OpSurfaceLUT* lut = G4OpSurfaceLUT::GetSurfaceLUT(fOpticalSurface);
+  fSurfaceLUTs[fOpticalSurface] = lut;
+  return lut;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
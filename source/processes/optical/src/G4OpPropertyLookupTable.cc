@@ -0,0 +1,146 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+////////////////////////////////////////////////////////////////////////
+// Optical Property Lookup Table Class Implementation
+////////////////////////////////////////////////////////////////////////
+//
+// File:        G4OpPropertyLookupTable.cc
+// Description: Per-material O(1) bin lookup for optical property vectors
+//
+////////////////////////////////////////////////////////////////////////
+
+#include "G4OpPropertyLookupTable.hh"
+
+#include "G4Material.hh"
+#include "G4MaterialPropertiesTable.hh"
+#include "G4PhysicsTable.hh"
+
+namespace
+{
+  // Number of grid cells per vector bin, and an upper limit on the grid
+  // size of a single material
+  const std::size_t cellsPerBin = 4;
+  const std::size_t maxCells    = 4096;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpPropertyLookupTable::Clear()
+{
+  fEntries.clear();
+  fCellBins.clear();
+  fPropertyIndex = -1;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+const G4PhysicsVector* G4OpPropertyLookupTable::GetProperty(
+  const G4Material* material) const
+{
+  if(fPropertyIndex < 0)
+  {
+    const std::size_t materialIndex = material->GetIndex();
+    return (materialIndex < fEntries.size()) ? fEntries[materialIndex].fVector
+                                             : nullptr;
+  }
+  // The vector stored at Build() may have been deleted since: always
+  // return the one currently held by the material properties table
+  const G4MaterialPropertiesTable* MPT = material->GetMaterialPropertiesTable();
+  if(MPT == nullptr)
+    return nullptr;
+  return MPT->GetProperty(fPropertyIndex);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpPropertyLookupTable::Build(G4int propertyIndex)
+{
+  Clear();
+  fPropertyIndex                          = propertyIndex;
+  const G4MaterialTable* theMaterialTable = G4Material::GetMaterialTable();
+  const std::size_t numOfMaterials        = G4Material::GetNumberOfMaterials();
+  fEntries.reserve(numOfMaterials);
+
+  for(std::size_t i = 0; i < numOfMaterials; ++i)
+  {
+    G4MaterialPropertiesTable* MPT =
+      (*theMaterialTable)[i]->GetMaterialPropertiesTable();
+    AddEntry((MPT != nullptr) ? MPT->GetProperty(propertyIndex) : nullptr);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpPropertyLookupTable::Build(const G4PhysicsTable* table)
+{
+  Clear();
+  if(table == nullptr)
+    return;
+  fEntries.reserve(table->entries());
+
+  for(std::size_t i = 0; i < table->entries(); ++i)
+  {
+    AddEntry((*table)(i));
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpPropertyLookupTable::AddEntry(const G4PhysicsVector* vec)
+{
+  Entry entry;
+  entry.fVector    = vec;
+  entry.fFirstCell = fCellBins.size();
+
+  const std::size_t nNodes = (vec != nullptr) ? vec->GetVectorLength() : 0;
+  if(nNodes < 2 || vec->GetMaxEnergy() <= vec->GetMinEnergy())
+  {
+    // empty grid: Value() uses the generic G4PhysicsVector lookup
+    fEntries.push_back(entry);
+    return;
+  }
+
+  entry.fEmin    = vec->GetMinEnergy();
+  entry.fEmax    = vec->GetMaxEnergy();
+  entry.fLastBin = nNodes - 2;
+  entry.fNCells  = std::min(cellsPerBin * (nNodes - 1), maxCells);
+  entry.fInvCellWidth = G4double(entry.fNCells) / (entry.fEmax - entry.fEmin);
+
+  // For each cell store the bin containing its lower edge, i.e. the last
+  // bin whose lower edge is strictly below it, so that the forward walk
+  // in Value() ends on the same bin as G4PhysicsVector::GetBin()
+  const G4double cellWidth =
+    (entry.fEmax - entry.fEmin) / G4double(entry.fNCells);
+  std::size_t idx          = 0;
+  for(std::size_t c = 0; c < entry.fNCells; ++c)
+  {
+    const G4double edge = entry.fEmin + G4double(c) * cellWidth;
+    while(idx < entry.fLastBin && edge > vec->Energy(idx + 1))
+    {
+      ++idx;
+    }
+    fCellBins.push_back(idx);
+  }
+  fEntries.push_back(entry);
+}
@@ -216,21 +216,22 @@ void G4OpRayleigh::BuildPhysicsTable(const G4ParticleDefinition&)
     }
     thePhysicsTable->insertAt(i, rayleigh);
   }
+  fRayleighLookup.Build(thePhysicsTable);
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 G4double G4OpRayleigh::GetMeanFreePath(const G4Track& aTrack, G4double,
                                        G4ForceCondition*)
 {
+  const size_t materialIndex = aTrack.GetMaterial()->GetIndex();
   G4PhysicsFreeVector* rayleigh =
-    static_cast<G4PhysicsFreeVector*>(
-      (*thePhysicsTable)(aTrack.GetMaterial()->GetIndex()));
+    static_cast<G4PhysicsFreeVector*>((*thePhysicsTable)(materialIndex));
 
   G4double rsLength = DBL_MAX;
   if(rayleigh)
   {
-    rsLength = rayleigh->Value(aTrack.GetDynamicParticle()->GetTotalMomentum(),
-                               idx_rslength);
+    rsLength = fRayleighLookup.Value(
+      rayleigh, materialIndex, aTrack.GetDynamicParticle()->GetTotalMomentum());
   }
   return rsLength;
 }
@@ -0,0 +1,413 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+////////////////////////////////////////////////////////////////////////
+// Optical Surface Look-Up-Table Class Implementation
+////////////////////////////////////////////////////////////////////////
+//
+// File:        G4OpSurfaceLUT.cc
+// Description: Sampling tables and boundary kernels for the LBNL (LUT)
+//              and DAVIS look-up-table surface models
+// Created:     2026-10-19
+//
+////////////////////////////////////////////////////////////////////////
+
+#include "G4OpSurfaceLUT.hh"
+
+#include "G4AutoLock.hh"
+#include "G4GeometryTolerance.hh"
+#include "G4OpticalSurface.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4SystemOfUnits.hh"
+#include "Randomize.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+
+namespace
+{
+  G4Mutex surfaceLUTMutex = G4MUTEX_INITIALIZER;
+
+  std::atomic<G4int> surfaceLUTGeneration(0);
+
+  // LBNL model array has 91 incident angle values
+  const G4int lbnlIncidentMax = 91;
+
+  std::map<const G4OpticalSurface*, std::unique_ptr<G4OpSurfaceLUT>>&
+  SurfaceLUTs()
+  {
+    static std::map<const G4OpticalSurface*, std::unique_ptr<G4OpSurfaceLUT>>
+      luts;
+    return luts;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+const G4OpSurfaceLUT* G4OpSurfaceLUT::GetSurfaceLUT(G4OpticalSurface* surface)
+{
+  if(surface == nullptr || (surface->GetType() != dielectric_LUT &&
+                            surface->GetType() != dielectric_LUTDAVIS))
+  {
+    return nullptr;
+  }
+
+  G4AutoLock l(&surfaceLUTMutex);
+  auto& luts = SurfaceLUTs();
+  auto it    = luts.find(surface);
+  if(it == luts.end())
+  {
+    it = luts.emplace(surface, std::unique_ptr<G4OpSurfaceLUT>(
+                                 new G4OpSurfaceLUT(surface))).first;
+  }
+  return it->second.get();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpSurfaceLUT::Clear()
+{
+  G4AutoLock l(&surfaceLUTMutex);
+  SurfaceLUTs().clear();
+  ++surfaceLUTGeneration;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4int G4OpSurfaceLUT::GetGeneration()
+{
+  return surfaceLUTGeneration.load();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4OpSurfaceLUT::G4OpSurfaceLUT(G4OpticalSurface* surface)
+  : fSurface(surface)
+{
+  fCarTolerance = G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+  fDAVIS        = (surface->GetType() == dielectric_LUTDAVIS);
+  if(fDAVIS)
+    BuildDAVIS();
+  else
+    BuildLBNL();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpSurfaceLUT::BuildLBNL()
+{
+  fLBNLStatus = G4OpBoundaryProcessStatus(
+    G4int(fSurface->GetFinish()) +
+    (G4int(NoRINDEX) - G4int(groundbackpainted)));
+
+  // G4OpBoundaryProcess samples thetaIndex in [0, thetaIndexMax-1) and
+  // phiIndex in [0, phiIndexMax-1)
+  fNIncident = lbnlIncidentMax;
+  fNTheta    = fSurface->GetThetaIndexMax() - 1;
+  fNPhi      = fSurface->GetPhiIndexMax() - 1;
+
+  fThetaRad.resize(fNTheta);
+  for(G4int i = 0; i < fNTheta; ++i)
+  {
+    fThetaRad[i] = G4double(-90 + 4 * i) * pi / 180.;
+  }
+  fPhiRad.resize(fNPhi);
+  for(G4int j = 0; j < fNPhi; ++j)
+  {
+    fPhiRad[j] = G4double(-90 + 5 * j) * pi / 180.;
+  }
+
+  // A random cell was accepted with probability equal to its value, so
+  // cells are weighted by the value clamped to [0, 1]
+  const G4int nCells = fNTheta * fNPhi;
+  fLBNLCDF.resize(std::size_t(fNIncident) * nCells);
+  for(G4int a = 0; a < fNIncident; ++a)
+  {
+    G4double sum = 0.;
+    for(G4int i = 0; i < fNTheta; ++i)
+    {
+      for(G4int j = 0; j < fNPhi; ++j)
+      {
+        G4double w = fSurface->GetAngularDistributionValue(a, i, j);
+        sum += std::min(std::max(w, G4double(0.)), G4double(1.));
+        fLBNLCDF[std::size_t(a) * nCells + i * fNPhi + j] = sum;
+      }
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpSurfaceLUT::BuildDAVIS()
+{
+  fLUTbins = fSurface->GetLUTbins();
+
+  fDAVISReflectivity.resize(fNDAVISAngles);
+  for(G4int a = 0; a < fNDAVISAngles; ++a)
+  {
+    fDAVISReflectivity[a] = fSurface->GetReflectivityLUTValue(a);
+  }
+
+  fDAVISFirst.assign(2 * fNDAVISAngles, 0);
+  fDAVISCount.assign(2 * fNDAVISAngles, 0);
+  std::vector<G4int> entries;
+  entries.reserve(fLUTbins);
+
+  // Section 0: reflection, section 1: transmission. Incident angle 0 is
+  // handled without sampling in both cases.
+  for(G4int section = 0; section < 2; ++section)
+  {
+    for(G4int a = 1; a < fNDAVISAngles; ++a)
+    {
+      // same layout as used by G4OpBoundaryProcess::DielectricLUTDAVIS
+      const G4int base = (section == 0) ? (a - 1) * fLUTbins * 2
+                                        : a * fLUTbins * 2 + 3640000;
+      entries.clear();
+      for(G4int k = 0; k < fLUTbins; ++k)
+      {
+        const G4int idx = base + 2 * k;
+        if(fSurface->GetAngularDistributionValueLUT(idx) != 0. ||
+           fSurface->GetAngularDistributionValueLUT(idx + 1) != 0.)
+        {
+          entries.push_back(idx);
+        }
+      }
+
+      const G4int slot  = section * fNDAVISAngles + a;
+      fDAVISCount[slot] = G4int(entries.size());
+      if(fDAVISCount[slot] == fLUTbins)
+      {
+        // all entries usable: sample them directly from base
+        fDAVISFirst[slot] = -1 - base;
+      }
+      else
+      {
+        fDAVISFirst[slot] = G4int(fDAVISEntries.size());
+        fDAVISEntries.insert(fDAVISEntries.end(), entries.begin(),
+                             entries.end());
+      }
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpSurfaceLUT::SampleLBNLCell(G4int angleIncident, G4int& thetaIndex,
+                                    G4int& phiIndex) const
+{
+  const std::size_t nCells = std::size_t(fNTheta) * fNPhi;
+  auto first = fLBNLCDF.begin() + std::size_t(angleIncident) * nCells;
+  auto last  = first + nCells;
+  const G4double total = *(last - 1);
+  if(total <= 0.)
+  {
+    G4ExceptionDescription ed;
+    ed << " Angular distribution of optical surface "
+       << fSurface->GetName() << " is empty for incident angle "
+       << angleIncident << " deg.";
+    G4Exception("G4OpSurfaceLUT::SampleLBNLCell", "OpBoun05", FatalException,
+                ed);
+    return;
+  }
+  const G4double u = total * G4UniformRand();
+  auto it          = std::upper_bound(first, last, u);
+  if(it == last)
+    --it;
+  const G4int cell = G4int(it - first);
+  thetaIndex       = cell / fNPhi;
+  phiIndex         = cell % fNPhi;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpSurfaceLUT::SampleDAVISAngles(G4int section, G4int angleIncident,
+                                       G4double& azimuth,
+                                       G4double& elevation) const
+{
+  const G4int slot  = section * fNDAVISAngles + angleIncident;
+  const G4int count = fDAVISCount[slot];
+  if(count == 0)
+  {
+    G4ExceptionDescription ed;
+    ed << " DAVIS look-up-table of optical surface " << fSurface->GetName()
+       << " has no entry for incident angle " << angleIncident << " deg.";
+    G4Exception("G4OpSurfaceLUT::SampleDAVISAngles", "OpBoun06",
+                FatalException, ed);
+    return;
+  }
+  const G4int k     = G4RandFlat::shootInt(count);
+  const G4int first = fDAVISFirst[slot];
+  const G4int idx =
+    (first < 0) ? (-1 - first) + 2 * k : fDAVISEntries[first + k];
+  azimuth           = fSurface->GetAngularDistributionValueLUT(idx);
+  elevation         = fSurface->GetAngularDistributionValueLUT(idx + 1);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4OpBoundaryProcessStatus G4OpSurfaceLUT::DielectricLBNL(
+  const G4ThreeVector& oldMomentum, const G4ThreeVector& oldPolarization,
+  const G4ThreeVector& normal, G4double reflectivity, G4double transmittance,
+  G4ThreeVector& newMomentum, G4ThreeVector& newPolarization) const
+{
+  G4OpBoundaryProcessStatus status = fLBNLStatus;
+
+  // Calculate Angle between Normal and Photon Momentum
+  const G4double anglePhotonToNormal = oldMomentum.angle(-normal);
+  // Round to closest integer: LBNL model array has 91 values
+  const G4int angleIncident =
+    std::min(G4int(std::lrint(anglePhotonToNormal / CLHEP::deg)),
+             fNIncident - 1);
+
+  G4int thetaIndex, phiIndex;
+  G4ThreeVector perpVectorTheta, perpVectorPhi, facetNormal;
+  do
+  {
+    const G4double rand = G4UniformRand();
+    if(rand > reflectivity)
+    {
+      status          = (rand > reflectivity + transmittance) ? Absorption
+                                                              : Transmission;
+      newMomentum     = oldMomentum;
+      newPolarization = oldPolarization;
+      break;
+    }
+
+    status = fLBNLStatus;
+    SampleLBNLCell(angleIncident, thetaIndex, phiIndex);
+
+    // Rotate Photon Momentum in Theta, then in Phi
+    newMomentum     = -oldMomentum;
+    perpVectorTheta = newMomentum.cross(normal);
+    if(perpVectorTheta.mag() < fCarTolerance)
+    {
+      perpVectorTheta = newMomentum.orthogonal();
+    }
+    newMomentum = newMomentum.rotate(
+      anglePhotonToNormal - fThetaRad[thetaIndex], perpVectorTheta);
+    perpVectorPhi = perpVectorTheta.cross(newMomentum);
+    newMomentum   = newMomentum.rotate(-fPhiRad[phiIndex], perpVectorPhi);
+
+    // Rotate Polarization too:
+    facetNormal     = (newMomentum - oldMomentum).unit();
+    newPolarization = -oldPolarization +
+                      (2. * oldPolarization * facetNormal * facetNormal);
+    // Loop checking, 13-Aug-2015, Peter Gumplinger
+  } while(newMomentum * normal <= 0.0);
+
+  return status;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+G4OpBoundaryProcessStatus G4OpSurfaceLUT::DielectricDAVIS(
+  const G4ThreeVector& oldMomentum, const G4ThreeVector& oldPolarization,
+  const G4ThreeVector& normal, G4double efficiency,
+  G4ThreeVector& newMomentum, G4ThreeVector& newPolarization) const
+{
+  const G4double rand = G4UniformRand();
+
+  const G4double anglePhotonToNormal = oldMomentum.angle(-normal);
+  // Davis model has 90 reflection bins: round down
+  // don't allow angleIncident to be 90 for anglePhotonToNormal close to 90
+  const G4int angleIncident = std::min(
+    static_cast<G4int>(std::floor(anglePhotonToNormal / CLHEP::deg)), 89);
+
+  newMomentum     = oldMomentum;
+  newPolarization = oldPolarization;
+
+  G4OpBoundaryProcessStatus status;
+  G4int section;
+  if(rand > fDAVISReflectivity[angleIncident])
+  {
+    if(efficiency > 0.)
+      return Absorption;
+    status  = Transmission;
+    section = 1;
+  }
+  else
+  {
+    status  = LobeReflection;
+    section = 0;
+  }
+
+  if(angleIncident == 0)
+  {
+    if(status == LobeReflection)
+      newMomentum = -oldMomentum;
+    return status;
+  }
+
+  G4double azimuth, elevation, sinEl;
+  G4ThreeVector u, vNorm;
+  const G4ThreeVector axis = (normal.cross(oldMomentum)).unit();
+  const G4ThreeVector uDir = axis.cross(normal);
+  do
+  {
+    SampleDAVISAngles(section, angleIncident, azimuth, elevation);
+
+    sinEl       = std::sin(elevation);
+    u           = uDir * (sinEl * std::cos(azimuth));
+    vNorm       = axis * (sinEl * std::sin(azimuth));
+    newMomentum = u + vNorm + normal * std::cos(elevation);
+  } while(newMomentum * normal <= 0.0);
+
+  if(status == Transmission)
+  {
+    // Rotate Polarization too:
+    const G4ThreeVector facetNormal = (newMomentum - oldMomentum).unit();
+    newPolarization = -oldPolarization +
+                      (2. * oldPolarization * facetNormal * facetNormal);
+  }
+  // for LobeReflection the polarization is kept (needs revision)
+
+  return status;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpSurfaceLUT::DielectricLBNL(
+  std::size_t n, const G4ThreeVector* oldMomentum,
+  const G4ThreeVector* oldPolarization, const G4ThreeVector* normal,
+  const G4double* reflectivity, const G4double* transmittance,
+  G4ThreeVector* newMomentum, G4ThreeVector* newPolarization,
+  G4OpBoundaryProcessStatus* status) const
+{
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    status[i] = DielectricLBNL(oldMomentum[i], oldPolarization[i], normal[i],
+                               reflectivity[i], transmittance[i],
+                               newMomentum[i], newPolarization[i]);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+void G4OpSurfaceLUT::DielectricDAVIS(
+  std::size_t n, const G4ThreeVector* oldMomentum,
+  const G4ThreeVector* oldPolarization, const G4ThreeVector* normal,
+  const G4double* efficiency, G4ThreeVector* newMomentum,
+  G4ThreeVector* newPolarization, G4OpBoundaryProcessStatus* status) const
+{
+  for(std::size_t i = 0; i < n; ++i)
+  {
+    status[i] = DielectricDAVIS(oldMomentum[i], oldPolarization[i], normal[i],
+                                efficiency[i], newMomentum[i],
+                                newPolarization[i]);
+  }
+}
@@ -0,0 +1,137 @@
+#include "CommonHeader.h"
+
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// testG4OpPropertyLookupTable
+//
+// Regression test of G4OpPropertyLookupTable against changes of the
+// material properties table after the lookup tables are built: setting
+// RINDEX again makes G4MaterialPropertiesTable delete and recompute the
+// GROUPVEL vector, and the group velocity must then be taken from the
+// new vector.
+
+#include "G4OpPropertyLookupTable.hh"
+
+#include "G4Material.hh"
+#include "G4MaterialPropertiesTable.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4SystemOfUnits.hh"
+#include "globals.hh"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  // Checks the group velocity of the material over the range of its
+  // RINDEX, against the current GROUPVEL vector and, if refIndex > 0,
+  // against c_light/refIndex (constant refractive index)
+  G4bool CheckGroupVelocity(const G4OpPropertyLookupTable& lookup,
+                            const G4Material* material, G4double refIndex)
+  {
+    const G4MaterialPropertiesTable* MPT =
+      material->GetMaterialPropertiesTable();
+    const G4PhysicsVector* groupvel = lookup.GetProperty(material);
+    if(groupvel == nullptr || groupvel != MPT->GetProperty(kGROUPVEL))
+    {
+      G4cerr << "GetProperty() does not return the current GROUPVEL"
+             << G4endl;
+      return false;
+    }
+
+    const G4PhysicsVector* rindex = MPT->GetProperty(kRINDEX);
+    const G4double emin = rindex->GetMinEnergy();
+    const G4double emax = rindex->GetMaxEnergy();
+    const G4int nPoints = 1000;
+    for(G4int i = 0; i <= nPoints; ++i)
+    {
+      const G4double energy = emin + (emax - emin) * i / nPoints;
+      const G4double value =
+        lookup.Value(groupvel, material->GetIndex(), energy);
+      if(value != groupvel->Value(energy))
+      {
+        G4cerr << "Group velocity " << value / (cm / ns) << " cm/ns at "
+               << energy / eV << " eV differs from G4PhysicsVector::Value() "
+               << groupvel->Value(energy) / (cm / ns) << " cm/ns" << G4endl;
+        return false;
+      }
+      if(refIndex > 0. &&
+         std::abs(value - c_light / refIndex) > 1.e-12 * c_light)
+      {
+        G4cerr << "Group velocity " << value / (cm / ns) << " cm/ns at "
+               << energy / eV << " eV, expected "
+               << c_light / refIndex / (cm / ns) << " cm/ns" << G4endl;
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+int main()
+{
+  G4Material* glass =
+    new G4Material("testGlass", 14., 28.0855 * g / mole, 2.2 * g / cm3);
+  G4MaterialPropertiesTable* MPT = new G4MaterialPropertiesTable();
+  glass->SetMaterialPropertiesTable(MPT);
+
+  std::vector<G4double> energies = { 2.0 * eV, 2.5 * eV, 3.0 * eV, 3.5 * eV };
+  MPT->AddProperty("RINDEX", energies, std::vector<G4double>(4, 1.5));
+
+  G4OpPropertyLookupTable lookup;
+  lookup.Build(kGROUPVEL);
+
+  G4bool ok = CheckGroupVelocity(lookup, glass, 1.5);
+
+  // Same energies, other index: the GROUPVEL vector is replaced by one of
+  // the same length
+  MPT->AddProperty("RINDEX", energies, std::vector<G4double>(4, 1.3));
+  ok = ok && CheckGroupVelocity(lookup, glass, 1.3);
+
+  // Other energies and a dispersive index
+  std::vector<G4double> energies2 = { 1.8 * eV, 2.2 * eV, 2.6 * eV,
+                                      3.0 * eV, 3.4 * eV, 3.8 * eV };
+  std::vector<G4double> rindex2 = { 1.40, 1.41, 1.43, 1.46, 1.50, 1.55 };
+  MPT->AddProperty("RINDEX", energies2, rindex2);
+  ok = ok && CheckGroupVelocity(lookup, glass, 0.);
+
+  // Rebuilding the table uses the grids of the current vectors again
+  lookup.Build(kGROUPVEL);
+  ok = ok && CheckGroupVelocity(lookup, glass, 0.);
+
+  // Once the vector is removed from the material properties table, the
+  // material has no group velocity
+  MPT->RemoveProperty("GROUPVEL");
+  if(lookup.GetProperty(glass) != nullptr)
+  {
+    G4cerr << "GetProperty() returns a removed GROUPVEL vector" << G4endl;
+    ok = false;
+  }
+
+  G4cout << "testG4OpPropertyLookupTable: " << (ok ? "passed" : "FAILED")
+         << G4endl;
+  return ok ? 0 : 1;
+}
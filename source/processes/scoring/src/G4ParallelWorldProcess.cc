@@ -320,7 +320,7 @@ G4double G4ParallelWorldProcess::AlongStepGetPhysicalInteractionLength(
     if(eLimited == kDoNot)
     {
       fOnBoundary = false;
-      fGhostSafety = fGhostNavigator->ComputeSafety(endTrack.GetPosition());      
+      fGhostSafety = fPathFinder->ObtainEndPointSafety(fNavigatorID);
     }
     else
     {
@@ -361,7 +361,7 @@ G4double G4ParallelWorldScoringProcess::AlongStepGetPhysicalInteractionLength(
     {
       // Track is not on the boundary
       fOnBoundary = false;
-      fGhostSafety = fGhostNavigator->ComputeSafety(endTrack.GetPosition());
+      fGhostSafety = fPathFinder->ObtainEndPointSafety(fNavigatorID);
     }
     else
     {
@@ -126,6 +126,10 @@ class G4Transportation : public G4VProcess
      inline void EnableShortStepOptimisation(G4bool optimise=true); 
      // Whether short steps < safety will avoid to call Navigator (if field=0)
 
+     inline void EnableSafetyCacheReuse(G4bool reuse=true); 
+     // Whether the end-point safety can be taken from the safety spheres
+     // cached by G4SafetyHelper, when these cover at least the step length
+
      static G4bool EnableMagneticMoment(G4bool useMoment=true); 
      // Whether to enable particles to be deflected with force due to magnetic moment
 
@@ -234,6 +238,11 @@ class G4Transportation : public G4VProcess
      //
      G4bool   fShortStepOptimisation; 
 
+     // Whether to take the end-point safety from the safety helper cache.
+     // If using it, the safety estimate for endpoint will likely be smaller.
+     //
+     G4bool   fSafetyCacheReuse = false; 
+
      G4SafetyHelper* fpSafetyHelper;    // To pass it the safety value obtained
      G4TransportationLogger* fpLogger;  // Reports issues / raises warnings
 
@@ -958,6 +958,10 @@ G4CoupledTransportation::StartTracking(G4Track* aTrack)
   fPathFinder->PrepareNewTrack( position, direction); 
   // This implies a call to fPathFinder->Locate( position, direction ); 
 
+  // Safety spheres of the previous track are not reused
+  //
+  fpSafetyHelper->ClearSafetyCache();
+
   // Whether field exists should be determined at run level -- TODO
   fAnyFieldExists= DoesAnyFieldExist(); 
 
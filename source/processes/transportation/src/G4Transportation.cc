@@ -446,12 +446,22 @@ G4double G4Transportation::AlongStepGetPhysicalInteractionLength(
   {
     if(particleCharge != 0.0)
     {
-      G4double endSafety =
-        fLinearNavigator->ComputeSafety(fTransportEndPosition);
+      // A cached safety sphere covering at least a step of the same
+      // length avoids the call to the Navigator
+      //
+      G4double endSafety = 0.0;
+      if(fSafetyCacheReuse)
+      {
+        endSafety = fpSafetyHelper->GetCachedSafety(fTransportEndPosition);
+      }
+      if(endSafety < fEndPointDistance)
+      {
+        endSafety = fLinearNavigator->ComputeSafety(fTransportEndPosition);
+        fpSafetyHelper->SetCurrentSafety(endSafety, fTransportEndPosition);
+      }
       currentSafety      = endSafety;
       fPreviousSftOrigin = fTransportEndPosition;
       fPreviousSafety    = currentSafety;
-      fpSafetyHelper->SetCurrentSafety(currentSafety, fTransportEndPosition);
 
       // Because the Stepping Manager assumes it is from the start point,
       //  add the StepLength
@@ -785,6 +795,7 @@ G4Transportation::StartTracking(G4Track* aTrack)
   //
   fPreviousSafety    = 0.0 ; 
   fPreviousSftOrigin = G4ThreeVector(0.,0.,0.) ;
+  fpSafetyHelper->ClearSafetyCache();
   
   // reset looping counter -- for motion in field
   fNoLooperTrials= 0; 